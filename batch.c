@@ -0,0 +1,266 @@
+/**
+ * @brief Implementation of batch.
+ *
+ * This file implements the parallel solve of problem files. Each file is one
+ * task of a thread pool; the result lines are written under a mutex, so lines
+ * of different files never mix.
+ *
+ * @file batch.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#define _POSIX_C_SOURCE 200809L /**< scandir and alphasort also with -std=c99. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include "batch.h"
+#include "lp_model.h"
+#include "lp_reader.h"
+#include "simplex_log.h"
+#include "stats.h"
+#include "thread_pool.h"
+
+/**
+ * @brief State shared by the tasks of a batch.
+ */
+struct BatchRun
+{
+    FILE *out; /**< Stream for the result lines. */
+    FILE *tableaus; /**< Stream for the final tableaus or NULL. */
+    pthread_mutex_t mutex; /**< Lock of the streams and failed. */
+    long failed; /**< Number of files which could not be read. */
+};
+
+/**
+ * @brief Solve task of one file.
+ */
+struct BatchJob
+{
+    struct BatchRun *run; /**< Shared state. */
+    const char *path; /**< Path of the file. */
+};
+
+/**
+ * @brief Solve one file.
+ *
+ * This function is the task of the thread pool.
+ *
+ * @param data
+ *    job of the file
+ */
+static void batch_solve_file(void *data);
+
+/**
+ * @brief Append a path to a list of problem files.
+ *
+ * @param files
+ *    list of files
+ * @param path
+ *    path to copy into the list
+ * @return 0 on success, -2 if no memory is left
+ */
+static int batch_files_append(struct BatchFiles *files, const char *path);
+
+void batch_files_init(struct BatchFiles *files)
+{
+    files->paths = NULL;
+    files->count = 0;
+    files->size = 0;
+}
+
+int batch_files_add(struct BatchFiles *files, const char *path)
+{
+    struct stat info;
+    struct dirent **entries;
+    char *child;
+    int i, n, result = 0;
+
+    if(strcmp(path, "-") == 0) /* stdin, read by lp_read_file. */
+    {
+        return batch_files_append(files, path);
+    }
+    if(stat(path, &info) != 0)
+    {
+        return -1;
+    }
+    if(!S_ISDIR(info.st_mode))
+    {
+        return batch_files_append(files, path);
+    }
+
+    n = scandir(path, &entries, NULL, alphasort);
+    if(n < 0)
+    {
+        return -1;
+    }
+    for(i=0; i<n; ++i)
+    {
+        if(result == 0 && entries[i]->d_name[0] != '.')
+        {
+            child = (char *)malloc(strlen(path) + strlen(entries[i]->d_name) + 2);
+            if(child == NULL)
+            {
+                result = -2;
+            }
+            else
+            {
+                sprintf(child, "%s/%s", path, entries[i]->d_name);
+                if(batch_files_add(files, child) == -2) /* Entries which vanished are skipped. */
+                {
+                    result = -2;
+                }
+                free(child);
+            }
+        }
+        free(entries[i]);
+    }
+    free(entries);
+
+    return result;
+}
+
+void batch_files_free(struct BatchFiles *files)
+{
+    int i;
+
+    for(i=0; i<files->count; ++i)
+    {
+        free(files->paths[i]);
+    }
+    free(files->paths);
+    batch_files_init(files);
+}
+
+long batch_solve(const struct BatchFiles *files, int threads, FILE *out, FILE *tableaus)
+{
+    struct BatchRun run;
+    struct BatchJob *jobs, single;
+    struct ThreadPool *pool;
+    int i;
+
+    run.out = out;
+    run.tableaus = tableaus;
+    run.failed = 0;
+    pthread_mutex_init(&(run.mutex), NULL);
+
+    jobs = (struct BatchJob *)malloc((size_t)(files->count + 1) * sizeof(struct BatchJob));
+    pool = (jobs != NULL) ? thread_pool_create(threads) : NULL;
+    for(i=0; i<files->count; ++i)
+    {
+        if(pool != NULL)
+        {
+            jobs[i].run = &run;
+            jobs[i].path = files->paths[i];
+            thread_pool_submit(pool, batch_solve_file, &(jobs[i]));
+        }
+        else /* No memory for the workers, the files are solved one by one in the calling thread. */
+        {
+            single.run = &run;
+            single.path = files->paths[i];
+            batch_solve_file(&single);
+        }
+    }
+    if(pool != NULL)
+    {
+        thread_pool_free(pool);
+    }
+
+    free(jobs);
+    pthread_mutex_destroy(&(run.mutex));
+
+    return run.failed;
+}
+
+static void batch_solve_file(void *data)
+{
+    static const char *names[] = {"optimal", "unbounded", "infeasible", "limit", "cancelled", "error", "overflow"};
+    struct BatchJob *job = (struct BatchJob *)data;
+    struct BatchRun *run = job->run;
+    struct LpReadError error;
+    struct LpModel *model;
+    struct Tableau *tableau;
+    struct SimplexContext *context;
+    struct SimplexLog log;
+    enum SimplexStatus status;
+    char objective[BUFFER];
+    double start;
+
+    start = stats_now();
+    model = lp_read_file(job->path, &error);
+    if(model == NULL)
+    {
+        pthread_mutex_lock(&(run->mutex));
+        ++(run->failed);
+        fprintf(run->out, "%s\terror\t-\t0\t%f\n", job->path, stats_now() - start);
+        fflush(run->out);
+        fprintf(stderr, "%s:%d: %s\n", job->path, error.line, error.message);
+        pthread_mutex_unlock(&(run->mutex));
+        return;
+    }
+
+    tableau = lp_model_compile(model);
+    context = (tableau != NULL) ? simplex_context_create(tableau) : NULL;
+    status = (context != NULL) ? simplex_iterate(context, 0) : SIMPLEX_ERROR;
+    if(status == SIMPLEX_OPTIMAL)
+    {
+        rational_format(objective, sizeof(objective), lp_model_get_objective(model, tableau));
+    }
+    else
+    {
+        strcpy(objective, "-");
+    }
+
+    pthread_mutex_lock(&(run->mutex));
+    if(run->tableaus != NULL && tableau != NULL)
+    {
+        fprintf(run->tableaus, "%s:\n", job->path);
+        simplex_log_init(&log, SIMPLEX_LOG_TABLEAU, simplex_log_file_sink, run->tableaus);
+        simplex_log_tableau(&log, SIMPLEX_LOG_TABLEAU, tableau);
+        simplex_log_free(&log);
+        fflush(run->tableaus);
+    }
+    fprintf(run->out, "%s\t%s\t%s\t%ld\t%f\n", job->path, names[status], objective,
+            (context != NULL) ? context->iterations : 0L, stats_now() - start);
+    fflush(run->out);
+    pthread_mutex_unlock(&(run->mutex));
+
+    if(context != NULL)
+    {
+        simplex_context_free(context);
+    }
+    simplex_free_tableau(tableau);
+    lp_model_free(model);
+}
+
+static int batch_files_append(struct BatchFiles *files, const char *path)
+{
+    char **grown;
+    int size;
+
+    if(files->count == files->size)
+    {
+        size = (files->size == 0) ? 64 : 2 * files->size;
+        grown = (char **)realloc(files->paths, (size_t)size * sizeof(char *));
+        if(grown == NULL)
+        {
+            return -2;
+        }
+        files->paths = grown;
+        files->size = size;
+    }
+    files->paths[files->count] = (char *)malloc(strlen(path) + 1);
+    if(files->paths[files->count] == NULL)
+    {
+        return -2;
+    }
+    strcpy(files->paths[files->count], path);
+    ++(files->count);
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+/**
+ * @brief Header file for batch.
+ *
+ * This file describes the parallel solve of many problem files, e.g. for
+ * regression runs over a directory of models.
+ *
+ * @file batch.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef BATCH_H
+#define BATCH_H BATCH_H
+
+#include <stdio.h>
+
+/**
+ * @brief List of problem files.
+ */
+struct BatchFiles
+{
+    char **paths; /**< Paths of files. */
+    int count; /**< Number of files. */
+    int size; /**< Capacity of paths. */
+};
+
+/**
+ * @brief Initialize an empty list of problem files.
+ *
+ * @param files
+ *    list to initialize
+ */
+void batch_files_init(struct BatchFiles *files);
+
+/**
+ * @brief Add problem files.
+ *
+ * This function adds the given file, or all files below the given directory in
+ * alphabetical order. Hidden files and directories are skipped. The path "-"
+ * is added as it is and read from stdin by batch_solve.
+ *
+ * @param files
+ *    list of files
+ * @param path
+ *    path of file or directory, or "-"
+ * @return 0 on success, -1 if the path does not exist, -2 if no memory is left;
+ *    files added before the memory ran out stay in the list
+ */
+int batch_files_add(struct BatchFiles *files, const char *path);
+
+/**
+ * @brief Free memory of a list of problem files.
+ *
+ * @param files
+ *    list to free
+ */
+void batch_files_free(struct BatchFiles *files);
+
+/**
+ * @brief Solve problem files in parallel.
+ *
+ * This function reads, compiles and solves the given files on a pool of worker
+ * threads. For each file one line with the tab separated fields path, status,
+ * objective, pivots and seconds is written to out as soon as the solve
+ * finishes, e.g. "a.lp\toptimal\t49000\t3\t0.000021". The status is one of
+ * optimal, unbounded, infeasible, error and overflow, the objective is "-"
+ * unless the status is optimal. If no memory is left for the pool, the files
+ * are solved one after another in the calling thread.
+ *
+ * @param files
+ *    files to solve
+ * @param threads
+ *    number of worker threads, number of cores if <= 0
+ * @param out
+ *    stream for the result lines
+ * @param tableaus
+ *    stream for the final tableaus, written before the result line; NULL to
+ *    never format tableaus
+ * @return number of files which could not be read
+ */
+long batch_solve(const struct BatchFiles *files, int threads, FILE *out, FILE *tableaus);
+
+#endif
@@ -0,0 +1,916 @@
+/**
+ * @brief Benchmark of the solvers.
+ *
+ * This file implements a program which runs the solvers over generated
+ * problem families and problem files and reports the wall time, the number of
+ * iterations and the peak memory as CSV or JSON. The peak memory is measured
+ * in a child process which runs one solve, so it does not include the memory
+ * of earlier configurations.
+ *
+ * Usage: benchmark [options]
+ *   --family LIST   dense, sparse, klee-minty, transport, assignment, degenerate or all
+ *   --solver LIST   bland, dantzig, auto, hybrid, interior, network, race or all
+ *   --sizes LIST    problem sizes, e.g. 4,8,16
+ *   --file PATH     additional problem in MPS or LP format, may be repeated
+ *   --seed N        seed of the generators
+ *   --warmup N      untimed runs per configuration
+ *   --repeat N      timed runs per configuration
+ *   --format F      csv or json
+ *
+ * @file benchmark.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#define _DEFAULT_SOURCE /**< wait4 also with -std=c99. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "simplex.h"
+#include "lp_model.h"
+#include "lp_reader.h"
+#include "hybrid.h"
+#include "interior.h"
+#include "network.h"
+#include "race.h"
+
+#define BENCHMARK_MAX_SIZES 32 /**< Maximal number of sizes. */
+#define BENCHMARK_MAX_FILES 32 /**< Maximal number of problem files. */
+#define BENCHMARK_NOT_APPLICABLE -1 /**< Result of a solver which can not solve a problem. */
+
+/**
+ * @brief Generator of a problem family.
+ *
+ * @param size
+ *    size of problem
+ * @param random
+ *    state of random number generator
+ * @return new tableau or NULL if the family has no problem of this size
+ */
+typedef struct Tableau *BenchmarkGenerator(int size, unsigned long long *random);
+
+/**
+ * @brief Solver configuration.
+ *
+ * @param tableau
+ *    problem to solve in place
+ * @param iterations
+ *    number of pivots or steps, -1 if unknown
+ * @return status of solve or BENCHMARK_NOT_APPLICABLE
+ */
+typedef int BenchmarkSolver(struct Tableau *tableau, long *iterations);
+
+/**
+ * @brief Named problem family.
+ */
+struct BenchmarkFamily
+{
+    const char *name; /**< Name of family. */
+    BenchmarkGenerator *generate; /**< Generator of family. */
+};
+
+/**
+ * @brief Named solver configuration.
+ */
+struct BenchmarkSolverEntry
+{
+    const char *name; /**< Name of configuration. */
+    BenchmarkSolver *solve; /**< Solver of configuration. */
+};
+
+/**
+ * @brief Options of the benchmark.
+ */
+struct BenchmarkOptions
+{
+    const char *families; /**< Comma separated families. */
+    const char *solvers; /**< Comma separated solvers. */
+    int sizes[BENCHMARK_MAX_SIZES]; /**< Problem sizes. */
+    int sizeCount; /**< Number of sizes. */
+    const char *files[BENCHMARK_MAX_FILES]; /**< Problem files. */
+    int fileCount; /**< Number of files. */
+    unsigned long long seed; /**< Seed of generators. */
+    int warmup; /**< Untimed runs per configuration. */
+    int repeat; /**< Timed runs per configuration. */
+    int json; /**< 1 for JSON output, 0 for CSV. */
+    int rows; /**< Number of written results. */
+};
+
+/**
+ * @brief Next random number.
+ *
+ * @param random
+ *    state of xorshift generator
+ * @param low
+ *    smallest number
+ * @param high
+ *    largest number
+ * @return uniformly distributed number in [low, high]
+ */
+static int random_int(unsigned long long *random, int low, int high);
+
+/**
+ * @brief Create tableau for max cx s.t. Ax <= b, x >= 0.
+ *
+ * @param rows
+ *    number of inequalities
+ * @param cols
+ *    number of variables
+ * @return new tableau with slack basis
+ */
+static struct Tableau *inequality_tableau(int rows, int cols);
+
+/**
+ * @brief Random dense problem with positive coefficients.
+ *
+ * @param size
+ *    size of problem
+ * @param random
+ *    state of random number generator
+ * @return new tableau
+ */
+static struct Tableau *generate_dense(int size, unsigned long long *random);
+
+/**
+ * @brief Random sparse problem with two entries per column.
+ *
+ * @param size
+ *    size of problem
+ * @param random
+ *    state of random number generator
+ * @return new tableau
+ */
+static struct Tableau *generate_sparse(int size, unsigned long long *random);
+
+/**
+ * @brief Klee-Minty cube, the worst case of the rule of Dantzig.
+ *
+ * @param size
+ *    size of problem
+ * @param random
+ *    state of random number generator
+ * @return new tableau
+ */
+static struct Tableau *generate_klee_minty(int size, unsigned long long *random);
+
+/**
+ * @brief Transportation problem with size sources and size sinks.
+ *
+ * @param size
+ *    size of problem
+ * @param random
+ *    state of random number generator
+ * @return new tableau
+ */
+static struct Tableau *generate_transport(int size, unsigned long long *random);
+
+/**
+ * @brief Assignment problem with size workers and size jobs.
+ *
+ * @param size
+ *    size of problem
+ * @param random
+ *    state of random number generator
+ * @return new tableau
+ */
+static struct Tableau *generate_assignment(int size, unsigned long long *random);
+
+/**
+ * @brief Highly degenerate problem with mostly zero limits.
+ *
+ * @param size
+ *    size of problem
+ * @param random
+ *    state of random number generator
+ * @return new tableau
+ */
+static struct Tableau *generate_degenerate(int size, unsigned long long *random);
+
+/**
+ * @brief Solve with simplex_iterate and the given configuration.
+ *
+ * @param tableau
+ *    problem to solve
+ * @param iterations
+ *    number of pivots
+ * @param pricing
+ *    pricing rule
+ * @param form
+ *    form of problem
+ * @return status of solve
+ */
+static int solve_context(struct Tableau *tableau, long *iterations, enum SimplexPricing pricing, enum SimplexForm form);
+
+/**
+ * @brief Primal simplex with the rule of Bland.
+ *
+ * @param tableau
+ *    problem to solve
+ * @param iterations
+ *    number of pivots or steps
+ * @return status of solve
+ */
+static int solve_bland(struct Tableau *tableau, long *iterations);
+
+/**
+ * @brief Primal simplex with the rule of Dantzig.
+ *
+ * @param tableau
+ *    problem to solve
+ * @param iterations
+ *    number of pivots or steps
+ * @return status of solve
+ */
+static int solve_dantzig(struct Tableau *tableau, long *iterations);
+
+/**
+ * @brief Simplex with automatic choice of primal or dual problem.
+ *
+ * @param tableau
+ *    problem to solve
+ * @param iterations
+ *    number of pivots or steps
+ * @return status of solve
+ */
+static int solve_auto(struct Tableau *tableau, long *iterations);
+
+/**
+ * @brief Floating-point phase 2 with certification, for valid start tableaus.
+ *
+ * @param tableau
+ *    problem to solve
+ * @param iterations
+ *    number of pivots or steps
+ * @return status of solve
+ */
+static int solve_hybrid(struct Tableau *tableau, long *iterations);
+
+/**
+ * @brief Interior point method with crossover.
+ *
+ * @param tableau
+ *    problem to solve
+ * @param iterations
+ *    number of pivots or steps
+ * @return status of solve
+ */
+static int solve_interior(struct Tableau *tableau, long *iterations);
+
+/**
+ * @brief Network simplex, for network problems.
+ *
+ * @param tableau
+ *    problem to solve
+ * @param iterations
+ *    number of pivots or steps
+ * @return status of solve
+ */
+static int solve_network(struct Tableau *tableau, long *iterations);
+
+/**
+ * @brief Race of the default strategies.
+ *
+ * @param tableau
+ *    problem to solve
+ * @param iterations
+ *    number of pivots or steps
+ * @return status of solve
+ */
+static int solve_race(struct Tableau *tableau, long *iterations);
+
+/**
+ * @brief Check whether a name is in a comma separated list.
+ *
+ * @param list
+ *    list of names or "all"
+ * @param name
+ *    name to search
+ * @return 1 if the name is selected, 0 else
+ */
+static int selected(const char *list, const char *name);
+
+/**
+ * @brief Benchmark all selected solvers for one problem.
+ *
+ * @param options
+ *    options of benchmark
+ * @param family
+ *    name of problem family or file
+ * @param size
+ *    size of problem
+ * @param tableau
+ *    problem, not changed
+ */
+static void run_problem(struct BenchmarkOptions *options, const char *family, int size, struct Tableau *tableau);
+
+/**
+ * @brief Measure the peak memory of one solve.
+ *
+ * This function runs one solve in a forked child process. The peak resident
+ * set of the child starts with the pages it shares with this process, but
+ * unlike the peak of this process it does not grow with earlier solves.
+ *
+ * @param solver
+ *    solver to measure
+ * @param tableau
+ *    problem, not changed
+ * @return peak resident set of the child in kB, -1 if it could not be measured
+ */
+static long peak_rss_kb(const struct BenchmarkSolverEntry *solver, struct Tableau *tableau);
+
+/**
+ * @brief Compare times for qsort.
+ *
+ * @param a
+ *    first time
+ * @param b
+ *    second time
+ * @return order of times
+ */
+static int compare_double(const void *a, const void *b);
+
+/**
+ * @brief Name of a status.
+ *
+ * @param status
+ *    status of solve or BENCHMARK_NOT_APPLICABLE
+ * @return name of status
+ */
+static const char *status_name(int status);
+
+static const struct BenchmarkFamily families[] =
+{
+    {"dense", generate_dense},
+    {"sparse", generate_sparse},
+    {"klee-minty", generate_klee_minty},
+    {"transport", generate_transport},
+    {"assignment", generate_assignment},
+    {"degenerate", generate_degenerate}
+};
+
+static const struct BenchmarkSolverEntry solvers[] =
+{
+    {"bland", solve_bland},
+    {"dantzig", solve_dantzig},
+    {"auto", solve_auto},
+    {"hybrid", solve_hybrid},
+    {"interior", solve_interior},
+    {"network", solve_network},
+    {"race", solve_race}
+};
+
+/**
+ * @brief Run the benchmark.
+ *
+ * @param argc
+ *    number of arguments
+ * @param argv
+ *    arguments
+ * @return EXIT_SUCCESS or EXIT_FAILURE for invalid arguments
+ */
+int main(int argc, char **argv)
+{
+    struct BenchmarkOptions options;
+    struct LpReadError error;
+    struct LpModel *model;
+    struct Tableau *tableau;
+    unsigned long long random;
+    const char *list;
+    char *end;
+    int i, f, s;
+
+    options.families = "all";
+    options.solvers = "all";
+    options.sizes[0] = 4;
+    options.sizes[1] = 8;
+    options.sizes[2] = 16;
+    options.sizeCount = 3;
+    options.fileCount = 0;
+    options.seed = 1;
+    options.warmup = 1;
+    options.repeat = 5;
+    options.json = 0;
+    options.rows = 0;
+
+    for(i=1; i<argc; ++i)
+    {
+        if(i + 1 >= argc)
+        {
+            fprintf(stderr, "Missing value of option %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+        if(strcmp(argv[i], "--family") == 0)
+        {
+            options.families = argv[++i];
+        }
+        else if(strcmp(argv[i], "--solver") == 0)
+        {
+            options.solvers = argv[++i];
+        }
+        else if(strcmp(argv[i], "--sizes") == 0)
+        {
+            for(list=argv[++i], options.sizeCount=0; *list != '\0' && options.sizeCount < BENCHMARK_MAX_SIZES; )
+            {
+                options.sizes[options.sizeCount] = (int)strtol(list, &end, 10);
+                if(end == list || options.sizes[options.sizeCount] <= 0)
+                {
+                    fprintf(stderr, "Invalid sizes: %s\n", argv[i]);
+                    return EXIT_FAILURE;
+                }
+                ++(options.sizeCount);
+                list = (*end == ',') ? end + 1 : end;
+            }
+        }
+        else if(strcmp(argv[i], "--file") == 0 && options.fileCount < BENCHMARK_MAX_FILES)
+        {
+            options.files[(options.fileCount)++] = argv[++i];
+        }
+        else if(strcmp(argv[i], "--seed") == 0)
+        {
+            options.seed = strtoull(argv[++i], NULL, 10);
+        }
+        else if(strcmp(argv[i], "--warmup") == 0)
+        {
+            options.warmup = atoi(argv[++i]);
+        }
+        else if(strcmp(argv[i], "--repeat") == 0)
+        {
+            options.repeat = atoi(argv[++i]);
+        }
+        else if(strcmp(argv[i], "--format") == 0)
+        {
+            options.json = strcmp(argv[++i], "json") == 0;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(options.repeat < 1)
+    {
+        options.repeat = 1;
+    }
+
+    if(options.json)
+    {
+        printf("[\n");
+    }
+    else
+    {
+        printf("family,size,solver,status,repeats,median_ms,p95_ms,iterations,peak_rss_kb\n");
+    }
+
+    for(f=0; f<(int)(sizeof(families) / sizeof(families[0])); ++f)
+    {
+        if(!selected(options.families, families[f].name))
+        {
+            continue;
+        }
+        for(s=0; s<options.sizeCount; ++s)
+        {
+            random = options.seed * 0x9E3779B97F4A7C15ULL + (unsigned long long)(f * 1000 + options.sizes[s]) + 1;
+            tableau = families[f].generate(options.sizes[s], &random);
+            if(tableau != NULL)
+            {
+                run_problem(&options, families[f].name, options.sizes[s], tableau);
+                simplex_free_tableau(tableau);
+            }
+        }
+    }
+
+    for(f=0; f<options.fileCount; ++f)
+    {
+        model = lp_read_file(options.files[f], &error);
+        if(model == NULL)
+        {
+            fprintf(stderr, "%s:%d: %s\n", options.files[f], error.line, error.message);
+            continue;
+        }
+        tableau = lp_model_compile(model);
+        if(tableau != NULL)
+        {
+            run_problem(&options, options.files[f], tableau->rows, tableau);
+            simplex_free_tableau(tableau);
+        }
+        lp_model_free(model);
+    }
+
+    if(options.json)
+    {
+        printf("\n]\n");
+    }
+
+    return EXIT_SUCCESS;
+}
+
+static int random_int(unsigned long long *random, int low, int high)
+{
+    unsigned long long x = *random;
+
+    x ^= x >> 12; /* xorshift64* */
+    x ^= x << 25;
+    x ^= x >> 27;
+    *random = x;
+    x *= 0x2545F4914F6CDD1DULL;
+
+    return low + (int)((x >> 33) % (unsigned long long)(high - low + 1));
+}
+
+static struct Tableau *inequality_tableau(int rows, int cols)
+{
+    struct Tableau *tableau;
+    int i;
+
+    tableau = simplex_create_tableau(rows, rows + cols);
+    for(i=0; i<cols; ++i)
+    {
+        tableau->nbvs[i] = i;
+    }
+    for(i=0; i<rows; ++i)
+    {
+        tableau->bvs[i] = cols + i;
+    }
+
+    return tableau;
+}
+
+static struct Tableau *generate_dense(int size, unsigned long long *random)
+{
+    struct Tableau *tableau = inequality_tableau(size, size);
+    int i, j;
+
+    for(j=0; j<size; ++j)
+    {
+        (tableau->c[j])->n = random_int(random, 1, 9);
+    }
+    for(i=0; i<size; ++i)
+    {
+        for(j=0; j<size; ++j)
+        {
+            (tableau->A[i][j])->n = random_int(random, 1, 9);
+        }
+        (tableau->b[i])->n = random_int(random, 10 * size, 20 * size);
+    }
+
+    return tableau;
+}
+
+static struct Tableau *generate_sparse(int size, unsigned long long *random)
+{
+    struct Tableau *tableau = inequality_tableau(size, 2 * size);
+    int i, j;
+
+    for(j=0; j<2*size; ++j)
+    {
+        (tableau->c[j])->n = random_int(random, 1, 9);
+        (tableau->A[j % size][j])->n = random_int(random, 1, 5); /* Each line and column has an entry. */
+        (tableau->A[random_int(random, 0, size - 1)][j])->n = random_int(random, 1, 5);
+    }
+    for(i=0; i<size; ++i)
+    {
+        (tableau->b[i])->n = random_int(random, size, 3 * size);
+    }
+
+    return tableau;
+}
+
+static struct Tableau *generate_klee_minty(int size, unsigned long long *random)
+{
+    struct Tableau *tableau;
+    int i, j, limit = 5;
+
+    (void)random;
+    if(size > 13) /* 5^size must fit into int. */
+    {
+        return NULL;
+    }
+
+    tableau = inequality_tableau(size, size);
+    for(j=0; j<size; ++j) /* max sum 2^(n-j) x_j s.t. sum_(j<i) 2^(i-j+1) x_j + x_i <= 5^i */
+    {
+        (tableau->c[j])->n = 1 << (size - 1 - j);
+    }
+    for(i=0; i<size; ++i)
+    {
+        for(j=0; j<i; ++j)
+        {
+            (tableau->A[i][j])->n = 1 << (i - j + 1);
+        }
+        (tableau->A[i][i])->n = 1;
+        (tableau->b[i])->n = limit;
+        limit *= 5;
+    }
+
+    return tableau;
+}
+
+static struct Tableau *generate_transport(int size, unsigned long long *random)
+{
+    struct Tableau *tableau = inequality_tableau(2 * size, size * size);
+    int i, j, total = 0, demand;
+
+    for(i=0; i<size; ++i) /* sum_j x_ij <= supply_i, -sum_i x_ij <= -demand_j, minimize cost */
+    {
+        (tableau->b[i])->n = random_int(random, 10, 30);
+        total += (tableau->b[i])->n;
+        for(j=0; j<size; ++j)
+        {
+            (tableau->c[i * size + j])->n = -random_int(random, 1, 20);
+            (tableau->A[i][i * size + j])->n = 1;
+            (tableau->A[size + j][i * size + j])->n = -1;
+        }
+    }
+    for(j=0; j<size; ++j)
+    {
+        demand = (j < size - 1) ? total / size : total - (size - 1) * (total / size);
+        (tableau->b[size + j])->n = -demand;
+    }
+
+    return tableau;
+}
+
+static struct Tableau *generate_assignment(int size, unsigned long long *random)
+{
+    struct Tableau *tableau = inequality_tableau(2 * size, size * size);
+    int i, j;
+
+    for(i=0; i<size; ++i)
+    {
+        (tableau->b[i])->n = 1;
+        (tableau->b[size + i])->n = -1;
+        for(j=0; j<size; ++j)
+        {
+            (tableau->c[i * size + j])->n = -random_int(random, 1, 50);
+            (tableau->A[i][i * size + j])->n = 1;
+            (tableau->A[size + j][i * size + j])->n = -1;
+        }
+    }
+
+    return tableau;
+}
+
+static struct Tableau *generate_degenerate(int size, unsigned long long *random)
+{
+    struct Tableau *tableau = inequality_tableau(2 * size, size);
+    int i, j;
+
+    for(j=0; j<size; ++j)
+    {
+        (tableau->c[j])->n = random_int(random, 1, 5);
+        (tableau->A[2 * size - 1][j])->n = 1; /* sum x <= size bounds the problem. */
+    }
+    (tableau->b[2 * size - 1])->n = size;
+    for(i=0; i<2*size-1; ++i) /* All other limits are 0. */
+    {
+        for(j=0; j<size; ++j)
+        {
+            (tableau->A[i][j])->n = random_int(random, -1, 2);
+        }
+    }
+
+    return tableau;
+}
+
+static int solve_context(struct Tableau *tableau, long *iterations, enum SimplexPricing pricing, enum SimplexForm form)
+{
+    struct SimplexContext *context;
+    enum SimplexStatus status;
+
+    tableau->pricing = pricing;
+    context = simplex_context_create(tableau);
+    if(context == NULL)
+    {
+        *iterations = 0;
+        return SIMPLEX_ERROR;
+    }
+    context->form = form;
+    status = simplex_iterate(context, 0);
+    *iterations = context->iterations;
+    simplex_context_free(context);
+
+    return status;
+}
+
+static int solve_bland(struct Tableau *tableau, long *iterations)
+{
+    return solve_context(tableau, iterations, SIMPLEX_PRICING_BLAND, SIMPLEX_FORM_PRIMAL);
+}
+
+static int solve_dantzig(struct Tableau *tableau, long *iterations)
+{
+    return solve_context(tableau, iterations, SIMPLEX_PRICING_DANTZIG, SIMPLEX_FORM_PRIMAL);
+}
+
+static int solve_auto(struct Tableau *tableau, long *iterations)
+{
+    return solve_context(tableau, iterations, SIMPLEX_PRICING_BLAND, SIMPLEX_FORM_AUTO);
+}
+
+static int solve_hybrid(struct Tableau *tableau, long *iterations)
+{
+    struct SimplexStats stats, *previous;
+    int i, result;
+
+    for(i=0; i<tableau->rows; ++i)
+    {
+        if((tableau->b[i])->n < 0)
+        {
+            return BENCHMARK_NOT_APPLICABLE;
+        }
+    }
+
+    stats_reset(&stats);
+    previous = stats_bind(&stats);
+    result = simplex_find_best_solution_hybrid(tableau);
+    stats_bind(previous);
+    *iterations = stats.pivots[0] + stats.pivots[1] + stats.pivots[2];
+
+    return (result < 0) ? SIMPLEX_ERROR : SIMPLEX_OPTIMAL;
+}
+
+static int solve_interior(struct Tableau *tableau, long *iterations)
+{
+    int status, steps = 0;
+
+    status = simplex_interior_point(tableau, NULL, &steps);
+    *iterations = steps;
+
+    return status;
+}
+
+static int solve_network(struct Tableau *tableau, long *iterations)
+{
+    struct Network *network;
+    int status;
+
+    network = network_create(tableau);
+    if(network == NULL)
+    {
+        return BENCHMARK_NOT_APPLICABLE;
+    }
+    status = network_solve(network);
+    *iterations = network->pivots;
+    network_free(network);
+
+    return status;
+}
+
+static int solve_race(struct Tableau *tableau, long *iterations)
+{
+    *iterations = -1;
+
+    return simplex_race(tableau, NULL, 0, 0, NULL);
+}
+
+static int selected(const char *list, const char *name)
+{
+    size_t length = strlen(name);
+    const char *start;
+
+    if(strcmp(list, "all") == 0)
+    {
+        return 1;
+    }
+    for(start=list; (start = strstr(start, name)) != NULL; start += length)
+    {
+        if((start == list || start[-1] == ',') && (start[length] == '\0' || start[length] == ','))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void run_problem(struct BenchmarkOptions *options, const char *family, int size, struct Tableau *tableau)
+{
+    struct Tableau *copy;
+    double *times, start;
+    long iterations = -1, peak;
+    int i, k, status = BENCHMARK_NOT_APPLICABLE;
+
+    times = (double *)malloc(options->repeat * sizeof(double));
+    if(times == NULL)
+    {
+        fprintf(stderr, ERROR_MALLOC_FAILED);
+        exit(EXIT_FAILURE);
+    }
+
+    for(k=0; k<(int)(sizeof(solvers) / sizeof(solvers[0])); ++k)
+    {
+        if(!selected(options->solvers, solvers[k].name))
+        {
+            continue;
+        }
+
+        for(i=0; i<options->warmup + options->repeat; ++i)
+        {
+            copy = simplex_copy_tableau(tableau); /* Copying is not timed. */
+            if(copy == NULL)
+            {
+                fprintf(stderr, ERROR_MALLOC_FAILED);
+                exit(EXIT_FAILURE);
+            }
+            start = stats_now();
+            status = solvers[k].solve(copy, &iterations);
+            if(i >= options->warmup)
+            {
+                times[i - options->warmup] = (stats_now() - start) * 1000.0;
+            }
+            simplex_free_tableau(copy);
+            if(status == BENCHMARK_NOT_APPLICABLE)
+            {
+                break;
+            }
+        }
+        if(status == BENCHMARK_NOT_APPLICABLE)
+        {
+            continue;
+        }
+
+        qsort(times, options->repeat, sizeof(double), compare_double);
+        peak = peak_rss_kb(&(solvers[k]), tableau);
+
+        if(options->json)
+        {
+            printf("%s  {\"family\": \"%s\", \"size\": %d, \"solver\": \"%s\", \"status\": \"%s\", \"repeats\": %d, "
+                   "\"median_ms\": %.4f, \"p95_ms\": %.4f, \"iterations\": %ld, \"peak_rss_kb\": %ld}",
+                   (options->rows > 0) ? ",\n" : "", family, size, solvers[k].name, status_name(status),
+                   options->repeat, times[(options->repeat - 1) / 2], times[(options->repeat * 95 + 99) / 100 - 1],
+                   iterations, peak);
+        }
+        else
+        {
+            printf("%s,%d,%s,%s,%d,%.4f,%.4f,%ld,%ld\n", family, size, solvers[k].name, status_name(status),
+                   options->repeat, times[(options->repeat - 1) / 2], times[(options->repeat * 95 + 99) / 100 - 1],
+                   iterations, peak);
+        }
+        fflush(stdout);
+        ++(options->rows);
+    }
+
+    free(times);
+}
+
+static long peak_rss_kb(const struct BenchmarkSolverEntry *solver, struct Tableau *tableau)
+{
+    struct Tableau *copy;
+    struct rusage usage;
+    long iterations;
+    int status;
+    pid_t pid;
+
+    fflush(stdout); /* The child must not write buffered rows again. */
+    pid = fork();
+    if(pid == 0)
+    {
+        copy = simplex_copy_tableau(tableau);
+        if(copy != NULL)
+        {
+            solver->solve(copy, &iterations);
+        }
+        _exit((copy != NULL) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    if(pid < 0 || wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+    {
+        return -1;
+    }
+
+    return usage.ru_maxrss;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+static const char *status_name(int status)
+{
+    switch(status)
+    {
+        case SIMPLEX_OPTIMAL:
+            return "optimal";
+        case SIMPLEX_UNBOUNDED:
+            return "unbounded";
+        case SIMPLEX_INFEASIBLE:
+            return "infeasible";
+        case SIMPLEX_LIMIT_REACHED:
+            return "limit";
+        case SIMPLEX_CANCELLED:
+            return "cancelled";
+        case SIMPLEX_ERROR:
+            return "error";
+        case SIMPLEX_OVERFLOW:
+            return "overflow";
+        default:
+            return "n/a";
+    }
+}
@@ -3,6 +3,17 @@
 
 #include "check_simplex.h"
 #include "check_rational.h"
+#include "check_lp.h"
+#include "check_race.h"
+#include "check_hybrid.h"
+#include "check_modular.h"
+#include "check_interior.h"
+#include "check_network.h"
+#include "check_daemon.h"
+#include "check_batch.h"
+#include "check_snapshot.h"
+#include "check_clone.h"
+#include "check_decomposition.h"
 
 int main(void)
 {
@@ -10,10 +21,32 @@ int main(void)
     SRunner *sr;
     Suite *s_rational = rational_suite();
     Suite *s_simplex = simplex_suite();
+    Suite *s_lp = lp_suite();
+    Suite *s_race = race_suite();
+    Suite *s_hybrid = hybrid_suite();
+    Suite *s_modular = modular_suite();
+    Suite *s_interior = interior_suite();
+    Suite *s_network = network_suite();
+    Suite *s_daemon = daemon_suite();
+    Suite *s_batch = batch_suite();
+    Suite *s_snapshot = snapshot_suite();
+    Suite *s_clone = clone_suite();
+    Suite *s_decomposition = decomposition_suite();
 
 
     sr = srunner_create(s_simplex);
     srunner_add_suite(sr, s_rational);
+    srunner_add_suite(sr, s_lp);
+    srunner_add_suite(sr, s_race);
+    srunner_add_suite(sr, s_hybrid);
+    srunner_add_suite(sr, s_modular);
+    srunner_add_suite(sr, s_interior);
+    srunner_add_suite(sr, s_network);
+    srunner_add_suite(sr, s_daemon);
+    srunner_add_suite(sr, s_batch);
+    srunner_add_suite(sr, s_snapshot);
+    srunner_add_suite(sr, s_clone);
+    srunner_add_suite(sr, s_decomposition);
 
     srunner_run_all(sr, CK_NORMAL);
 
@@ -0,0 +1,82 @@
+/**
+ * @brief Check unit tests for batch solving.
+ *
+ * This file contains the unit tests for the parallel solve of problem files.
+ *
+ * @file check_batch.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <check.h>
+
+#include "batch.h"
+#include "check_fixtures.h"
+
+START_TEST(test_batch)
+{
+    struct BatchFiles files;
+    char directory[64], path[96], line[256];
+    FILE *file, *out;
+    int i, optimal = 0, errors = 0;
+
+    snprintf(directory, sizeof(directory), "/tmp/check_batch_%d", (int)getpid());
+    mkdir(directory, 0700);
+    for(i=0; i<3; ++i)
+    {
+        snprintf(path, sizeof(path), "%s/%d.%s", directory, i, (i == 1) ? "mps" : "lp");
+        file = fopen(path, "w");
+        fputs((i == 1) ? example_mps : (i == 0) ? example_lp : "max\n x\nst\n x + <= 3\nend\n", file);
+        fclose(file);
+    }
+
+    batch_files_init(&files);
+    ck_assert_int_eq(batch_files_add(&files, directory), 0);
+    ck_assert_int_eq(batch_files_add(&files, "/nonexistent/file.lp"), -1);
+    ck_assert_int_eq(files.count, 3);
+    snprintf(path, sizeof(path), "%s/1.mps", directory);
+    ck_assert_str_eq(files.paths[1], path);
+
+    out = tmpfile();
+    ck_assert_int_eq(batch_solve(&files, 2, out, NULL), 1);
+    rewind(out);
+    while(fgets(line, sizeof(line), out) != NULL)
+    {
+        optimal += (strstr(line, "\toptimal\t49000\t") != NULL);
+        errors += (strstr(line, "2.lp\terror\t-\t0\t") != NULL);
+    }
+    fclose(out);
+    ck_assert_int_eq(optimal, 2);
+    ck_assert_int_eq(errors, 1);
+
+    ck_assert_int_eq(batch_files_add(&files, "-"), 0);
+    ck_assert_int_eq(files.count, 4);
+    ck_assert_str_eq(files.paths[3], "-");
+
+    for(i=0; i<3; ++i)
+    {
+        unlink(files.paths[i]);
+    }
+    rmdir(directory);
+    batch_files_free(&files);
+}
+END_TEST
+
+Suite *batch_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Batch");
+
+    tc_core = tcase_create("Core");
+
+    tcase_add_test(tc_core, test_batch);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
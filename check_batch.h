@@ -0,0 +1,9 @@
+/**
+ * @brief Check unit tests for batch solving.
+ *
+ * @file check_batch.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+Suite *batch_suite(void);
@@ -0,0 +1,67 @@
+/**
+ * @brief Check unit tests for tableau cloning.
+ *
+ * This file contains the unit tests for the copy-on-write clones of tableaus.
+ *
+ * @file check_clone.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <check.h>
+
+#include "simplex.h"
+#include "check_fixtures.h"
+
+START_TEST(test_simplex_clone_tableau)
+{
+    struct Tableau *tableau, *phase1, *original, *expected, *clone, *grandchild;
+    int i;
+
+    tableau = create_test_tableau();
+    phase1 = simplex_find_start_corner(tableau);
+    prepare_with_start_corner(phase1, tableau);
+    simplex_free_tableau(phase1);
+    original = simplex_copy_tableau(tableau);
+    expected = simplex_copy_tableau(tableau);
+    simplex_find_best_solution(expected);
+
+    clone = simplex_clone_tableau(tableau);
+    grandchild = simplex_clone_tableau(clone);
+    check_same_tableau(tableau, clone);
+    for(i=0; i<tableau->rows; ++i)
+    {
+        ck_assert_ptr_eq(clone->A[i], tableau->A[i]);
+        ck_assert_int_eq(atomic_load(tableau->shared[i]), 3);
+    }
+
+    simplex_find_best_solution(clone);
+    check_same_tableau(expected, clone);
+    check_same_tableau(original, tableau);
+    check_same_tableau(original, grandchild);
+
+    simplex_free_tableau(tableau); /* The grandchild keeps the shared lines alive. */
+    simplex_find_best_solution(grandchild);
+    check_same_tableau(expected, grandchild);
+
+    simplex_free_tableau(grandchild);
+    simplex_free_tableau(clone);
+    simplex_free_tableau(expected);
+    simplex_free_tableau(original);
+}
+END_TEST
+
+Suite *clone_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Clone");
+
+    tc_core = tcase_create("Core");
+
+    tcase_add_test(tc_core, test_simplex_clone_tableau);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
@@ -0,0 +1,9 @@
+/**
+ * @brief Check unit tests for tableau cloning.
+ *
+ * @file check_clone.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+Suite *clone_suite(void);
@@ -0,0 +1,100 @@
+/**
+ * @brief Check unit tests for the solver daemon.
+ *
+ * This file contains the unit tests for the solver daemon and its client
+ * functions.
+ *
+ * @file check_daemon.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <check.h>
+
+#include "daemon.h"
+#include "check_fixtures.h"
+
+/**
+ * @brief Serve requests of a daemon.
+ *
+ * @param data
+ *    daemon
+ * @return NULL
+ */
+static void *serve(void *data)
+{
+    daemon_run((struct Daemon *)data);
+
+    return NULL;
+}
+
+START_TEST(test_daemon)
+{
+    const char *invalid = "max\n x + y\nst\n x + <= 3\nend\n";
+    struct Daemon *daemon;
+    pthread_t thread;
+    FILE *file;
+    char path[64], *response;
+    int fd, i;
+
+    snprintf(path, sizeof(path), "/tmp/check_daemon_%d.sock", (int)getpid());
+    daemon = daemon_create(path, 2, 0);
+    ck_assert_ptr_ne(daemon, NULL);
+    pthread_create(&thread, NULL, serve, daemon);
+
+    fd = daemon_connect(path);
+    ck_assert_int_ge(fd, 0);
+    ck_assert_int_eq(daemon_send(fd, 1, 0, example_lp, strlen(example_lp)), 0);
+    ck_assert_int_eq(daemon_send(fd, 2, 1000, example_mps, strlen(example_mps)), 0);
+    ck_assert_int_eq(daemon_send(fd, 3, 0, invalid, strlen(invalid)), 0);
+    for(i=0; i<3; ++i) /* Responses arrive in the order the solves finish. */
+    {
+        response = daemon_receive(fd);
+        ck_assert_ptr_ne(response, NULL);
+        if(strstr(response, "\"id\": 3,") != NULL)
+        {
+            ck_assert_ptr_ne(strstr(response, "\"status\": \"error\", \"message\": \"line 4: "), NULL);
+        }
+        else
+        {
+            ck_assert_ptr_ne(strstr(response, "\"status\": \"optimal\", \"objective\": \"49000\", "
+                                              "\"solution\": [\"130\", \"20\"]}"), NULL);
+        }
+        free(response);
+    }
+    close(fd);
+
+    daemon_stop(daemon);
+    pthread_join(thread, NULL);
+    ck_assert_int_eq(daemon->served, 3);
+    daemon_free(daemon, path);
+    ck_assert_int_ne(access(path, F_OK), 0);
+
+    file = fopen(path, "w"); /* Other files are not replaced by the socket. */
+    ck_assert_ptr_ne(file, NULL);
+    fclose(file);
+    ck_assert_ptr_eq(daemon_create(path, 2, 0), NULL);
+    ck_assert_int_eq(access(path, F_OK), 0);
+    unlink(path);
+}
+END_TEST
+
+Suite *daemon_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Daemon");
+
+    tc_core = tcase_create("Core");
+
+    tcase_add_test(tc_core, test_daemon);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
@@ -0,0 +1,9 @@
+/**
+ * @brief Check unit tests for the solver daemon.
+ *
+ * @file check_daemon.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+Suite *daemon_suite(void);
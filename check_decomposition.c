@@ -0,0 +1,134 @@
+/**
+ * @brief Check unit tests for the decomposition.
+ *
+ * This file contains the unit tests for the detection of block-angular
+ * tableaus and their Dantzig-Wolfe decomposition.
+ *
+ * @file check_decomposition.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <check.h>
+
+#include "decomposition.h"
+#include "check_fixtures.h"
+
+/**
+ * @brief Create tableau with a block-angular problem.
+ *
+ * Each of the given number of blocks has 3 variables and 2 lines. The coupling
+ * line 0 limits the sum of all variables to 12, the last coupling line requires
+ * a sum of at least 4 for the first two variables of each block.
+ *
+ * @param blocks
+ *    number of blocks
+ * @return tableau for problem
+ */
+static struct Tableau *create_block_tableau(int blocks)
+{
+    struct Tableau *tableau;
+    int i, j, k, rows = 2 * blocks + 2, cols = 3 * blocks;
+
+    tableau = simplex_create_tableau(rows, rows + cols);
+    for(j=0; j<cols; ++j)
+    {
+        (tableau->c[j])->n = 1 + (j * 5) % 7;
+        tableau->nbvs[j] = j;
+        (tableau->A[0][j])->n = 1;
+        (tableau->A[rows - 1][j])->n = (j % 3 != 2) ? -1 : 0;
+    }
+    for(i=0; i<rows; ++i)
+    {
+        tableau->bvs[i] = cols + i;
+    }
+    (tableau->b[0])->n = 12;
+    (tableau->b[rows - 1])->n = -4;
+    for(i=1; i<rows-1; ++i)
+    {
+        k = (i - 1) / 2;
+        (tableau->b[i])->n = 20 + (i * 11) % 7;
+        for(j=3*k; j<3*k+3; ++j)
+        {
+            (tableau->A[i][j])->n = 1 + (i * 7 + j * 13) % 5;
+        }
+    }
+
+    return tableau;
+}
+
+START_TEST(test_decomposition)
+{
+    struct Tableau *tableau, *exact;
+    struct DecompositionBlocks blocks;
+    struct ThreadPool *pool;
+    struct Rational values[9], objective, sum, expected;
+    int i, j, rounds = 0;
+
+    tableau = create_block_tableau(3);
+    ck_assert_int_eq(decomposition_detect(tableau, &blocks), 3);
+    ck_assert_int_eq(blocks.lineBlock[0], -1);
+    ck_assert_int_eq(blocks.lineBlock[7], -1);
+    for(i=1; i<7; ++i)
+    {
+        ck_assert_int_eq(blocks.lineBlock[i], blocks.columnBlock[3 * ((i - 1) / 2)]);
+    }
+    for(j=0; j<9; ++j)
+    {
+        ck_assert_int_eq(blocks.columnBlock[j], blocks.columnBlock[3 * (j / 3)]);
+    }
+
+    exact = create_block_tableau(3);
+    ck_assert_int_eq(simplex_solve(exact), SIMPLEX_OPTIMAL);
+    expected.n = -((exact->z)->n);
+    expected.d = (exact->z)->d;
+
+    ck_assert_int_eq(decomposition_solve(tableau, &blocks, NULL, values, &objective, &rounds), SIMPLEX_OPTIMAL);
+    ck_assert_int_gt(rounds, 0);
+    ck_assert_int_eq(rational_compare(objective, expected), 0);
+    ck_assert_int_eq((tableau->z)->n, 0); /* Tableau is not changed. */
+    for(i=0; i<8; ++i) /* Solution is valid. */
+    {
+        sum.n = 0;
+        sum.d = 1;
+        for(j=0; j<9; ++j)
+        {
+            ck_assert_int_ge(values[j].n, 0);
+            sum = rational_sum(sum, rational_product(*(tableau->A[i][j]), values[j]));
+        }
+        ck_assert_int_le(rational_compare(sum, *(tableau->b[i])), 0);
+    }
+
+    pool = thread_pool_create(2);
+    ck_assert_int_eq(decomposition_solve(tableau, NULL, pool, values, &objective, NULL), SIMPLEX_OPTIMAL);
+    ck_assert_int_eq(rational_compare(objective, expected), 0);
+
+    (tableau->b[7])->n = -1000; /* Coupling lines can not be satisfied. */
+    ck_assert_int_eq(decomposition_solve(tableau, &blocks, pool, values, NULL, NULL), SIMPLEX_INFEASIBLE);
+    (tableau->A[1][3])->n = 1; /* Blocks do not match. */
+    ck_assert_int_eq(decomposition_solve(tableau, &blocks, pool, values, NULL, NULL), SIMPLEX_ERROR);
+    thread_pool_free(pool);
+    decomposition_blocks_free(&blocks);
+    simplex_free_tableau(tableau);
+    simplex_free_tableau(exact);
+
+    tableau = create_single_tableau(1, -1, 1);
+    ck_assert_int_eq(decomposition_solve(tableau, NULL, NULL, values, NULL, NULL), SIMPLEX_UNBOUNDED);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+Suite *decomposition_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Decomposition");
+
+    tc_core = tcase_create("Core");
+
+    tcase_add_test(tc_core, test_decomposition);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
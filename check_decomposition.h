@@ -0,0 +1,9 @@
+/**
+ * @brief Check unit tests for the decomposition.
+ *
+ * @file check_decomposition.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+Suite *decomposition_suite(void);
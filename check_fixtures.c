@@ -0,0 +1,164 @@
+/**
+ * @brief Fixtures of the unit tests.
+ *
+ * This file implements the test problems and checks which are shared by
+ * the unit tests of several modules.
+ *
+ * @file check_fixtures.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <check.h>
+
+#include "check_fixtures.h"
+
+const char *example_lp =
+    "\\ Example of main.c\n"
+    "Maximize\n"
+    " obj: 300 x + 500 y\n"
+    "Subject To\n"
+    " c1: x + 2 y <= 170\n"
+    " c2: x + y <= 150\n"
+    " c3: 3 y <= 180\n"
+    " c4: y >= 1\n"
+    "End\n";
+
+const char *example_mps =
+    "NAME          EXAMPLE\n"
+    "OBJSENSE\n"
+    "    MAX\n"
+    "ROWS\n"
+    " N  obj\n"
+    " L  c1\n"
+    " L  c2\n"
+    " L  c3\n"
+    " G  c4\n"
+    "COLUMNS\n"
+    "    x         obj       300   c1        1\n"
+    "    x         c2        1\n"
+    "    y         obj       500   c1        2\n"
+    "    y         c2        1     c3        3\n"
+    "    y         c4        1\n"
+    "RHS\n"
+    "    RHS       c1        170   c2        150\n"
+    "    RHS       c3        180   c4        1\n"
+    "ENDATA\n";
+
+struct Tableau *create_test_tableau(void)
+{
+    struct Tableau *tableau;
+    int i, j;
+    int t[5][3] =
+    {
+        {300,500,0},
+        {1,2,170},
+        {1,1,150},
+        {0,3,180},
+        {0,-1,-1}
+    };
+
+    tableau = simplex_create_tableau(4,6);
+    for(i=0; i<2; ++i)
+    {
+        (tableau->c[i])->n = t[0][i];
+        tableau->nbvs[i] = i;
+    }
+    for(i=0; i<4; ++i)
+    {
+        (tableau->b[i])->n = t[i+1][2];
+        tableau->bvs[i] = i + 2;
+        for(j=0; j<2; ++j)
+        {
+            (tableau->A[i][j])->n = t[i+1][j];
+        }
+    }
+
+    return tableau;
+}
+
+struct Tableau *create_single_tableau(int c, int a, int b)
+{
+    struct Tableau *tableau;
+
+    tableau = simplex_create_tableau(1,2);
+    (tableau->c[0])->n = c;
+    (tableau->A[0][0])->n = a;
+    (tableau->b[0])->n = b;
+    tableau->nbvs[0] = 0;
+    tableau->bvs[0] = 1;
+
+    return tableau;
+}
+
+struct Tableau *create_tall_tableau(void)
+{
+    struct Tableau *tableau;
+    int i, j;
+    int t[10][3] =
+    {
+        {1,0,4}, {0,1,5}, {1,1,8}, {2,1,20}, {1,2,20},
+        {1,3,30}, {3,1,30}, {1,-1,6}, {-1,1,6}, {2,2,18}
+    };
+
+    tableau = simplex_create_tableau(10,12);
+    (tableau->c[0])->n = 2;
+    (tableau->c[1])->n = 3;
+    for(j=0; j<2; ++j)
+    {
+        tableau->nbvs[j] = j;
+    }
+    for(i=0; i<10; ++i)
+    {
+        (tableau->b[i])->n = t[i][2];
+        tableau->bvs[i] = i + 2;
+        for(j=0; j<2; ++j)
+        {
+            (tableau->A[i][j])->n = t[i][j];
+        }
+    }
+
+    return tableau;
+}
+
+void check_same_tableau(struct Tableau *a, struct Tableau *b)
+{
+    int i, j;
+
+    ck_assert_int_eq(a->rows, b->rows);
+    ck_assert_int_eq(a->cols, b->cols);
+    ck_assert_int_eq(rational_compare(*(a->z), *(b->z)), 0);
+    for(j=0; j<a->cols; ++j)
+    {
+        ck_assert_int_eq(a->nbvs[j], b->nbvs[j]);
+        ck_assert_int_eq(rational_compare(*(a->c[j]), *(b->c[j])), 0);
+    }
+    for(i=0; i<a->rows; ++i)
+    {
+        ck_assert_int_eq(a->bvs[i], b->bvs[i]);
+        ck_assert_int_eq(rational_compare(*(a->b[i]), *(b->b[i])), 0);
+        for(j=0; j<a->cols; ++j)
+        {
+            ck_assert_int_eq(rational_compare(*(a->A[i][j]), *(b->A[i][j])), 0);
+        }
+    }
+}
+
+struct Tableau *create_chain_tableau(int n)
+{
+    struct Tableau *tableau;
+    int i;
+
+    tableau = simplex_create_tableau(n, 2*n);
+    for(i=0; i<n; ++i)
+    {
+        (tableau->c[i])->n = 1 + i % 2;
+        tableau->nbvs[i] = i;
+        tableau->bvs[i] = n + i;
+        (tableau->b[i])->n = 2 + i % 3;
+        (tableau->A[i][i])->n = 1;
+        (tableau->A[i][(i+1) % n])->n = 1;
+    }
+
+    return tableau;
+}
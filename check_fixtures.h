@@ -0,0 +1,77 @@
+/**
+ * @brief Fixtures of the unit tests.
+ *
+ * This file describes the test problems and checks which are shared by
+ * the unit tests of several modules.
+ *
+ * @file check_fixtures.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef CHECK_FIXTURES_H
+#define CHECK_FIXTURES_H CHECK_FIXTURES_H
+
+#include "simplex.h"
+
+extern const char *example_lp; /**< Problem of create_test_tableau in LP format. */
+extern const char *example_mps; /**< Problem of create_test_tableau in MPS format. */
+
+/**
+ * @brief Create tableau with small test problem.
+ *
+ * Maximize 300x + 500y
+ * s.t.: x + 2y <= 170, x + y <= 150, 3y <= 180, y >= 1
+ *
+ * @return tableau for problem
+ */
+struct Tableau *create_test_tableau(void);
+
+/**
+ * @brief Create tableau with one variable and one inequality.
+ *
+ * Maximize cx s.t.: ax <= b
+ *
+ * @param c
+ *    coefficient of target function
+ * @param a
+ *    coefficient of inequality
+ * @param b
+ *    limit of inequality
+ * @return tableau for problem
+ */
+struct Tableau *create_single_tableau(int c, int a, int b);
+
+/**
+ * @brief Create tableau with more equations than variables.
+ *
+ * Maximize 2x + 3y
+ * s.t.: x <= 4, y <= 5, x + y <= 8, 2x + y <= 20, x + 2y <= 20, x + 3y <= 30,
+ *       3x + y <= 30, x - y <= 6, -x + y <= 6, 2x + 2y <= 18
+ *
+ * @return tableau for problem
+ */
+struct Tableau *create_tall_tableau(void);
+
+/**
+ * @brief Check that two tableaus are identical.
+ *
+ * @param a
+ *    first tableau
+ * @param b
+ *    second tableau
+ */
+void check_same_tableau(struct Tableau *a, struct Tableau *b);
+
+/**
+ * @brief Create tableau with a cyclic chain of inequalities.
+ *
+ * Maximize sum (1 + i % 2) x_i s.t.: x_i + x_((i+1) % n) <= 2 + i % 3
+ *
+ * @param n
+ *    number of variables and inequalities
+ * @return tableau for problem
+ */
+struct Tableau *create_chain_tableau(int n);
+
+#endif
@@ -0,0 +1,56 @@
+/**
+ * @brief Check unit tests for the hybrid solve.
+ *
+ * This file contains the unit tests for the floating point phase 2 with
+ * rational certification.
+ *
+ * @file check_hybrid.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <check.h>
+
+#include "hybrid.h"
+#include "check_fixtures.h"
+
+START_TEST(test_simplex_hybrid)
+{
+    struct Tableau *exact, *hybrid, *phase1;
+
+    exact = create_tall_tableau();
+    hybrid = create_tall_tableau();
+    simplex_find_best_solution(exact);
+    ck_assert_int_eq(simplex_find_best_solution_hybrid(hybrid), 1);
+    check_same_tableau(exact, hybrid);
+    simplex_free_tableau(exact);
+    simplex_free_tableau(hybrid);
+
+    exact = create_test_tableau();
+    phase1 = simplex_find_start_corner(exact);
+    prepare_with_start_corner(phase1, exact);
+    simplex_free_tableau(phase1);
+    hybrid = simplex_copy_tableau(exact);
+    simplex_find_best_solution(exact);
+    ck_assert_int_eq(simplex_find_best_solution_hybrid(hybrid), 1);
+    check_same_tableau(exact, hybrid);
+    ck_assert_int_eq((hybrid->z)->n, -49000);
+    simplex_free_tableau(exact);
+    simplex_free_tableau(hybrid);
+}
+END_TEST
+
+Suite *hybrid_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Hybrid");
+
+    tc_core = tcase_create("Core");
+
+    tcase_add_test(tc_core, test_simplex_hybrid);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
@@ -0,0 +1,9 @@
+/**
+ * @brief Check unit tests for the hybrid solve.
+ *
+ * @file check_hybrid.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+Suite *hybrid_suite(void);
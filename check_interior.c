@@ -0,0 +1,65 @@
+/**
+ * @brief Check unit tests for the interior point method.
+ *
+ * This file contains the unit tests for the interior point method with
+ * crossover.
+ *
+ * @file check_interior.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdlib.h>
+#include <check.h>
+
+#include "interior.h"
+#include "check_fixtures.h"
+
+START_TEST(test_simplex_interior_point)
+{
+    struct Tableau *tableau, *exact;
+    struct Rational **solution;
+    struct ThreadPool *pool;
+    int iterations = 0;
+
+    tableau = create_test_tableau();
+    ck_assert_int_eq(simplex_interior_point(tableau, NULL, &iterations), SIMPLEX_OPTIMAL);
+    ck_assert_int_gt(iterations, 0);
+    ck_assert_int_eq((tableau->z)->n, -49000);
+    solution = simplex_get_solution(tableau);
+    ck_assert_int_eq((*solution)[0].n, 130);
+    ck_assert_int_eq((*solution)[1].n, 20);
+    free(*solution);
+    free(solution);
+    simplex_free_tableau(tableau);
+
+    pool = thread_pool_create(2);
+    tableau = create_chain_tableau(70);
+    exact = create_chain_tableau(70);
+    ck_assert_int_eq(simplex_interior_point(tableau, pool, &iterations), SIMPLEX_OPTIMAL);
+    ck_assert_int_eq(simplex_solve(exact), SIMPLEX_OPTIMAL);
+    ck_assert_int_eq(rational_compare(*(tableau->z), *(exact->z)), 0);
+    simplex_free_tableau(tableau);
+    simplex_free_tableau(exact);
+    thread_pool_free(pool);
+
+    tableau = create_single_tableau(1,1,-1);
+    ck_assert_int_eq(simplex_interior_point(tableau, NULL, NULL), SIMPLEX_INFEASIBLE);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+Suite *interior_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Interior");
+
+    tc_core = tcase_create("Core");
+
+    tcase_add_test(tc_core, test_simplex_interior_point);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
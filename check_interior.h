@@ -0,0 +1,9 @@
+/**
+ * @brief Check unit tests for the interior point method.
+ *
+ * @file check_interior.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+Suite *interior_suite(void);
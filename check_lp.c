@@ -0,0 +1,187 @@
+/**
+ * @brief Check unit tests for lp models and readers.
+ *
+ * This file contains the unit tests for the lp models and the MPS and LP
+ * readers.
+ *
+ * @file check_lp.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <check.h>
+
+#include "lp_reader.h"
+#include "check_fixtures.h"
+
+/**
+ * @brief Solve model and check solution.
+ *
+ * This function solves the tableaus of lp_model_to_tableau and
+ * lp_model_compile.
+ *
+ * @param model
+ *    model to solve
+ * @param values
+ *    expected numerators of solution, denominators are 1
+ * @param objective
+ *    expected target function value
+ * @return 1 if both solutions are as expected
+ */
+static int solve_and_check(struct LpModel *model, const int *values, int objective)
+{
+    struct Tableau *tableau;
+    struct Rational *solution;
+    struct Rational value;
+    int i, j, ok = 1;
+
+    solution = (struct Rational *)malloc(model->variables * sizeof(struct Rational));
+    for(i=0; i<2; ++i)
+    {
+        tableau = (i == 0) ? lp_model_to_tableau(model) : lp_model_compile(model);
+        ok = ok && (simplex_solve(tableau) == SIMPLEX_OPTIMAL);
+
+        ok = ok && (lp_model_get_solution(model, tableau, solution) == 0);
+        for(j=0; j<model->variables; ++j)
+        {
+            ok = ok && solution[j].n == values[j] && solution[j].d == 1;
+        }
+        value = lp_model_get_objective(model, tableau);
+        ok = ok && value.n == objective && value.d == 1;
+
+        simplex_free_tableau(tableau);
+    }
+    free(solution);
+
+    return ok;
+}
+
+START_TEST(test_lp_read_lp)
+{
+    struct LpModel *model;
+    int expected[2] = {130, 20};
+
+    model = lp_read_lp(example_lp, strlen(example_lp), NULL);
+
+    ck_assert_ptr_ne(model, NULL);
+    ck_assert_int_eq(model->variables, 2);
+    ck_assert_int_eq(model->constraints, 4);
+    ck_assert_int_eq(model->entries, 6);
+    ck_assert_int_eq(model->sense[3], LP_GREATER_EQUAL);
+    ck_assert_int_eq(solve_and_check(model, expected, 49000), 1);
+
+    lp_model_free(model);
+}
+END_TEST
+
+START_TEST(test_lp_read_mps)
+{
+    struct LpModel *model;
+    int expected[2] = {130, 20};
+
+    model = lp_read_mps(example_mps, strlen(example_mps), NULL);
+
+    ck_assert_ptr_ne(model, NULL);
+    ck_assert_int_eq(model->maximize, 1);
+    ck_assert_int_eq(model->variables, 2);
+    ck_assert_int_eq(model->constraints, 4);
+    ck_assert_int_eq(model->entries, 6);
+    ck_assert_int_eq(solve_and_check(model, expected, 49000), 1);
+
+    lp_model_free(model);
+}
+END_TEST
+
+START_TEST(test_lp_read_bounds)
+{
+    const char *text =
+        "min\n"
+        " 2 a - b + c + 3\n"
+        "st\n"
+        " a + b + c = 4\n"
+        " -2 <= a - c <= 2.5\n"
+        "bounds\n"
+        " 1 <= a <= 10\n"
+        " b <= 3\n"
+        " c free\n"
+        "end\n";
+    struct LpModel *model;
+    int expected[3] = {1, 3, 0};
+
+    model = lp_read_lp(text, strlen(text), NULL);
+
+    ck_assert_ptr_ne(model, NULL);
+    ck_assert_int_eq(model->bounded[0], LP_HAS_LOWER | LP_HAS_UPPER);
+    ck_assert_int_eq(model->bounded[2], 0);
+    ck_assert_int_eq(model->ranged[1], 1);
+    ck_assert_int_eq(model->offset.n, 3);
+    ck_assert_int_eq(solve_and_check(model, expected, 2), 1);
+
+    lp_model_free(model);
+}
+END_TEST
+
+START_TEST(test_lp_builder)
+{
+    struct LpModel *model;
+    struct Tableau *tableau;
+    struct Rational cost[2] = {{300, 1}, {500, 1}}, row1[2] = {{1, 1}, {2, 1}}, row2[2] = {{1, 1}, {1, 1}};
+    struct Rational three = {3, 1}, one = {1, 1}, rhs[3] = {{170, 1}, {150, 1}, {180, 1}};
+    int columns[2] = {0, 1}, expected[2] = {130, 20};
+
+    model = lp_model_create();
+    lp_add_var(model, "x");
+    lp_add_var(model, "y");
+    lp_set_objective(model, 1, cost);
+    lp_add_constraint(model, 2, columns, row1, LP_LESS_EQUAL, rhs[0]);
+    lp_add_constraint(model, 2, columns, row2, LP_LESS_EQUAL, rhs[1]);
+    lp_add_constraint(model, 1, columns + 1, &three, LP_LESS_EQUAL, rhs[2]);
+    lp_add_constraint(model, 1, columns + 1, &one, LP_GREATER_EQUAL, one);
+
+    tableau = lp_model_compile(model); /* Only y >= 1 needs a surplus and an artificial variable. */
+    ck_assert_int_eq(tableau->rows, 4);
+    ck_assert_int_eq(tableau->cols, 3);
+    ck_assert_int_eq(tableau->artificials, 6);
+    ck_assert_int_eq(tableau->bvs[3], 6);
+    ck_assert_int_eq((tableau->b[3])->n, 1);
+    simplex_free_tableau(tableau);
+
+    ck_assert_int_eq(solve_and_check(model, expected, 49000), 1);
+
+    lp_model_free(model);
+}
+END_TEST
+
+START_TEST(test_lp_read_error)
+{
+    const char *text = "max\n x + y\nst\n x + <= 3\nend\n";
+    struct LpReadError error;
+
+    ck_assert_ptr_eq(lp_read_lp(text, strlen(text), &error), NULL);
+    ck_assert_int_eq(error.line, 4);
+
+    ck_assert_ptr_eq(lp_read_mps("ROWS\n X c1\n", 11, &error), NULL);
+    ck_assert_int_eq(error.line, 2);
+}
+END_TEST
+
+Suite *lp_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("LP");
+
+    tc_core = tcase_create("Core");
+
+    tcase_add_test(tc_core, test_lp_read_lp);
+    tcase_add_test(tc_core, test_lp_read_mps);
+    tcase_add_test(tc_core, test_lp_read_bounds);
+    tcase_add_test(tc_core, test_lp_read_error);
+    tcase_add_test(tc_core, test_lp_builder);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
@@ -0,0 +1,9 @@
+/**
+ * @brief Check unit tests for lp models and readers.
+ *
+ * @file check_lp.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+Suite *lp_suite(void);
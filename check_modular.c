@@ -0,0 +1,90 @@
+/**
+ * @brief Check unit tests for the modular solve.
+ *
+ * This file contains the unit tests for the multi-modular exact solve of basis
+ * systems.
+ *
+ * @file check_modular.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <check.h>
+
+#include "modular.h"
+#include "check_fixtures.h"
+
+START_TEST(test_modular_solve)
+{
+    struct Rational matrix[9] = {{2,1}, {1,1}, {0,1}, {1,1}, {3,1}, {1,1}, {0,1}, {1,2}, {4,1}};
+    struct Rational singular[4] = {{1,1}, {2,1}, {2,1}, {4,1}};
+    struct Rational rhs[3] = {{1,1}, {0,1}, {-1,3}};
+    struct Rational large[1] = {{3,1}};
+    struct Rational big[1] = {{2000000000,1}};
+    struct Rational x[3];
+    struct ThreadPool *pool;
+    int i, j;
+
+    pool = thread_pool_create(2);
+    ck_assert_int_eq(modular_solve(3, matrix, rhs, x, pool), 1);
+    for(i=0; i<3; ++i) /* Check A x = b exactly. */
+    {
+        struct Rational sum = {0, 1};
+        for(j=0; j<3; ++j)
+        {
+            sum = rational_sum(sum, rational_product(matrix[i*3+j], x[j]));
+        }
+        ck_assert_int_eq(rational_compare(sum, rhs[i]), 0);
+    }
+    thread_pool_free(pool);
+
+    ck_assert_int_eq(modular_solve(2, singular, rhs, x, NULL), 0);
+
+    ck_assert_int_eq(modular_solve(1, large, big, x, NULL), 1); /* Needs two primes. */
+    ck_assert_int_eq(x[0].n, 2000000000);
+    ck_assert_int_eq(x[0].d, 3);
+}
+END_TEST
+
+START_TEST(test_modular_basis_solution)
+{
+    struct Tableau *start, *tableau;
+    struct Rational values[12];
+    int i;
+
+    start = create_tall_tableau();
+    tableau = simplex_copy_tableau(start);
+    simplex_find_best_solution(tableau);
+
+    ck_assert_int_eq(modular_basis_solution(start, tableau->bvs, values, NULL), 1);
+    ck_assert_int_eq(values[0].n, 3);
+    ck_assert_int_eq(values[1].n, 5);
+    for(i=0; i<tableau->rows; ++i)
+    {
+        ck_assert_int_eq(rational_compare(values[tableau->bvs[i]], *(tableau->b[i])), 0);
+    }
+    for(i=0; i<tableau->cols; ++i)
+    {
+        ck_assert_int_eq(values[tableau->nbvs[i]].n, 0);
+    }
+
+    simplex_free_tableau(start);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+Suite *modular_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Modular");
+
+    tc_core = tcase_create("Core");
+
+    tcase_add_test(tc_core, test_modular_solve);
+    tcase_add_test(tc_core, test_modular_basis_solution);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
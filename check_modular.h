@@ -0,0 +1,9 @@
+/**
+ * @brief Check unit tests for the modular solve.
+ *
+ * @file check_modular.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+Suite *modular_suite(void);
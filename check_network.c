@@ -0,0 +1,132 @@
+/**
+ * @brief Check unit tests for the network simplex.
+ *
+ * This file contains the unit tests for the network simplex of node-arc
+ * incidence tableaus.
+ *
+ * @file check_network.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdlib.h>
+#include <check.h>
+
+#include "network.h"
+#include "check_fixtures.h"
+
+/**
+ * @brief Create tableau with a transportation problem.
+ *
+ * Minimize sum cost_ij x_ij s.t.: sum_j x_ij <= supply_i, sum_i x_ij >= demand_j
+ * with supply = (20, 30), demand = (10, 25, 15), cost = ((8, 6, 10), (9, 12, 13)).
+ * The demand lines are negated.
+ *
+ * @return tableau for problem
+ */
+static struct Tableau *create_transport_tableau(void)
+{
+    struct Tableau *tableau;
+    int supply[2] = {20, 30}, demand[3] = {10, 25, 15};
+    int cost[2][3] = {{8, 6, 10}, {9, 12, 13}};
+    int i, j;
+
+    tableau = simplex_create_tableau(5, 11);
+    for(i=0; i<2; ++i)
+    {
+        for(j=0; j<3; ++j)
+        {
+            (tableau->c[i*3+j])->n = -cost[i][j];
+            tableau->nbvs[i*3+j] = i*3+j;
+            (tableau->A[i][i*3+j])->n = 1;
+            (tableau->A[2+j][i*3+j])->n = -1;
+        }
+        (tableau->b[i])->n = supply[i];
+    }
+    for(j=0; j<3; ++j)
+    {
+        (tableau->b[2+j])->n = -demand[j];
+    }
+    for(i=0; i<5; ++i)
+    {
+        tableau->bvs[i] = 6 + i;
+    }
+
+    return tableau;
+}
+
+START_TEST(test_network)
+{
+    struct Tableau *tableau, *exact;
+    struct Network *network;
+    struct Rational **solution, **expected, value;
+    int i;
+
+    tableau = create_transport_tableau();
+    exact = create_transport_tableau();
+    ck_assert_int_eq(simplex_solve(exact), SIMPLEX_OPTIMAL);
+
+    network = network_create(tableau);
+    ck_assert_ptr_ne(network, NULL);
+    ck_assert_int_eq(network_solve(network), SIMPLEX_OPTIMAL);
+    value = network_get_objective(network);
+    ck_assert_int_eq(value.n, -((exact->z)->n));
+    ck_assert_int_eq(value.n, -465);
+
+    solution = network_get_solution(network);
+    for(i=0; i<6; ++i) /* Check the constraints. */
+    {
+        ck_assert_int_ge((*solution)[i].n, 0);
+    }
+    ck_assert_int_le((*solution)[0].n + (*solution)[1].n + (*solution)[2].n, 20);
+    ck_assert_int_ge((*solution)[0].n + (*solution)[3].n, 10);
+    ck_assert_int_ge((*solution)[1].n + (*solution)[4].n, 25);
+    ck_assert_int_ge((*solution)[2].n + (*solution)[5].n, 15);
+
+    ck_assert_int_eq(network_apply(network, tableau), 0);
+    ck_assert_int_eq(rational_compare(*(tableau->z), *(exact->z)), 0);
+    expected = simplex_get_solution(tableau);
+    for(i=0; i<11; ++i)
+    {
+        ck_assert_int_eq(rational_compare((*solution)[i], (*expected)[i]), 0);
+    }
+    free(*expected);
+    free(expected);
+    free(*solution);
+    free(solution);
+    network_free(network);
+    simplex_free_tableau(tableau);
+    simplex_free_tableau(exact);
+
+    tableau = create_single_tableau(1,1,-1); /* x <= -1 */
+    network = network_create(tableau);
+    ck_assert_int_eq(network_solve(network), SIMPLEX_INFEASIBLE);
+    network_free(network);
+    simplex_free_tableau(tableau);
+
+    tableau = create_single_tableau(1,-1,0); /* -x <= 0 */
+    network = network_create(tableau);
+    ck_assert_int_eq(network_solve(network), SIMPLEX_UNBOUNDED);
+    network_free(network);
+    simplex_free_tableau(tableau);
+
+    tableau = create_test_tableau();
+    ck_assert_ptr_eq(network_create(tableau), NULL);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+Suite *network_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Network");
+
+    tc_core = tcase_create("Core");
+
+    tcase_add_test(tc_core, test_network);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
@@ -0,0 +1,9 @@
+/**
+ * @brief Check unit tests for the network simplex.
+ *
+ * @file check_network.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+Suite *network_suite(void);
@@ -0,0 +1,49 @@
+/**
+ * @brief Check unit tests for strategy racing.
+ *
+ * This file contains the unit tests for the concurrent race of solve
+ * strategies.
+ *
+ * @file check_race.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <check.h>
+
+#include "race.h"
+#include "check_fixtures.h"
+
+START_TEST(test_simplex_race)
+{
+    struct Tableau *tableau;
+    int winner = -1;
+
+    tableau = create_test_tableau();
+    ck_assert_int_eq(simplex_race(tableau, NULL, 0, 0, &winner), SIMPLEX_OPTIMAL);
+    ck_assert_int_ge(winner, 0);
+    ck_assert_int_lt(winner, SIMPLEX_RACE_STRATEGIES);
+    ck_assert_int_eq((tableau->z)->n, -49000);
+    ck_assert_int_eq(tableau->pricing, SIMPLEX_PRICING_BLAND);
+    simplex_free_tableau(tableau);
+
+    tableau = create_single_tableau(1,1,-1);
+    ck_assert_int_eq(simplex_race(tableau, simplex_race_strategies + 1, 2, 1, NULL), SIMPLEX_INFEASIBLE);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+Suite *race_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Race");
+
+    tc_core = tcase_create("Core");
+
+    tcase_add_test(tc_core, test_simplex_race);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
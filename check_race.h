@@ -0,0 +1,9 @@
+/**
+ * @brief Check unit tests for strategy racing.
+ *
+ * @file check_race.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+Suite *race_suite(void);
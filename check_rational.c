@@ -9,9 +9,11 @@
  */
 
 #include <stdlib.h>
+#include <limits.h>
 #include <check.h>
 
 #include "rational.h"
+#include "stats.h"
 
 START_TEST(test_rational_create)
 {
@@ -101,6 +103,10 @@ START_TEST(test_rational_divide)
     ck_assert_int_eq(t->n, 1);
     ck_assert_int_eq(t->d, 1);
 
+    s->n = 0; /* Division by zero is reported, not executed. */
+    ck_assert_ptr_eq(rational_divide(r, s), NULL);
+    ck_assert_int_eq(rational_quotient(*r, *s).d, 0);
+
     free(r);
     free(s);
     free(t);
@@ -175,6 +181,134 @@ START_TEST(test_rational_is_a_smaller_than_b)
 }
 END_TEST
 
+START_TEST(test_rational_format)
+{
+    char buffer[BUFFER];
+    struct Rational r;
+
+    r.n = -2147483647 - 1;
+    r.d = 3;
+    ck_assert_int_eq(rational_format(buffer, BUFFER, r), 13);
+    ck_assert_str_eq(buffer, "-2147483648/3");
+
+    r.n = 1205;
+    r.d = 1;
+    ck_assert_int_eq(rational_format(buffer, BUFFER, r), 4);
+    ck_assert_str_eq(buffer, "1205");
+
+    r.n = 0;
+    ck_assert_int_eq(rational_format(buffer, BUFFER, r), 1);
+    ck_assert_str_eq(buffer, "0");
+
+    ck_assert_int_eq(rational_format(buffer, 4, r), 1);
+    r.n = 1205;
+    ck_assert_int_eq(rational_format(buffer, 4, r), 0);
+}
+END_TEST
+
+START_TEST(test_rational_parse)
+{
+    struct Rational r;
+
+    ck_assert_int_eq(rational_parse("-12/18 ", 7, &r), 6);
+    ck_assert_int_eq(r.n, -2);
+    ck_assert_int_eq(r.d, 3);
+
+    ck_assert_int_eq(rational_parse("0.125", 5, &r), 5);
+    ck_assert_int_eq(r.n, 1);
+    ck_assert_int_eq(r.d, 8);
+
+    ck_assert_int_eq(rational_parse("1.50000000000000000000000", 25, &r), 25);
+    ck_assert_int_eq(r.n, 3);
+    ck_assert_int_eq(r.d, 2);
+
+    ck_assert_int_eq(rational_parse("+25e-2x", 7, &r), 6);
+    ck_assert_int_eq(r.n, 1);
+    ck_assert_int_eq(r.d, 4);
+
+    ck_assert_int_eq(rational_parse("170", 2, &r), 2);
+    ck_assert_int_eq(r.n, 17);
+    ck_assert_int_eq(r.d, 1);
+
+    ck_assert_int_eq(rational_parse("1/0", 3, &r), 0);
+    ck_assert_int_eq(rational_parse("-", 1, &r), 0);
+    ck_assert_int_eq(rational_parse("1e12", 4, &r), 0);
+}
+END_TEST
+
+START_TEST(test_rational_wide_intermediates)
+{
+    struct Rational *r, *s, *t;
+
+    r = rational_get(2000000000, 3); /* Numerator product 6e9 and denominator product 6e9 do not fit into an int. */
+    s = rational_get(3, 2000000000);
+
+    t = rational_multiply(r, s);
+    ck_assert_int_eq(t->n, 1);
+    ck_assert_int_eq(t->d, 1);
+    free(t);
+
+    t = rational_subtract(r, r);
+    ck_assert_int_eq(t->n, 0);
+    ck_assert_int_eq(t->d, 1);
+    free(t);
+
+    t = rational_divide(r, r);
+    ck_assert_int_eq(t->n, 1);
+    ck_assert_int_eq(t->d, 1);
+    free(t);
+
+    ck_assert_int_eq(rational_is_a_smaller_than_b(s, r), 1); /* Cross products compared in 64 bit. */
+    ck_assert_int_eq(rational_is_a_smaller_than_b(r, s), 0);
+
+    free(r);
+    free(s);
+}
+END_TEST
+
+START_TEST(test_rational_overflow)
+{
+    struct Rational max = {INT_MAX, 1}, three = {3, 1}, a = {1, INT_MAX}, b = {1, 2147483629}, r;
+    struct SimplexStats stats, *previous;
+
+    stats_reset(&stats);
+    previous = stats_bind(&stats);
+    rational_clear_overflow();
+
+    r = rational_product(max, b); /* Fits after normalization, exact. */
+    ck_assert_int_eq(r.n, INT_MAX);
+    ck_assert_int_eq(r.d, 2147483629);
+    ck_assert_int_eq(rational_overflow(), 0);
+
+    r = rational_product(max, three); /* Saturates. */
+    ck_assert_int_eq(r.n, INT_MAX);
+    ck_assert_int_eq(r.d, 1);
+    three.n = -3;
+    r = rational_product(max, three);
+    ck_assert_int_eq(r.n, -INT_MAX);
+    ck_assert_int_eq(r.d, 1);
+
+    r = rational_sum(a, b); /* Closest fraction, 1/1073741819 < a+b < 1/1073741818 */
+    ck_assert_int_eq(r.n, 1);
+    ck_assert_int_eq(r.d, 1073741819);
+
+    r = rational_product(a, a); /* Closer to 0 than to 1/INT_MAX. */
+    ck_assert_int_eq(r.n, 0);
+    ck_assert_int_eq(r.d, 1);
+
+    ck_assert_int_eq(rational_overflow(), 1); /* Sticky until cleared. */
+    r = rational_product(max, b);
+    ck_assert_int_eq(rational_overflow(), 1);
+    rational_clear_overflow();
+    ck_assert_int_eq(rational_overflow(), 0);
+
+    stats_bind(previous);
+#ifndef SIMPLEX_NO_STATS
+    ck_assert_int_eq(stats.overflowRoundings, 4);
+#endif
+}
+END_TEST
+
 Suite *rational_suite(void)
 {
     Suite *s;
@@ -194,6 +328,10 @@ Suite *rational_suite(void)
     tcase_add_test(tc_core, test_rational_subtract);
     tcase_add_test(tc_core, test_rational_invert_sign);
     tcase_add_test(tc_core, test_rational_is_a_smaller_than_b);
+    tcase_add_test(tc_core, test_rational_format);
+    tcase_add_test(tc_core, test_rational_parse);
+    tcase_add_test(tc_core, test_rational_wide_intermediates);
+    tcase_add_test(tc_core, test_rational_overflow);
 
 
     suite_add_tcase(s, tc_core);
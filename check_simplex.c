@@ -9,9 +9,596 @@
  */
 
 #include <stdlib.h>
+#include <limits.h>
+#include <pthread.h>
 #include <check.h>
 
 #include "simplex.h"
+#include "sensitivity.h"
+#include "parametric.h"
+#include "check_fixtures.h"
+
+START_TEST(test_simplex_iterate)
+{
+    struct Tableau *tableau;
+    struct SimplexContext *context;
+    struct Rational **solution;
+
+    tableau = create_test_tableau();
+    context = simplex_context_create(tableau);
+
+    ck_assert_int_eq(simplex_iterate(context, 0), SIMPLEX_OPTIMAL);
+    ck_assert_int_eq(simplex_iterate(context, 0), SIMPLEX_OPTIMAL);
+
+    solution = simplex_get_solution(tableau);
+    ck_assert_int_eq((*solution)[0].n, 130);
+    ck_assert_int_eq((*solution)[1].n, 20);
+    ck_assert_int_eq((tableau->z)->n, -49000);
+#ifndef SIMPLEX_NO_STATS
+    ck_assert_int_eq(context->stats.pivots[0], 0); /* Crash basis is valid, phase 1 is skipped. */
+    ck_assert_int_eq(context->stats.pivots[1], 1);
+    ck_assert_int_eq(context->stats.pivots[1] + context->stats.pivots[2], context->iterations);
+    ck_assert_int_eq(context->stats.rationalOperations > 0, 1);
+#endif
+
+    free(*solution);
+    free(solution);
+    simplex_context_free(context);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+START_TEST(test_simplex_iterate_resume)
+{
+    struct Tableau *tableau;
+    struct SimplexContext *context;
+    int calls = 0;
+
+    tableau = create_test_tableau();
+    context = simplex_context_create(tableau);
+
+    while(simplex_iterate(context, 1) == SIMPLEX_LIMIT_REACHED)
+    {
+        ++calls;
+    }
+
+    ck_assert_int_eq(context->status, SIMPLEX_OPTIMAL);
+    ck_assert_int_eq(calls + 1, context->iterations);
+    ck_assert_int_eq((tableau->z)->n, -49000);
+
+    simplex_context_free(context);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+START_TEST(test_simplex_iterate_limits)
+{
+    struct Tableau *tableau;
+    struct SimplexContext *context;
+
+    tableau = create_test_tableau();
+    context = simplex_context_create(tableau);
+    context->maxIterations = 2;
+
+    ck_assert_int_eq(simplex_iterate(context, 0), SIMPLEX_LIMIT_REACHED);
+    ck_assert_int_eq(context->iterations, 2);
+
+    context->maxIterations = 0;
+    simplex_cancel(context);
+    ck_assert_int_eq(simplex_iterate(context, 0), SIMPLEX_CANCELLED);
+    ck_assert_int_eq(context->iterations, 2);
+
+    simplex_context_free(context);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+/**
+ * @brief Log sink counting the messages per level.
+ */
+static void count_sink(void *data, enum SimplexLogLevel level, const char *message, size_t length)
+{
+    ((int *)data)[level] += (length > 0) ? 1 : 0;
+    (void)message;
+}
+
+START_TEST(test_simplex_iterate_log)
+{
+    struct Tableau *tableau;
+    struct SimplexContext *context;
+    int messages[4] = {0, 0, 0, 0};
+
+    tableau = create_test_tableau();
+    context = simplex_context_create(tableau);
+    simplex_log_init(&(context->log), SIMPLEX_LOG_PIVOT, count_sink, messages);
+
+    ck_assert_int_eq(simplex_iterate(context, 0), SIMPLEX_OPTIMAL);
+    ck_assert_int_eq(messages[SIMPLEX_LOG_SUMMARY], 3);
+    ck_assert_int_eq(messages[SIMPLEX_LOG_PIVOT], context->iterations);
+    ck_assert_int_eq(messages[SIMPLEX_LOG_TABLEAU], 0);
+
+    simplex_context_free(context);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+START_TEST(test_simplex_crash)
+{
+    struct Tableau *tableau;
+    struct Rational **solution;
+    int i, a[3] = {-1, -1, 1}, b[3] = {-1, -2, 3};
+
+    tableau = simplex_create_tableau(3,4); /* Maximize x s.t.: x >= 1, x >= 2, x <= 3 */
+    (tableau->c[0])->n = 1;
+    tableau->nbvs[0] = 0;
+    for(i=0; i<3; ++i)
+    {
+        (tableau->A[i][0])->n = a[i];
+        (tableau->b[i])->n = b[i];
+        tableau->bvs[i] = i + 1;
+    }
+
+    ck_assert_int_eq(simplex_crash(tableau), 1); /* x enters for x >= 1, x >= 2 needs phase 1. */
+    ck_assert_int_eq(tableau->cols, 2);
+    ck_assert_int_eq(tableau->bvs[0], 0);
+    ck_assert_int_eq(tableau->bvs[1], 4);
+    for(i=0; i<3; ++i)
+    {
+        ck_assert_int_ge((tableau->b[i])->n, 0);
+    }
+
+    ck_assert_int_eq(simplex_solve(tableau), SIMPLEX_OPTIMAL);
+    ck_assert_int_eq(tableau->cols, 1);
+    solution = simplex_get_solution(tableau);
+    ck_assert_int_eq((*solution)[0].n, 3);
+
+    free(*solution);
+    free(solution);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+START_TEST(test_simplex_dual)
+{
+    struct Tableau *primal, *dual;
+    struct SimplexContext *context;
+    struct Rational **expected, **solution;
+    int i;
+
+    primal = create_tall_tableau();
+    context = simplex_context_create(primal);
+    context->form = SIMPLEX_FORM_PRIMAL;
+    ck_assert_int_eq(simplex_iterate(context, 0), SIMPLEX_OPTIMAL);
+    simplex_context_free(context);
+
+    dual = create_tall_tableau();
+    context = simplex_context_create(dual);
+    ck_assert_int_eq(simplex_iterate(context, 0), SIMPLEX_OPTIMAL);
+    ck_assert_int_eq(context->form, SIMPLEX_FORM_DUAL);
+    ck_assert_ptr_eq(context->dual, NULL);
+    simplex_context_free(context);
+
+    expected = simplex_get_solution(primal);
+    solution = simplex_get_solution(dual);
+    ck_assert_int_eq((*solution)[0].n, 3);
+    ck_assert_int_eq((*solution)[1].n, 5);
+    for(i=0; i<12; ++i)
+    {
+        ck_assert_int_eq(rational_compare((*solution)[i], (*expected)[i]), 0);
+    }
+    ck_assert_int_eq((dual->z)->n, -21);
+    ck_assert_int_eq((primal->z)->n, -21);
+
+    free(*expected);
+    free(expected);
+    free(*solution);
+    free(solution);
+    simplex_free_tableau(primal);
+    simplex_free_tableau(dual);
+}
+END_TEST
+
+START_TEST(test_simplex_dual_status)
+{
+    struct Tableau *tableau;
+    struct SimplexContext *context;
+
+    tableau = create_single_tableau(1,1,-1); /* Unbounded dual problem. */
+    context = simplex_context_create(tableau);
+    context->form = SIMPLEX_FORM_DUAL;
+    ck_assert_int_eq(simplex_iterate(context, 0), SIMPLEX_INFEASIBLE);
+    simplex_context_free(context);
+    simplex_free_tableau(tableau);
+
+    tableau = create_single_tableau(1,-1,1); /* Infeasible dual problem, primal problem is solved. */
+    context = simplex_context_create(tableau);
+    context->form = SIMPLEX_FORM_DUAL;
+    ck_assert_int_eq(simplex_iterate(context, 0), SIMPLEX_UNBOUNDED);
+    ck_assert_int_eq(context->form, SIMPLEX_FORM_PRIMAL);
+    simplex_context_free(context);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+START_TEST(test_simplex_sensitivity)
+{
+    struct Tableau *tableau;
+    struct SimplexSensitivity *sensitivity;
+    int i;
+    int duals[4] = {200, 100, 0, 0};
+    int limits[4][3] = {{-19, 40, 3}, {-40, 19, 3}, {-120, 0, 1}, {-19, 0, 1}};
+    int costs[2][3] = {{-50, 200, 3}, {-200, 100, 3}};
+
+    tableau = create_test_tableau();
+    ck_assert_int_eq(simplex_solve(tableau), SIMPLEX_OPTIMAL);
+    sensitivity = simplex_sensitivity(tableau);
+
+    ck_assert_int_eq(sensitivity->rows, 4);
+    ck_assert_int_eq(sensitivity->cols, 2);
+    for(i=0; i<4; ++i)
+    {
+        ck_assert_int_eq(sensitivity->duals[i].n, duals[i]);
+        ck_assert_int_eq(sensitivity->limits[i].bounded, limits[i][2]);
+        ck_assert_int_eq(sensitivity->limits[i].lower.n, limits[i][0]);
+        ck_assert_int_eq(sensitivity->limits[i].upper.n, limits[i][1]);
+    }
+    for(i=0; i<2; ++i)
+    {
+        ck_assert_int_eq(sensitivity->reducedCosts[i].n, 0);
+        ck_assert_int_eq(sensitivity->costs[i].bounded, costs[i][2]);
+        ck_assert_int_eq(sensitivity->costs[i].lower.n, costs[i][0]);
+        ck_assert_int_eq(sensitivity->costs[i].upper.n, costs[i][1]);
+    }
+
+    simplex_sensitivity_free(sensitivity);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+START_TEST(test_simplex_parametric)
+{
+    struct Tableau *tableau;
+    struct SimplexParametric *parametric;
+    struct Rational db[4] = {{1, 1}, {0, 1}, {0, 1}, {0, 1}}, dc[2] = {{1, 1}, {0, 1}}, maxT = {100, 1};
+
+    tableau = create_test_tableau(); /* b[0] = 170 + t: y grows until 3y <= 180 is reached at t = 40. */
+    simplex_solve(tableau);
+    parametric = simplex_parametric_rhs(tableau, db, NULL);
+    ck_assert_int_eq(parametric->pieces, 2);
+    ck_assert_int_eq(parametric->piece[0].value.n, 49000);
+    ck_assert_int_eq(parametric->piece[0].slope.n, 200);
+    ck_assert_int_eq(parametric->piece[1].start.n, 40);
+    ck_assert_int_eq(parametric->piece[1].value.n, 57000);
+    ck_assert_int_eq(parametric->piece[1].slope.n, 0);
+    ck_assert_int_eq(parametric->bounded, 0);
+    ck_assert_int_eq(parametric->status, SIMPLEX_OPTIMAL);
+    simplex_parametric_free(parametric);
+    simplex_free_tableau(tableau);
+
+    tableau = create_test_tableau(); /* b[1] = 150 - t: infeasible after x + y <= 1. */
+    simplex_solve(tableau);
+    db[0].n = 0;
+    db[1].n = -1;
+    parametric = simplex_parametric_rhs(tableau, db, NULL);
+    ck_assert_int_eq(parametric->bounded, 1);
+    ck_assert_int_eq(parametric->end.n, 149);
+    ck_assert_int_eq(parametric->status, SIMPLEX_INFEASIBLE);
+    simplex_parametric_free(parametric);
+    simplex_free_tableau(tableau);
+
+    tableau = create_test_tableau(); /* c[0] = 300 + t: x grows to 149 at t = 200. */
+    simplex_solve(tableau);
+    parametric = simplex_parametric_cost(tableau, dc, &maxT);
+    ck_assert_int_eq(parametric->pieces, 1);
+    ck_assert_int_eq(parametric->piece[0].slope.n, 130);
+    ck_assert_int_eq(parametric->bounded, 1);
+    ck_assert_int_eq(parametric->end.n, 100);
+    ck_assert_int_eq((tableau->z)->n, -62000);
+    simplex_parametric_free(parametric);
+    simplex_free_tableau(tableau);
+
+    tableau = create_test_tableau();
+    simplex_solve(tableau);
+    parametric = simplex_parametric_cost(tableau, dc, NULL);
+    ck_assert_int_eq(parametric->pieces, 2);
+    ck_assert_int_eq(parametric->piece[1].start.n, 200);
+    ck_assert_int_eq(parametric->piece[1].value.n, 75000);
+    ck_assert_int_eq(parametric->piece[1].slope.n, 149);
+    ck_assert_int_eq(parametric->bounded, 0);
+    simplex_parametric_free(parametric);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+START_TEST(test_simplex_solution_view)
+{
+    struct Tableau *tableau;
+    struct SimplexStats stats, *previous;
+    struct Rational value, values[6], duals[6];
+    int i, j, shadow[4] = {200, 100, 0, 0};
+
+    tableau = create_test_tableau();
+    ck_assert_int_eq(simplex_solve(tableau), SIMPLEX_OPTIMAL);
+    simplex_solution_values(tableau, values);
+    simplex_dual_values(tableau, duals);
+    ck_assert_int_eq(values[0].n, 130);
+    ck_assert_int_eq(values[1].n, 20);
+    for(i=0; i<4; ++i)
+    {
+        ck_assert_int_eq(duals[2 + i].n, shadow[i]);
+    }
+    for(i=0; i<6; ++i)
+    {
+        ck_assert_int_eq(simplex_solution_value(tableau, i, &value), 0);
+        ck_assert_int_eq(rational_compare(value, values[i]), 0);
+        ck_assert_int_eq(simplex_dual_value(tableau, i, &value), 0);
+        ck_assert_int_eq(rational_compare(value, duals[i]), 0);
+    }
+    ck_assert_int_eq(simplex_solution_value(tableau, 6, &value), -1);
+
+    stats_reset(&stats); /* Pivots keep the index up to date, lookups do not allocate. */
+    previous = stats_bind(&stats);
+    j = 0;
+    while((tableau->A[0][j])->n == 0)
+    {
+        ++j;
+    }
+    ck_assert_int_eq(simplex_pivot(tableau, 0, j), 0);
+    simplex_solution_values(tableau, values);
+    simplex_dual_values(tableau, duals);
+    for(i=0; i<6; ++i)
+    {
+        simplex_solution_value(tableau, i, &value);
+        ck_assert_int_eq(rational_compare(value, values[i]), 0);
+        simplex_dual_value(tableau, i, &value);
+        ck_assert_int_eq(rational_compare(value, duals[i]), 0);
+    }
+    stats_bind(previous);
+#ifndef SIMPLEX_NO_STATS
+    ck_assert_int_eq(stats.allocations, 0);
+#endif
+
+    i = tableau->bvs[0]; /* Changes of the basis outside of pivots are detected. */
+    tableau->bvs[0] = tableau->nbvs[0];
+    tableau->nbvs[0] = i;
+    simplex_solution_value(tableau, tableau->bvs[0], &value);
+    ck_assert_int_eq(rational_compare(value, *(tableau->b[0])), 0);
+    simplex_solution_value(tableau, i, &value);
+    ck_assert_int_eq(value.n, 0);
+
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+START_TEST(test_simplex_dantzig)
+{
+    struct Tableau *tableau;
+    struct Rational **solution;
+
+    tableau = create_tall_tableau();
+    tableau->pricing = SIMPLEX_PRICING_DANTZIG;
+    ck_assert_int_eq(simplex_solve(tableau), SIMPLEX_OPTIMAL);
+    ck_assert_int_eq((tableau->z)->n, -21);
+
+    solution = simplex_get_solution(tableau);
+    ck_assert_int_eq((*solution)[0].n, 3);
+    ck_assert_int_eq((*solution)[1].n, 5);
+
+    free(*solution);
+    free(solution);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+/**
+ * @brief Create tableau with a dense problem.
+ *
+ * Maximize sum c_j x_j s.t.: sum_j a_ij x_j <= b_i with pseudo random
+ * coefficients 1 <= a_ij <= 17, whose pivots create fractions.
+ *
+ * @param n
+ *    number of variables and inequalities
+ * @return tableau for problem
+ */
+static struct Tableau *create_dense_tableau(int n)
+{
+    struct Tableau *tableau;
+    int i, j;
+
+    tableau = simplex_create_tableau(n, 2*n);
+    for(i=0; i<n; ++i)
+    {
+        (tableau->c[i])->n = 1 + (i * 5) % 9;
+        tableau->nbvs[i] = i;
+        tableau->bvs[i] = n + i;
+        (tableau->b[i])->n = 50 + (i * 31) % 23;
+        for(j=0; j<n; ++j)
+        {
+            (tableau->A[i][j])->n = 1 + (i * 7 + j * 13) % 17;
+        }
+    }
+
+    return tableau;
+}
+
+START_TEST(test_simplex_reduce_lines)
+{
+    struct Tableau *tableau, *exact;
+    struct SimplexContext *context, *plain;
+    struct Rational values[24], expected[24];
+    int i, j;
+
+    tableau = create_dense_tableau(12);
+    exact = create_dense_tableau(12);
+    context = simplex_context_create(tableau);
+    context->form = SIMPLEX_FORM_PRIMAL;
+    context->reduceInterval = 1;
+    plain = simplex_context_create(exact);
+    plain->form = SIMPLEX_FORM_PRIMAL;
+    plain->reduceThreshold = 0;
+
+    ck_assert_int_eq(simplex_iterate(context, 3), SIMPLEX_LIMIT_REACHED); /* Lines are restored between calls. */
+    ck_assert_ptr_eq(tableau->scale, NULL);
+    ck_assert_int_eq(simplex_iterate(context, 0), SIMPLEX_OPTIMAL);
+    ck_assert_int_eq(simplex_iterate(plain, 0), SIMPLEX_OPTIMAL);
+    ck_assert_ptr_eq(tableau->scale, NULL);
+    ck_assert_int_eq(context->iterations, plain->iterations);
+#ifndef SIMPLEX_NO_STATS
+    ck_assert_int_gt(context->stats.lineReductions, 0);
+    ck_assert_int_eq(plain->stats.lineReductions, 0);
+#endif
+
+    ck_assert_int_eq(rational_compare(*(tableau->z), *(exact->z)), 0);
+    simplex_solution_values(tableau, values);
+    simplex_solution_values(exact, expected);
+    for(i=0; i<24; ++i)
+    {
+        ck_assert_int_eq(rational_compare(values[i], expected[i]), 0);
+    }
+    for(i=0; i<12; ++i)
+    {
+        for(j=0; j<12; ++j)
+        {
+            ck_assert_int_eq(rational_compare(*(tableau->A[i][j]), *(exact->A[i][j])), 0);
+        }
+    }
+
+    simplex_context_free(plain);
+    simplex_context_free(context);
+    simplex_free_tableau(exact);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+/**
+ * @brief Solve job of test_simplex_threads.
+ */
+struct ThreadsJob
+{
+    struct Tableau *clone; /**< Clone to solve, shares lines with the clones of the other jobs. */
+    int failed; /**< Number of wrong results. */
+};
+
+/**
+ * @brief Solve independent problems.
+ *
+ * This function solves its clone and repeatedly creates and solves own tableaus.
+ *
+ * @param data
+ *    job of thread
+ * @return NULL
+ */
+static void *solve_repeatedly(void *data)
+{
+    struct ThreadsJob *job = (struct ThreadsJob *)data;
+    struct Tableau *tableau, *exact;
+    struct SimplexContext *context;
+    int i;
+
+    job->failed += (simplex_find_best_solution(job->clone) != 0 || (job->clone->z)->n != -49000) ? 1 : 0;
+
+    for(i=0; i<20; ++i)
+    {
+        tableau = create_test_tableau();
+        context = simplex_context_create(tableau);
+        context->form = (i % 2 == 0) ? SIMPLEX_FORM_PRIMAL : SIMPLEX_FORM_DUAL;
+        job->failed += (simplex_iterate(context, 0) != SIMPLEX_OPTIMAL || (tableau->z)->n != -49000) ? 1 : 0;
+        simplex_context_free(context);
+        simplex_free_tableau(tableau);
+
+        tableau = create_chain_tableau(20);
+        exact = simplex_clone_tableau(tableau);
+        job->failed += (simplex_solve(tableau) != SIMPLEX_OPTIMAL || simplex_solve(exact) != SIMPLEX_OPTIMAL
+                        || rational_compare(*(tableau->z), *(exact->z)) != 0) ? 1 : 0;
+        simplex_free_tableau(exact);
+        simplex_free_tableau(tableau);
+    }
+
+    return NULL;
+}
+
+START_TEST(test_simplex_threads)
+{
+    struct Tableau *tableau, *phase1;
+    struct ThreadsJob jobs[8];
+    pthread_t threads[8];
+    int i;
+
+    tableau = create_test_tableau();
+    phase1 = simplex_find_start_corner(tableau);
+    ck_assert_int_eq(prepare_with_start_corner(phase1, tableau), 0);
+    simplex_free_tableau(phase1);
+
+    for(i=0; i<8; ++i)
+    {
+        jobs[i].clone = simplex_clone_tableau(tableau);
+        jobs[i].failed = 0;
+    }
+    simplex_free_tableau(tableau); /* The clones keep the lines alive. */
+    for(i=0; i<8; ++i)
+    {
+        ck_assert_int_eq(pthread_create(&(threads[i]), NULL, solve_repeatedly, &(jobs[i])), 0);
+    }
+    for(i=0; i<8; ++i)
+    {
+        pthread_join(threads[i], NULL);
+        ck_assert_int_eq(jobs[i].failed, 0);
+        simplex_free_tableau(jobs[i].clone);
+    }
+}
+END_TEST
+
+START_TEST(test_simplex_iterate_unbounded)
+{
+    struct Tableau *tableau;
+    struct SimplexContext *context;
+
+    tableau = create_single_tableau(1, -1, 1);
+    context = simplex_context_create(tableau);
+
+    ck_assert_int_eq(simplex_iterate(context, 0), SIMPLEX_UNBOUNDED);
+
+    simplex_context_free(context);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+START_TEST(test_simplex_iterate_infeasible)
+{
+    struct Tableau *tableau;
+    struct SimplexContext *context;
+
+    tableau = create_single_tableau(1, 1, -1);
+    context = simplex_context_create(tableau);
+
+    ck_assert_int_eq(simplex_iterate(context, 0), SIMPLEX_INFEASIBLE);
+
+    simplex_context_free(context);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+START_TEST(test_simplex_iterate_overflow)
+{
+    struct Tableau *tableau;
+    struct SimplexContext *context;
+
+    tableau = create_single_tableau(INT_MAX, 1, INT_MAX); /* Target function value INT_MAX^2. */
+    context = simplex_context_create(tableau);
+
+    ck_assert_int_eq(simplex_iterate(context, 0), SIMPLEX_OVERFLOW);
+    ck_assert_int_eq(context->phase, 0);
+    ck_assert_int_eq(simplex_iterate(context, 0), SIMPLEX_OVERFLOW);
+
+    simplex_context_free(context);
+    simplex_free_tableau(tableau);
+
+    tableau = create_single_tableau(1, 1, 1); /* Flag of the previous solve is cleared. */
+    ck_assert_int_eq(simplex_solve(tableau), SIMPLEX_OPTIMAL);
+    ck_assert_int_eq(rational_overflow(), 0);
+    simplex_free_tableau(tableau);
+}
+END_TEST
 
 Suite *simplex_suite(void)
 {
@@ -22,7 +609,22 @@ Suite *simplex_suite(void)
 
     tc_core = tcase_create("Core");
 
-    /*tcase_add_test(tc_core, test_);*/
+    tcase_add_test(tc_core, test_simplex_iterate);
+    tcase_add_test(tc_core, test_simplex_iterate_resume);
+    tcase_add_test(tc_core, test_simplex_iterate_limits);
+    tcase_add_test(tc_core, test_simplex_iterate_log);
+    tcase_add_test(tc_core, test_simplex_crash);
+    tcase_add_test(tc_core, test_simplex_dual);
+    tcase_add_test(tc_core, test_simplex_dual_status);
+    tcase_add_test(tc_core, test_simplex_sensitivity);
+    tcase_add_test(tc_core, test_simplex_parametric);
+    tcase_add_test(tc_core, test_simplex_solution_view);
+    tcase_add_test(tc_core, test_simplex_dantzig);
+    tcase_add_test(tc_core, test_simplex_reduce_lines);
+    tcase_add_test(tc_core, test_simplex_threads);
+    tcase_add_test(tc_core, test_simplex_iterate_unbounded);
+    tcase_add_test(tc_core, test_simplex_iterate_infeasible);
+    tcase_add_test(tc_core, test_simplex_iterate_overflow);
     suite_add_tcase(s, tc_core);
 
     return s;
@@ -0,0 +1,99 @@
+/**
+ * @brief Check unit tests for tableau snapshots.
+ *
+ * This file contains the unit tests for saving and loading of tableau
+ * snapshots.
+ *
+ * @file check_snapshot.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdio.h>
+#include <stddef.h>
+#include <unistd.h>
+#include <check.h>
+
+#include "snapshot.h"
+#include "check_fixtures.h"
+
+START_TEST(test_snapshot)
+{
+    struct Tableau *tableau, *phase1, *expected, *loaded;
+    char path[64];
+    FILE *file;
+    int32_t variable;
+    long cells;
+    int map, line;
+
+    snprintf(path, sizeof(path), "/tmp/check_snapshot_%d.tab", (int)getpid());
+    tableau = create_test_tableau();
+    phase1 = simplex_find_start_corner(tableau);
+    prepare_with_start_corner(phase1, tableau);
+    simplex_free_tableau(phase1);
+    tableau->pricing = SIMPLEX_PRICING_DANTZIG;
+    ck_assert_int_eq(snapshot_save(tableau, path), 0);
+
+    expected = simplex_copy_tableau(tableau);
+    simplex_find_best_solution(expected);
+    for(map=0; map<2; ++map)
+    {
+        loaded = snapshot_load(path, map);
+        ck_assert_ptr_ne(loaded, NULL);
+        check_same_tableau(tableau, loaded);
+        ck_assert_int_eq(loaded->artificials, tableau->artificials);
+        ck_assert_int_eq(loaded->pricing, SIMPLEX_PRICING_DANTZIG);
+        simplex_find_best_solution(loaded); /* Pivots replace cells of the snapshot. */
+        check_same_tableau(expected, loaded);
+        simplex_free_tableau(loaded);
+    }
+
+    variable = tableau->nbvs[0]; /* First basis variable is also none basis variable. */
+    file = fopen(path, "r+b");
+    fseek(file, (long)sizeof(struct SnapshotHeader), SEEK_SET);
+    fwrite(&variable, sizeof(variable), 1, file);
+    fclose(file);
+    ck_assert_ptr_eq(snapshot_load(path, 0), NULL);
+
+    line = tableau->pivotLine;
+    tableau->pivotLine = tableau->rows;
+    ck_assert_int_eq(snapshot_save(tableau, path), 0);
+    tableau->pivotLine = line;
+    ck_assert_ptr_eq(snapshot_load(path, 1), NULL);
+
+    ck_assert_int_eq(snapshot_save(tableau, path), 0);
+    variable = 0; /* Denominator of z. */
+    file = fopen(path, "r+b");
+    cells = (long)((sizeof(struct SnapshotHeader) + (size_t)(tableau->rows + tableau->cols) * sizeof(int32_t) + 7) & ~(size_t)7);
+    fseek(file, cells + (long)offsetof(struct Rational, d), SEEK_SET);
+    fwrite(&variable, sizeof(variable), 1, file);
+    fclose(file);
+    ck_assert_ptr_eq(snapshot_load(path, 0), NULL);
+    ck_assert_ptr_eq(snapshot_load(path, 1), NULL);
+
+    file = fopen(path, "r+b");
+    fputc('X', file);
+    fclose(file);
+    ck_assert_ptr_eq(snapshot_load(path, 1), NULL);
+    unlink(path);
+    ck_assert_ptr_eq(snapshot_load(path, 0), NULL);
+
+    simplex_free_tableau(expected);
+    simplex_free_tableau(tableau);
+}
+END_TEST
+
+Suite *snapshot_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Snapshot");
+
+    tc_core = tcase_create("Core");
+
+    tcase_add_test(tc_core, test_snapshot);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
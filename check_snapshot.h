@@ -0,0 +1,9 @@
+/**
+ * @brief Check unit tests for tableau snapshots.
+ *
+ * @file check_snapshot.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+Suite *snapshot_suite(void);
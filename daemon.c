@@ -0,0 +1,810 @@
+/**
+ * @brief Implementation of daemon.
+ *
+ * This file implements the solver service. Each connection has a reader
+ * thread, which parses the request frames and queues them to the thread pool.
+ * The workers borrow a workspace for the response, parse, compile and solve
+ * the problem and send the response frame under the write lock of the
+ * connection.
+ *
+ * @file daemon.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#define _POSIX_C_SOURCE 200112L /**< lstat, S_ISSOCK and nanosleep also with -std=c99. */
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include "daemon.h"
+#include "lp_model.h"
+#include "lp_reader.h"
+#include "stats.h"
+
+/**
+ * @brief Queued solve request.
+ */
+struct DaemonRequest
+{
+    struct Daemon *daemon; /**< Daemon of the request. */
+    struct DaemonConnection *connection; /**< Connection which gets the response. */
+    unsigned int id; /**< Id of the request. */
+    double deadline; /**< Time of stats_now after which the request is answered with timeout, 0 for none. */
+    char *problem; /**< Problem in MPS or LP format. */
+    size_t length; /**< Number of characters of problem. */
+};
+
+/**
+ * @brief Read requests of a connection.
+ *
+ * This function reads request frames until the client closes the connection or
+ * the daemon stops. Afterwards it waits for the pending requests of the
+ * connection, closes the socket and frees the connection.
+ *
+ * @param data
+ *    connection
+ * @return NULL
+ */
+static void *daemon_reader(void *data);
+
+/**
+ * @brief Solve a request.
+ *
+ * This function is the task of the thread pool. It sends the response and
+ * frees the request.
+ *
+ * @param data
+ *    request
+ */
+static void daemon_solve(void *data);
+
+/**
+ * @brief Solve a request with a workspace.
+ *
+ * @param request
+ *    request to solve
+ * @param workspace
+ *    workspace for the response
+ */
+static void daemon_solve_with(struct DaemonRequest *request, struct DaemonWorkspace *workspace);
+
+/**
+ * @brief Append formatted text to the response of a workspace.
+ *
+ * If the response can not grow, the workspace is marked as truncated and
+ * workspace_send sends an error response instead.
+ *
+ * @param workspace
+ *    workspace with response
+ * @param format
+ *    printf format
+ */
+static void workspace_append(struct DaemonWorkspace *workspace, const char *format, ...);
+
+/**
+ * @brief Append a JSON string to the response of a workspace.
+ *
+ * @param workspace
+ *    workspace with response
+ * @param string
+ *    string to append quoted and escaped
+ */
+static void workspace_append_string(struct DaemonWorkspace *workspace, const char *string);
+
+/**
+ * @brief Start a response.
+ *
+ * @param workspace
+ *    workspace for the response
+ * @param id
+ *    id of the request
+ * @param status
+ *    status of the response
+ */
+static void workspace_begin(struct DaemonWorkspace *workspace, unsigned int id, const char *status);
+
+/**
+ * @brief Finish and send a response.
+ *
+ * @param workspace
+ *    workspace with the response
+ * @param connection
+ *    connection which gets the response
+ */
+static void workspace_send(struct DaemonWorkspace *workspace, struct DaemonConnection *connection);
+
+/**
+ * @brief Read exactly length bytes.
+ *
+ * @param fd
+ *    socket
+ * @param buffer
+ *    buffer for the bytes
+ * @param length
+ *    number of bytes
+ * @return 0 on success, -1 if the connection was closed or failed
+ */
+static int read_all(int fd, void *buffer, size_t length);
+
+/**
+ * @brief Read and drop exactly length bytes.
+ *
+ * @param fd
+ *    socket
+ * @param length
+ *    number of bytes
+ * @return 0 on success, -1 if the connection was closed or failed
+ */
+static int skip_all(int fd, size_t length);
+
+/**
+ * @brief Write exactly length bytes.
+ *
+ * @param fd
+ *    socket
+ * @param buffer
+ *    bytes to write
+ * @param length
+ *    number of bytes
+ * @return 0 on success, -1 if the connection was closed or failed
+ */
+static int write_all(int fd, const void *buffer, size_t length);
+
+/**
+ * @brief Fill the address of a socket path.
+ *
+ * @param address
+ *    address to fill
+ * @param path
+ *    path of the socket
+ * @return 0 on success, -1 if the path is too long
+ */
+static int socket_address(struct sockaddr_un *address, const char *path);
+
+struct Daemon *daemon_create(const char *path, int workers, int queue)
+{
+    struct Daemon *daemon;
+    struct sockaddr_un address;
+    struct stat info;
+    int i, fd;
+
+    if(socket_address(&address, path) != 0)
+    {
+        return NULL;
+    }
+    if(lstat(path, &info) == 0) /* Remove the socket of a previous daemon, but no other file. */
+    {
+        if(!S_ISSOCK(info.st_mode) || unlink(path) != 0)
+        {
+            return NULL;
+        }
+    }
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd < 0)
+    {
+        return NULL;
+    }
+    if(bind(fd, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(fd, SOMAXCONN) != 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    daemon = (struct Daemon *)malloc(sizeof(struct Daemon));
+    if(daemon == NULL)
+    {
+        close(fd);
+        unlink(path);
+        return NULL;
+    }
+    daemon->listener = fd;
+    atomic_init(&(daemon->stop), 0);
+    daemon->workers = (workers > 0) ? workers : thread_pool_cores();
+    daemon->queue = (queue > 0) ? queue : DAEMON_DEFAULT_QUEUE;
+    daemon->all = (struct DaemonWorkspace *)calloc((size_t)daemon->workers, sizeof(struct DaemonWorkspace));
+    if(daemon->all == NULL)
+    {
+        free(daemon);
+        close(fd);
+        unlink(path);
+        return NULL;
+    }
+    daemon->pool = thread_pool_create(daemon->workers);
+    if(daemon->pool == NULL)
+    {
+        free(daemon->all);
+        free(daemon);
+        close(fd);
+        unlink(path);
+        return NULL;
+    }
+    pthread_mutex_init(&(daemon->mutex), NULL);
+    pthread_cond_init(&(daemon->idle), NULL);
+    daemon->pending = 0;
+    daemon->connections = NULL;
+    daemon->served = 0;
+    daemon->rejected = 0;
+
+    daemon->workspaces = NULL;
+    for(i=0; i<daemon->workers; ++i)
+    {
+        daemon->all[i].next = daemon->workspaces;
+        daemon->workspaces = &(daemon->all[i]);
+    }
+
+    return daemon;
+}
+
+int daemon_run(struct Daemon *daemon)
+{
+    struct DaemonConnection *connection, **link;
+    struct timespec pause = {0, 100000000};
+    pthread_t reader;
+    int fd, i, failed = 0;
+
+    while(!atomic_load(&(daemon->stop)))
+    {
+        fd = accept(daemon->listener, NULL, NULL);
+        if(fd < 0)
+        {
+            if(atomic_load(&(daemon->stop)) || errno == EINTR || errno == ECONNABORTED)
+            {
+                continue; /* Shut down by daemon_stop, interrupted or client gone. */
+            }
+            if(errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM)
+            {
+                nanosleep(&pause, NULL); /* Wait until connections are closed instead of spinning. */
+                continue;
+            }
+            failed = 1;
+            atomic_store(&(daemon->stop), 1);
+            break;
+        }
+
+        connection = (struct DaemonConnection *)malloc(sizeof(struct DaemonConnection));
+        if(connection == NULL) /* Refuse the client, the other connections go on. */
+        {
+            close(fd);
+            continue;
+        }
+        connection->fd = fd;
+        connection->daemon = daemon;
+        connection->pending = 0;
+        pthread_mutex_init(&(connection->write), NULL);
+
+        pthread_mutex_lock(&(daemon->mutex));
+        connection->next = daemon->connections;
+        daemon->connections = connection;
+        pthread_mutex_unlock(&(daemon->mutex));
+
+        if(pthread_create(&reader, NULL, daemon_reader, connection) != 0) /* Refuse the client. */
+        {
+            pthread_mutex_lock(&(daemon->mutex));
+            for(link=&(daemon->connections); *link != connection; link=&((*link)->next))
+            {
+            }
+            *link = connection->next;
+            pthread_mutex_unlock(&(daemon->mutex));
+            close(fd);
+            pthread_mutex_destroy(&(connection->write));
+            free(connection);
+            continue;
+        }
+        pthread_detach(reader);
+    }
+
+    pthread_mutex_lock(&(daemon->mutex));
+    for(connection=daemon->connections; connection != NULL; connection=connection->next)
+    {
+        shutdown(connection->fd, SHUT_RD); /* Wake the readers, responses can still be sent. */
+    }
+    for(i=0; i<daemon->workers; ++i)
+    {
+        if(daemon->all[i].context != NULL)
+        {
+            simplex_cancel(daemon->all[i].context);
+        }
+    }
+    while(daemon->connections != NULL)
+    {
+        pthread_cond_wait(&(daemon->idle), &(daemon->mutex));
+    }
+    pthread_mutex_unlock(&(daemon->mutex));
+
+    return failed ? -1 : 0;
+}
+
+void daemon_stop(struct Daemon *daemon)
+{
+    atomic_store(&(daemon->stop), 1);
+    shutdown(daemon->listener, SHUT_RDWR); /* Let accept return. */
+}
+
+void daemon_free(struct Daemon *daemon, const char *path)
+{
+    int i;
+
+    thread_pool_free(daemon->pool);
+    close(daemon->listener);
+    if(path != NULL)
+    {
+        unlink(path);
+    }
+    for(i=0; i<daemon->workers; ++i)
+    {
+        free(daemon->all[i].response);
+        free(daemon->all[i].values);
+    }
+    free(daemon->all);
+    pthread_mutex_destroy(&(daemon->mutex));
+    pthread_cond_destroy(&(daemon->idle));
+    free(daemon);
+}
+
+int daemon_connect(const char *path)
+{
+    struct sockaddr_un address;
+    int fd;
+
+    if(socket_address(&address, path) != 0)
+    {
+        return -1;
+    }
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd >= 0 && connect(fd, (struct sockaddr *)&address, sizeof(address)) != 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+
+    return fd;
+}
+
+int daemon_send(int fd, unsigned int id, unsigned int deadline, const char *problem, size_t length)
+{
+    uint32_t header[3];
+
+    header[0] = htonl((uint32_t)length);
+    header[1] = htonl(id);
+    header[2] = htonl(deadline);
+    if(write_all(fd, header, sizeof(header)) != 0 || write_all(fd, problem, length) != 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+char *daemon_receive(int fd)
+{
+    uint32_t length;
+    char *response;
+
+    if(read_all(fd, &length, sizeof(length)) != 0)
+    {
+        return NULL;
+    }
+    length = ntohl(length);
+    response = (char *)malloc((size_t)length + 1);
+    if(response == NULL)
+    {
+        skip_all(fd, length);
+        return NULL;
+    }
+    if(read_all(fd, response, length) != 0)
+    {
+        free(response);
+        return NULL;
+    }
+    response[length] = '\0';
+
+    return response;
+}
+
+static void *daemon_reader(void *data)
+{
+    struct DaemonConnection *connection = (struct DaemonConnection *)data, **link;
+    struct Daemon *daemon = connection->daemon;
+    struct DaemonRequest *request;
+    struct DaemonWorkspace busy;
+    uint32_t header[3];
+    unsigned int deadline, id;
+    size_t length;
+
+    memset(&busy, 0, sizeof(busy));
+    while(read_all(connection->fd, header, sizeof(header)) == 0)
+    {
+        length = ntohl(header[0]);
+        id = ntohl(header[1]);
+        deadline = ntohl(header[2]);
+        if(length > DAEMON_MAX_REQUEST)
+        {
+            workspace_begin(&busy, id, "error");
+            workspace_append(&busy, ", \"message\": \"request too large\"");
+            workspace_send(&busy, connection);
+            break; /* The rest of the frame can not be skipped reliably. */
+        }
+
+        request = (struct DaemonRequest *)malloc(sizeof(struct DaemonRequest));
+        if(request != NULL)
+        {
+            request->problem = (char *)malloc(length + 1);
+            if(request->problem == NULL)
+            {
+                free(request);
+                request = NULL;
+            }
+        }
+        if(request == NULL) /* Drop the problem, only this request fails. */
+        {
+            if(skip_all(connection->fd, length) != 0)
+            {
+                break;
+            }
+            workspace_begin(&busy, id, "error");
+            workspace_append(&busy, ", \"message\": \"out of memory\"");
+            workspace_send(&busy, connection);
+            continue;
+        }
+        request->daemon = daemon;
+        request->connection = connection;
+        request->length = length;
+        request->id = id;
+        request->deadline = (deadline > 0) ? stats_now() + deadline / 1000.0 : 0.0;
+
+        if(read_all(connection->fd, request->problem, request->length) != 0)
+        {
+            free(request->problem);
+            free(request);
+            break;
+        }
+
+        pthread_mutex_lock(&(daemon->mutex));
+        if(daemon->pending >= daemon->queue || atomic_load(&(daemon->stop)))
+        {
+            ++(daemon->rejected);
+            pthread_mutex_unlock(&(daemon->mutex));
+            workspace_begin(&busy, request->id, atomic_load(&(daemon->stop)) ? "cancelled" : "busy");
+            workspace_send(&busy, connection);
+            free(request->problem);
+            free(request);
+            continue;
+        }
+        ++(daemon->pending);
+        ++(connection->pending);
+        pthread_mutex_unlock(&(daemon->mutex));
+
+        thread_pool_submit(daemon->pool, daemon_solve, request);
+    }
+    free(busy.response);
+
+    pthread_mutex_lock(&(daemon->mutex));
+    while(connection->pending > 0)
+    {
+        pthread_cond_wait(&(daemon->idle), &(daemon->mutex));
+    }
+    for(link=&(daemon->connections); *link != connection; link=&((*link)->next))
+    {
+    }
+    *link = connection->next;
+    pthread_cond_broadcast(&(daemon->idle));
+    pthread_mutex_unlock(&(daemon->mutex));
+
+    close(connection->fd);
+    pthread_mutex_destroy(&(connection->write));
+    free(connection);
+
+    return NULL;
+}
+
+static void daemon_solve(void *data)
+{
+    struct DaemonRequest *request = (struct DaemonRequest *)data;
+    struct Daemon *daemon = request->daemon;
+    struct DaemonWorkspace *workspace;
+
+    pthread_mutex_lock(&(daemon->mutex));
+    workspace = daemon->workspaces; /* At most one request per worker runs, so there is always a free workspace. */
+    daemon->workspaces = workspace->next;
+    pthread_mutex_unlock(&(daemon->mutex));
+
+    daemon_solve_with(request, workspace);
+    workspace_send(workspace, request->connection);
+
+    pthread_mutex_lock(&(daemon->mutex));
+    workspace->next = daemon->workspaces;
+    daemon->workspaces = workspace;
+    --(daemon->pending);
+    --(request->connection->pending);
+    ++(daemon->served);
+    pthread_cond_broadcast(&(daemon->idle));
+    pthread_mutex_unlock(&(daemon->mutex));
+
+    free(request->problem);
+    free(request);
+}
+
+static void daemon_solve_with(struct DaemonRequest *request, struct DaemonWorkspace *workspace)
+{
+    static const char *names[] = {"optimal", "unbounded", "infeasible", "timeout", "cancelled", "error", "overflow"};
+    struct Daemon *daemon = request->daemon;
+    struct LpReadError error;
+    struct LpModel *model;
+    struct Tableau *tableau;
+    struct SimplexContext *context;
+    enum SimplexStatus status;
+    char number[BUFFER], message[sizeof(error.message) + 32];
+    double remaining = 0.0;
+    int i;
+
+    if(atomic_load(&(daemon->stop)))
+    {
+        workspace_begin(workspace, request->id, "cancelled");
+        return;
+    }
+    if(request->deadline > 0.0)
+    {
+        remaining = request->deadline - stats_now();
+        if(remaining <= 0.0) /* Expired in the queue. */
+        {
+            workspace_begin(workspace, request->id, "timeout");
+            return;
+        }
+    }
+
+    model = lp_read(request->problem, request->length, &error);
+    if(model == NULL)
+    {
+        if(error.line > 0)
+        {
+            snprintf(message, sizeof(message), "line %d: %s", error.line, error.message);
+        }
+        else
+        {
+            snprintf(message, sizeof(message), "%s", error.message);
+        }
+        workspace_begin(workspace, request->id, "error");
+        workspace_append(workspace, ", \"message\": ");
+        workspace_append_string(workspace, message);
+        return;
+    }
+
+    tableau = lp_model_compile(model);
+    context = (tableau != NULL) ? simplex_context_create(tableau) : NULL;
+    if(context == NULL)
+    {
+        workspace_begin(workspace, request->id, "error");
+        workspace_append(workspace, ", \"message\": \"out of memory\"");
+        simplex_free_tableau(tableau);
+        lp_model_free(model);
+        return;
+    }
+    context->maxSeconds = remaining;
+
+    pthread_mutex_lock(&(daemon->mutex));
+    workspace->context = context;
+    pthread_mutex_unlock(&(daemon->mutex));
+    if(atomic_load(&(daemon->stop))) /* daemon_run may have missed the context. */
+    {
+        simplex_cancel(context);
+    }
+
+    status = simplex_iterate(context, 0);
+
+    pthread_mutex_lock(&(daemon->mutex));
+    workspace->context = NULL;
+    pthread_mutex_unlock(&(daemon->mutex));
+
+    workspace_begin(workspace, request->id, names[status]);
+    if(status == SIMPLEX_ERROR)
+    {
+        workspace_append(workspace, ", \"message\": \"out of memory\"");
+    }
+    else if(status == SIMPLEX_OPTIMAL)
+    {
+        if(workspace->valuesSize < model->variables)
+        {
+            free(workspace->values);
+            workspace->valuesSize = model->variables;
+            workspace->values = (struct Rational *)malloc((size_t)model->variables * sizeof(struct Rational));
+            if(workspace->values == NULL)
+            {
+                workspace->valuesSize = 0;
+                workspace_begin(workspace, request->id, "error");
+                workspace_append(workspace, ", \"message\": \"out of memory\"");
+                simplex_context_free(context);
+                simplex_free_tableau(tableau);
+                lp_model_free(model);
+                return;
+            }
+        }
+        if(lp_model_get_solution(model, tableau, workspace->values) != 0)
+        {
+            workspace_begin(workspace, request->id, "error");
+            workspace_append(workspace, ", \"message\": \"out of memory\"");
+            simplex_context_free(context);
+            simplex_free_tableau(tableau);
+            lp_model_free(model);
+            return;
+        }
+        rational_format(number, sizeof(number), lp_model_get_objective(model, tableau));
+        workspace_append(workspace, ", \"objective\": \"%s\", \"solution\": [", number);
+        for(i=0; i<model->variables; ++i)
+        {
+            rational_format(number, sizeof(number), workspace->values[i]);
+            workspace_append(workspace, "%s\"%s\"", (i > 0) ? ", " : "", number);
+        }
+        workspace_append(workspace, "]");
+    }
+
+    simplex_context_free(context);
+    simplex_free_tableau(tableau);
+    lp_model_free(model);
+}
+
+static void workspace_append(struct DaemonWorkspace *workspace, const char *format, ...)
+{
+    va_list args;
+    size_t needed, size;
+    char *response;
+
+    if(workspace->truncated)
+    {
+        return;
+    }
+
+    va_start(args, format);
+    needed = (size_t)vsnprintf(NULL, 0, format, args);
+    va_end(args);
+
+    if(workspace->length + needed + 2 > workspace->size) /* Space for '\0' and the closing brace. */
+    {
+        size = 2 * (workspace->length + needed + 2);
+        response = (char *)realloc(workspace->response, size);
+        if(response == NULL)
+        {
+            workspace->truncated = 1;
+            return;
+        }
+        workspace->response = response;
+        workspace->size = size;
+    }
+
+    va_start(args, format);
+    vsnprintf(workspace->response + workspace->length, workspace->size - workspace->length, format, args);
+    va_end(args);
+    workspace->length += needed;
+}
+
+static void workspace_append_string(struct DaemonWorkspace *workspace, const char *string)
+{
+    workspace_append(workspace, "\"");
+    for(; *string != '\0'; ++string)
+    {
+        if(*string == '"' || *string == '\\')
+        {
+            workspace_append(workspace, "\\%c", *string);
+        }
+        else if((unsigned char)*string < 0x20)
+        {
+            workspace_append(workspace, "\\u%04x", (unsigned int)(unsigned char)*string);
+        }
+        else
+        {
+            workspace_append(workspace, "%c", *string);
+        }
+    }
+    workspace_append(workspace, "\"");
+}
+
+static void workspace_begin(struct DaemonWorkspace *workspace, unsigned int id, const char *status)
+{
+    workspace->length = 4; /* Length of the frame. */
+    workspace->id = id;
+    workspace->truncated = 0;
+    workspace_append(workspace, "{\"id\": %u, \"status\": \"%s\"", id, status);
+}
+
+static void workspace_send(struct DaemonWorkspace *workspace, struct DaemonConnection *connection)
+{
+    char fallback[96];
+    char *frame;
+    uint32_t length;
+    size_t size;
+
+    workspace_append(workspace, "}");
+    if(workspace->truncated) /* Needs no memory. */
+    {
+        size = 4 + (size_t)snprintf(fallback + 4, sizeof(fallback) - 4,
+                                    "{\"id\": %u, \"status\": \"error\", \"message\": \"out of memory\"}", workspace->id);
+        frame = fallback;
+    }
+    else
+    {
+        size = workspace->length;
+        frame = workspace->response;
+    }
+    length = htonl((uint32_t)(size - 4));
+    memcpy(frame, &length, sizeof(length));
+
+    pthread_mutex_lock(&(connection->write));
+    write_all(connection->fd, frame, size); /* A closed client just misses the response. */
+    pthread_mutex_unlock(&(connection->write));
+}
+
+static int read_all(int fd, void *buffer, size_t length)
+{
+    ssize_t n;
+
+    while(length > 0)
+    {
+        n = recv(fd, buffer, length, 0);
+        if(n <= 0)
+        {
+            return -1;
+        }
+        buffer = (char *)buffer + n;
+        length -= (size_t)n;
+    }
+
+    return 0;
+}
+
+static int skip_all(int fd, size_t length)
+{
+    char buffer[4096];
+    size_t part;
+
+    while(length > 0)
+    {
+        part = (length < sizeof(buffer)) ? length : sizeof(buffer);
+        if(read_all(fd, buffer, part) != 0)
+        {
+            return -1;
+        }
+        length -= part;
+    }
+
+    return 0;
+}
+
+static int write_all(int fd, const void *buffer, size_t length)
+{
+    ssize_t n;
+
+    while(length > 0)
+    {
+        n = send(fd, buffer, length, MSG_NOSIGNAL);
+        if(n <= 0)
+        {
+            return -1;
+        }
+        buffer = (const char *)buffer + n;
+        length -= (size_t)n;
+    }
+
+    return 0;
+}
+
+static int socket_address(struct sockaddr_un *address, const char *path)
+{
+    if(strlen(path) >= sizeof(address->sun_path))
+    {
+        return -1;
+    }
+    memset(address, 0, sizeof(*address));
+    address->sun_family = AF_UNIX;
+    strcpy(address->sun_path, path);
+
+    return 0;
+}
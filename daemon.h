@@ -0,0 +1,191 @@
+/**
+ * @brief Header file for daemon.
+ *
+ * This file describes a long running solver service, which accepts solve
+ * requests over a Unix domain socket and solves them on a fixed pool of worker
+ * threads.
+ *
+ * Each request is a frame of three unsigned 32 bit integers in network byte
+ * order, i.e. the length of the problem, the request id and the deadline in
+ * milliseconds (0 for no deadline), followed by the problem in MPS or LP
+ * format. Each response is a frame of the length of the payload as unsigned 32
+ * bit integer in network byte order followed by a JSON object, e.g.
+ *
+ * {"id": 7, "status": "optimal", "objective": "2100", "solution": ["10", "3/2"]}
+ *
+ * The status is one of optimal, unbounded, infeasible, timeout, cancelled,
+ * busy, error and overflow (a result did not fit into an int), only optimal
+ * responses have an objective and a solution and error responses have a
+ * message. A connection can send several requests
+ * without waiting, the responses are sent in the order the solves finish. If
+ * no memory is left for a request, only this request is answered with error
+ * and the message "out of memory".
+ *
+ * @file daemon.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef DAEMON_H
+#define DAEMON_H DAEMON_H
+
+#include <stddef.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "simplex.h"
+#include "thread_pool.h"
+
+#define DAEMON_DEFAULT_QUEUE 64 /**< Default number of accepted but unfinished requests. */
+#define DAEMON_MAX_REQUEST (64 << 20) /**< Largest accepted problem in bytes. */
+
+/**
+ * @brief Reusable buffers of a worker.
+ *
+ * Each running request borrows one workspace, so the response and value
+ * buffers grow to the largest response and are not allocated again for each
+ * request. The model, tableau and context of a solve are created for each
+ * request and freed afterwards.
+ */
+struct DaemonWorkspace
+{
+    char *response; /**< Response frame, the payload starts at offset 4. */
+    size_t length; /**< Length of the response frame. */
+    size_t size; /**< Capacity of response. */
+    struct Rational *values; /**< Values of the model variables. */
+    int valuesSize; /**< Capacity of values. */
+    unsigned int id; /**< Id of the request of the response. */
+    int truncated; /**< 1 if the response did not fit into memory, an error response is sent instead. */
+    struct SimplexContext *context; /**< Running solve or NULL, protected by the mutex of the daemon. */
+    struct DaemonWorkspace *next; /**< Next free workspace. */
+};
+
+/**
+ * @brief Client connection.
+ */
+struct DaemonConnection
+{
+    int fd; /**< Socket of the connection. */
+    struct Daemon *daemon; /**< Daemon of the connection. */
+    pthread_mutex_t write; /**< Lock for sending responses. */
+    int pending; /**< Number of queued and running requests, protected by the mutex of the daemon. */
+    struct DaemonConnection *next; /**< Next open connection. */
+};
+
+/**
+ * @brief Solver service.
+ *
+ * All fields except listener and stop are protected by mutex.
+ */
+struct Daemon
+{
+    int listener; /**< Listening socket. */
+    atomic_int stop; /**< 1 if the daemon shall stop. */
+    struct ThreadPool *pool; /**< Worker threads. */
+    int queue; /**< Limit for the number of accepted but unfinished requests. */
+    pthread_mutex_t mutex; /**< Lock of the daemon. */
+    pthread_cond_t idle; /**< Signaled if a request finishes or a connection closes. */
+    int pending; /**< Number of queued and running requests. */
+    struct DaemonWorkspace *workspaces; /**< Free workspaces. */
+    struct DaemonWorkspace *all; /**< Array of all workspaces. */
+    int workers; /**< Number of workers and workspaces. */
+    struct DaemonConnection *connections; /**< Open connections. */
+    long served; /**< Number of answered requests. */
+    long rejected; /**< Number of requests rejected because the queue was full. */
+};
+
+/**
+ * @brief Create a daemon.
+ *
+ * This function binds a Unix domain socket to the given path, removing a stale
+ * socket first, and starts the worker threads. If the path exists and is no
+ * socket, it is not removed and the daemon is not created.
+ *
+ * @param path
+ *    path of the socket
+ * @param workers
+ *    number of worker threads, number of cores if <= 0
+ * @param queue
+ *    limit for the number of accepted but unfinished requests, further
+ *    requests get the status busy; DAEMON_DEFAULT_QUEUE if <= 0
+ * @return new daemon or NULL if the socket could not be created or no memory is left
+ */
+struct Daemon *daemon_create(const char *path, int workers, int queue);
+
+/**
+ * @brief Serve requests.
+ *
+ * This function accepts connections until daemon_stop is called or accept
+ * fails. Afterwards it cancels the running solves, answers the queued requests
+ * with the status cancelled and waits until all connections are closed. While
+ * no file descriptors or memory are left for a new connection, it waits 100
+ * milliseconds before the next accept. A client whose reader thread can not be
+ * started is disconnected.
+ *
+ * @param daemon
+ *    daemon to run
+ * @return 0 if the daemon was stopped with daemon_stop, -1 if accept failed
+ */
+int daemon_run(struct Daemon *daemon);
+
+/**
+ * @brief Stop a daemon.
+ *
+ * This function lets daemon_run return. It can be called from any thread and
+ * from signal handlers.
+ *
+ * @param daemon
+ *    daemon to stop
+ */
+void daemon_stop(struct Daemon *daemon);
+
+/**
+ * @brief Free a daemon.
+ *
+ * This function stops the workers, closes the socket and frees the daemon.
+ * daemon_run must have returned before.
+ *
+ * @param daemon
+ *    daemon to free
+ * @param path
+ *    path of the socket, which is removed, may be NULL
+ */
+void daemon_free(struct Daemon *daemon, const char *path);
+
+/**
+ * @brief Connect to a daemon.
+ *
+ * @param path
+ *    path of the socket
+ * @return socket of the connection or -1
+ */
+int daemon_connect(const char *path);
+
+/**
+ * @brief Send a solve request.
+ *
+ * @param fd
+ *    socket of the connection
+ * @param id
+ *    id of the request, repeated in the response
+ * @param deadline
+ *    deadline in milliseconds after the request is received, 0 for no deadline
+ * @param problem
+ *    problem in MPS or LP format
+ * @param length
+ *    number of characters of problem
+ * @return 0 on success, -1 if the request could not be sent
+ */
+int daemon_send(int fd, unsigned int id, unsigned int deadline, const char *problem, size_t length);
+
+/**
+ * @brief Receive a response.
+ *
+ * @param fd
+ *    socket of the connection
+ * @return new '\0' terminated JSON object, NULL if the connection was closed or no
+ *    memory is left
+ */
+char *daemon_receive(int fd);
+
+#endif
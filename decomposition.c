@@ -0,0 +1,1101 @@
+/**
+ * @brief Source file for decomposition.
+ *
+ * This file implements the detection of block structures and the
+ * Dantzig-Wolfe decomposition with parallel solves of the blocks.
+ *
+ * @file decomposition.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "decomposition.h"
+
+/**
+ * @brief Line with its number of none zero entries.
+ */
+struct DecompositionLine
+{
+    int line; /**< Line of tableau. */
+    int count; /**< Number of none zero entries. */
+};
+
+/**
+ * @brief Column of the master problem.
+ *
+ * A column is a corner or a ray of one block.
+ */
+struct DecompositionColumn
+{
+    int block; /**< Block of corner or ray. */
+    int ray; /**< 1 for a ray, 0 for a corner. */
+    struct Rational cost; /**< Target function value cx. */
+    struct Rational weight; /**< Value in the last solution of the master problem. */
+    struct Rational *values; /**< Values of the columns of the block. */
+    struct Rational *coupling; /**< Values of the coupling lines. */
+};
+
+struct Decomposition;
+
+/**
+ * @brief Block of a decomposition.
+ */
+struct DecompositionBlock
+{
+    struct Decomposition *problem; /**< Decomposition of block. */
+    int rows; /**< Number of lines. */
+    int cols; /**< Number of columns. */
+    int *lines; /**< Lines of the problem tableau. */
+    int *columns; /**< Columns of the problem tableau. */
+    struct Tableau *tableau; /**< Tableau of the lines and columns. */
+    struct SimplexContext *context; /**< Solve of tableau, kept over all rounds. */
+    struct Rational *cost; /**< Current target function of the columns. */
+    struct Rational *point; /**< Corner of last solve. */
+    struct Rational *ray; /**< Ray of last solve if it is unbounded. */
+    struct Rational value; /**< Target function value of point. */
+    int unbounded; /**< 1 if ray is set. */
+    enum SimplexStatus status; /**< Status of last solve. */
+};
+
+/**
+ * @brief State of a decomposition.
+ */
+struct Decomposition
+{
+    struct Tableau *tableau; /**< Problem tableau, not changed. */
+    int phase; /**< 1 while the violation of the coupling lines is minimized, 2 else. */
+    int couplings; /**< Number of coupling lines. */
+    int *coupling; /**< Coupling lines of the problem tableau. */
+    int count; /**< Number of blocks. */
+    struct DecompositionBlock *blocks; /**< Blocks. */
+    int columnCount; /**< Number of columns of the master problem. */
+    int columnSize; /**< Capacity of columns. */
+    struct DecompositionColumn *columns; /**< Columns of the master problem. */
+    struct Rational *prices; /**< Dual values of the coupling lines. */
+    struct Rational *convexity; /**< Dual values of the convexity equations. */
+};
+
+/**
+ * @brief Allocate memory.
+ *
+ * Nothing is allocated while failed is set, so one check after several calls
+ * is enough.
+ *
+ * @param size
+ *    number of bytes, > 0
+ * @param failed
+ *    flag which is set if no memory is left
+ * @return new memory or NULL if failed is set
+ */
+static void *decomposition_allocate(size_t size, int *failed);
+
+/**
+ * @brief Order lines by descending number of none zero entries.
+ *
+ * @param a
+ *    first line
+ * @param b
+ *    second line
+ * @return < 0 if a comes first, > 0 if b comes first
+ */
+static int decomposition_compare_lines(const void *a, const void *b);
+
+/**
+ * @brief Find the representative of a column.
+ *
+ * @param parent
+ *    union-find forest of the columns
+ * @param column
+ *    column to find
+ * @return representative of the connected columns
+ */
+static int decomposition_find(int *parent, int column);
+
+/**
+ * @brief Connect the columns of lines.
+ *
+ * @param tableau
+ *    tableau to analyze
+ * @param order
+ *    lines to use
+ * @param lines
+ *    number of lines to use
+ * @param parent
+ *    union-find forest to fill, -1 for columns of artificial variables
+ * @return number of connected sets of columns
+ */
+static int decomposition_connect(struct Tableau *tableau, const struct DecompositionLine *order, int lines, int *parent);
+
+/**
+ * @brief Check a block structure.
+ *
+ * @param tableau
+ *    problem tableau
+ * @param blocks
+ *    block structure to check
+ * @return 1 if the structure matches the tableau, 0 else
+ */
+static int decomposition_valid(struct Tableau *tableau, const struct DecompositionBlocks *blocks);
+
+/**
+ * @brief Create the blocks of a decomposition.
+ *
+ * @param problem
+ *    decomposition to initialize, can be freed even if the function fails
+ * @param tableau
+ *    problem tableau
+ * @param blocks
+ *    valid block structure
+ * @return 0 on success, -1 if no memory is left
+ */
+static int decomposition_init(struct Decomposition *problem, struct Tableau *tableau, const struct DecompositionBlocks *blocks);
+
+/**
+ * @brief Free memory of a decomposition.
+ *
+ * @param problem
+ *    decomposition to free, not the structure itself
+ */
+static void decomposition_free(struct Decomposition *problem);
+
+/**
+ * @brief Solve one block.
+ *
+ * This function sets the target function of the current prices and continues
+ * the solve of the block from its last basis. It is the task of the thread
+ * pool.
+ *
+ * @param data
+ *    block to solve
+ */
+static void decomposition_solve_block(void *data);
+
+/**
+ * @brief Set the target function of a block in its current basis.
+ *
+ * @param block
+ *    block with new cost
+ */
+static void decomposition_reprice(struct DecompositionBlock *block);
+
+/**
+ * @brief Solve all blocks and add new columns.
+ *
+ * @param problem
+ *    decomposition
+ * @param pool
+ *    pool for the block solves, may be NULL
+ * @param added
+ *    number of new columns of the master problem
+ * @return SIMPLEX_OPTIMAL if all blocks are solved, SIMPLEX_INFEASIBLE if a
+ *    block has no valid solution and SIMPLEX_ERROR if a solve failed
+ */
+static enum SimplexStatus decomposition_price(struct Decomposition *problem, struct ThreadPool *pool, int *added);
+
+/**
+ * @brief Add a column to the master problem.
+ *
+ * @param problem
+ *    decomposition
+ * @param block
+ *    block of corner or ray
+ * @param values
+ *    values of the columns of the block
+ * @param ray
+ *    1 for a ray, 0 for a corner
+ * @return 0 or -1 if no memory is left, the master problem is not changed then
+ */
+static int decomposition_add_column(struct Decomposition *problem, struct DecompositionBlock *block,
+                                    const struct Rational *values, int ray);
+
+/**
+ * @brief Check the coupling lines for the first corners.
+ *
+ * @param problem
+ *    decomposition with one corner per block
+ * @return 1 if a coupling line is violated, 0 else
+ */
+static int decomposition_violated(struct Decomposition *problem);
+
+/**
+ * @brief Create the tableau of the restricted master problem.
+ *
+ * The tableau has the lines D x <= b for the coupling lines, followed by
+ * sum(corners) <= 1 and -sum(corners) <= -1 for each block. In phase 1 each
+ * coupling line has an artificial column with coefficient -1 and cost -1,
+ * the other columns have cost 0.
+ *
+ * @param problem
+ *    decomposition
+ * @return new tableau or NULL if no memory is left
+ */
+static struct Tableau *decomposition_master(struct Decomposition *problem);
+
+/**
+ * @brief Solve the restricted master problem.
+ *
+ * This function solves the master problem and reads the weights of the
+ * columns, the prices of the coupling lines and the dual values of the
+ * convexity equations.
+ *
+ * @param problem
+ *    decomposition
+ * @param master
+ *    tableau of master problem, solved in place
+ * @return status of solve
+ */
+static enum SimplexStatus decomposition_solve_master(struct Decomposition *problem, struct Tableau *master);
+
+int decomposition_detect(struct Tableau *tableau, struct DecompositionBlocks *blocks)
+{
+    struct DecompositionLine *order;
+    int *parent, *number;
+    int i, j, coupling, root, failed = 0;
+
+    order = (struct DecompositionLine *)decomposition_allocate((tableau->rows + 1) * sizeof(struct DecompositionLine), &failed);
+    parent = (int *)decomposition_allocate((tableau->cols + 1) * sizeof(int), &failed);
+    number = (int *)decomposition_allocate((tableau->cols + 1) * sizeof(int), &failed);
+    blocks->lineBlock = (int *)decomposition_allocate((tableau->rows + 1) * sizeof(int), &failed);
+    blocks->columnBlock = (int *)decomposition_allocate((tableau->cols + 1) * sizeof(int), &failed);
+    if(failed)
+    {
+        free(order);
+        free(parent);
+        free(number);
+        decomposition_blocks_free(blocks);
+        blocks->blocks = -1;
+        return -1;
+    }
+
+    for(i=0; i<tableau->rows; ++i)
+    {
+        order[i].line = i;
+        order[i].count = 0;
+        for(j=0; j<tableau->cols; ++j)
+        {
+            if(tableau->nbvs[j] < tableau->artificials && (tableau->A[i][j])->n != 0)
+            {
+                ++(order[i].count);
+            }
+        }
+    }
+    qsort(order, tableau->rows, sizeof(struct DecompositionLine), decomposition_compare_lines);
+
+    for(coupling=0; coupling<=tableau->rows/2; ++coupling)
+    {
+        if(decomposition_connect(tableau, order + coupling, tableau->rows - coupling, parent) >= 2)
+        {
+            break;
+        }
+    }
+    if(coupling > tableau->rows/2) /* No split, all columns form one block. */
+    {
+        coupling = 0;
+        for(j=0; j<tableau->cols; ++j)
+        {
+            parent[j] = (tableau->nbvs[j] < tableau->artificials) ? 0 : -1;
+        }
+    }
+
+    blocks->blocks = 0;
+    for(j=0; j<tableau->cols; ++j)
+    {
+        number[j] = -1;
+    }
+    for(j=0; j<tableau->cols; ++j)
+    {
+        blocks->columnBlock[j] = -1;
+        if(parent[j] >= 0)
+        {
+            root = decomposition_find(parent, j);
+            if(number[root] < 0)
+            {
+                number[root] = blocks->blocks++;
+            }
+            blocks->columnBlock[j] = number[root];
+        }
+    }
+
+    for(i=0; i<tableau->rows; ++i)
+    {
+        blocks->lineBlock[order[i].line] = -1;
+        for(j=0; i>=coupling && j<tableau->cols; ++j)
+        {
+            if(blocks->columnBlock[j] >= 0 && (tableau->A[order[i].line][j])->n != 0)
+            {
+                blocks->lineBlock[order[i].line] = blocks->columnBlock[j];
+                break;
+            }
+        }
+    }
+
+    free(order);
+    free(parent);
+    free(number);
+
+    return blocks->blocks;
+}
+
+void decomposition_blocks_free(struct DecompositionBlocks *blocks)
+{
+    free(blocks->lineBlock);
+    free(blocks->columnBlock);
+    blocks->lineBlock = NULL;
+    blocks->columnBlock = NULL;
+    blocks->blocks = 0;
+}
+
+enum SimplexStatus decomposition_solve(struct Tableau *tableau, const struct DecompositionBlocks *blocks,
+                                       struct ThreadPool *pool, struct Rational *values,
+                                       struct Rational *objective, int *rounds)
+{
+    struct DecompositionBlocks detected;
+    struct Decomposition problem;
+    struct DecompositionColumn *column;
+    struct Tableau *master = NULL;
+    enum SimplexStatus status;
+    int round = 0, added, j, t;
+
+    detected.lineBlock = NULL;
+    detected.columnBlock = NULL;
+    if(blocks == NULL)
+    {
+        if(decomposition_detect(tableau, &detected) < 0)
+        {
+            return SIMPLEX_ERROR;
+        }
+        blocks = &detected;
+    }
+
+    if(!decomposition_valid(tableau, blocks))
+    {
+        decomposition_blocks_free(&detected);
+        return SIMPLEX_ERROR;
+    }
+
+    status = SIMPLEX_ERROR;
+    if(decomposition_init(&problem, tableau, blocks) == 0)
+    {
+        status = decomposition_price(&problem, pool, &added);
+    }
+    if(status == SIMPLEX_OPTIMAL && decomposition_violated(&problem))
+    {
+        problem.phase = 1;
+    }
+
+    while(status == SIMPLEX_OPTIMAL)
+    {
+        if(round == DECOMPOSITION_MAX_ROUNDS)
+        {
+            status = SIMPLEX_LIMIT_REACHED;
+            break;
+        }
+        simplex_free_tableau(master);
+        master = decomposition_master(&problem);
+        ++round;
+        status = (master != NULL) ? decomposition_solve_master(&problem, master) : SIMPLEX_ERROR;
+        if(status != SIMPLEX_OPTIMAL)
+        {
+            break;
+        }
+        if(problem.phase == 1 && (master->z)->n == 0) /* Coupling lines are valid, drop the artificial columns. */
+        {
+            problem.phase = 2;
+            continue;
+        }
+
+        status = decomposition_price(&problem, pool, &added);
+        if(status == SIMPLEX_OPTIMAL && added == 0)
+        {
+            if(problem.phase == 1)
+            {
+                status = SIMPLEX_INFEASIBLE;
+            }
+            break;
+        }
+    }
+
+    if(status == SIMPLEX_OPTIMAL)
+    {
+        for(j=0; j<tableau->cols; ++j)
+        {
+            values[j].n = 0;
+            values[j].d = 1;
+        }
+        for(j=0; j<problem.columnCount; ++j) /* x = sum(weight * corner) + sum(weight * ray) */
+        {
+            column = &(problem.columns[j]);
+            if(column->weight.n == 0)
+            {
+                continue;
+            }
+            for(t=0; t<problem.blocks[column->block].cols; ++t)
+            {
+                values[problem.blocks[column->block].columns[t]] = rational_sum(values[problem.blocks[column->block].columns[t]],
+                                                                               rational_product(column->weight, column->values[t]));
+            }
+        }
+        if(objective != NULL)
+        {
+            objective->n = -((master->z)->n);
+            objective->d = (master->z)->d;
+            *objective = rational_difference(*objective, *(tableau->z));
+        }
+    }
+
+    if(rounds != NULL)
+    {
+        *rounds = round;
+    }
+    simplex_free_tableau(master);
+    decomposition_free(&problem);
+    decomposition_blocks_free(&detected);
+
+    return status;
+}
+
+static void *decomposition_allocate(size_t size, int *failed)
+{
+    void *memory;
+
+    if(*failed)
+    {
+        return NULL;
+    }
+
+    memory = malloc(size);
+    if(memory == NULL)
+    {
+        *failed = 1;
+    }
+
+    return memory;
+}
+
+static int decomposition_compare_lines(const void *a, const void *b)
+{
+    const struct DecompositionLine *x = (const struct DecompositionLine *)a;
+    const struct DecompositionLine *y = (const struct DecompositionLine *)b;
+
+    if(x->count != y->count)
+    {
+        return (x->count > y->count) ? -1 : 1;
+    }
+
+    return x->line - y->line;
+}
+
+static int decomposition_find(int *parent, int column)
+{
+    int root = column, next;
+
+    while(parent[root] != root)
+    {
+        root = parent[root];
+    }
+    while(parent[column] != root) /* Path compression. */
+    {
+        next = parent[column];
+        parent[column] = root;
+        column = next;
+    }
+
+    return root;
+}
+
+static int decomposition_connect(struct Tableau *tableau, const struct DecompositionLine *order, int lines, int *parent)
+{
+    int i, j, first, a, b, sets = 0;
+
+    for(j=0; j<tableau->cols; ++j)
+    {
+        parent[j] = (tableau->nbvs[j] < tableau->artificials) ? j : -1;
+        if(parent[j] >= 0)
+        {
+            ++sets;
+        }
+    }
+
+    for(i=0; i<lines; ++i)
+    {
+        first = -1;
+        for(j=0; j<tableau->cols; ++j)
+        {
+            if(parent[j] < 0 || (tableau->A[order[i].line][j])->n == 0)
+            {
+                continue;
+            }
+            if(first < 0)
+            {
+                first = j;
+                continue;
+            }
+            a = decomposition_find(parent, first);
+            b = decomposition_find(parent, j);
+            if(a != b)
+            {
+                parent[b] = a;
+                --sets;
+            }
+        }
+    }
+
+    return sets;
+}
+
+static int decomposition_valid(struct Tableau *tableau, const struct DecompositionBlocks *blocks)
+{
+    int i, j, block;
+
+    if(blocks->blocks < 0)
+    {
+        return 0;
+    }
+    for(i=0; i<tableau->rows; ++i)
+    {
+        if(tableau->bvs[i] >= tableau->artificials || blocks->lineBlock[i] < -1 || blocks->lineBlock[i] >= blocks->blocks)
+        {
+            return 0;
+        }
+    }
+    for(j=0; j<tableau->cols; ++j)
+    {
+        if(blocks->columnBlock[j] < -1 || blocks->columnBlock[j] >= blocks->blocks)
+        {
+            return 0;
+        }
+    }
+
+    for(i=0; i<tableau->rows; ++i) /* Lines of a block only use columns of the block or fixed columns. */
+    {
+        block = blocks->lineBlock[i];
+        for(j=0; block>=0 && j<tableau->cols; ++j)
+        {
+            if((tableau->A[i][j])->n != 0 && blocks->columnBlock[j] >= 0 && blocks->columnBlock[j] != block)
+            {
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+static int decomposition_init(struct Decomposition *problem, struct Tableau *tableau, const struct DecompositionBlocks *blocks)
+{
+    struct DecompositionBlock *block;
+    int i, j, k, failed = 0;
+
+    problem->tableau = tableau;
+    problem->phase = 2;
+    problem->count = 0;
+    problem->columnCount = 0;
+    problem->columnSize = 0;
+    problem->columns = NULL;
+    problem->couplings = 0;
+    problem->coupling = (int *)decomposition_allocate((tableau->rows + 1) * sizeof(int), &failed);
+    problem->prices = (struct Rational *)decomposition_allocate((tableau->rows + 1) * sizeof(struct Rational), &failed);
+    problem->convexity = (struct Rational *)decomposition_allocate((blocks->blocks + 1) * sizeof(struct Rational), &failed);
+    problem->blocks = (struct DecompositionBlock *)decomposition_allocate((blocks->blocks + 1) * sizeof(struct DecompositionBlock), &failed);
+    if(failed)
+    {
+        return -1;
+    }
+
+    for(i=0; i<tableau->rows; ++i)
+    {
+        if(blocks->lineBlock[i] < 0)
+        {
+            problem->coupling[problem->couplings++] = i;
+        }
+    }
+    for(i=0; i<problem->couplings; ++i)
+    {
+        problem->prices[i].n = 0;
+        problem->prices[i].d = 1;
+    }
+
+    for(k=0; k<blocks->blocks; ++k)
+    {
+        block = &(problem->blocks[k]);
+        problem->count = k + 1; /* Blocks up to k can be freed. */
+        block->problem = problem;
+        block->rows = 0;
+        block->cols = 0;
+        block->unbounded = 0;
+        block->status = SIMPLEX_LIMIT_REACHED;
+        block->context = NULL;
+        block->tableau = NULL;
+        block->lines = (int *)decomposition_allocate((tableau->rows + 1) * sizeof(int), &failed);
+        block->columns = (int *)decomposition_allocate((tableau->cols + 1) * sizeof(int), &failed);
+        block->cost = NULL;
+        block->point = NULL;
+        block->ray = NULL;
+        if(failed)
+        {
+            return -1;
+        }
+        for(i=0; i<tableau->rows; ++i)
+        {
+            if(blocks->lineBlock[i] == k)
+            {
+                block->lines[block->rows++] = i;
+            }
+        }
+        for(j=0; j<tableau->cols; ++j)
+        {
+            if(blocks->columnBlock[j] == k)
+            {
+                block->columns[block->cols++] = j;
+            }
+        }
+        block->cost = (struct Rational *)decomposition_allocate((block->cols + 1) * sizeof(struct Rational), &failed);
+        block->point = (struct Rational *)decomposition_allocate((block->cols + 1) * sizeof(struct Rational), &failed);
+        block->ray = (struct Rational *)decomposition_allocate((block->cols + 1) * sizeof(struct Rational), &failed);
+        if(failed)
+        {
+            return -1;
+        }
+        block->tableau = simplex_create_tableau(block->rows, block->rows + block->cols);
+    }
+
+    for(k=0; k<problem->count; ++k)
+    {
+        block = &(problem->blocks[k]);
+        if(block->tableau == NULL)
+        {
+            return -1;
+        }
+        for(i=0; i<block->rows; ++i)
+        {
+            block->tableau->bvs[i] = block->cols + i;
+            *(block->tableau->b[i]) = *(tableau->b[block->lines[i]]);
+            for(j=0; j<block->cols; ++j)
+            {
+                *(block->tableau->A[i][j]) = *(tableau->A[block->lines[i]][block->columns[j]]);
+            }
+        }
+        for(j=0; j<block->cols; ++j)
+        {
+            block->tableau->nbvs[j] = j;
+        }
+        block->context = simplex_context_create(block->tableau);
+        if(block->context == NULL)
+        {
+            return -1;
+        }
+        block->context->form = SIMPLEX_FORM_PRIMAL; /* Rays are read from the primal tableau. */
+    }
+
+    return 0;
+}
+
+static void decomposition_free(struct Decomposition *problem)
+{
+    int i;
+
+    for(i=0; i<problem->count; ++i)
+    {
+        if(problem->blocks[i].context != NULL)
+        {
+            simplex_context_free(problem->blocks[i].context);
+        }
+        simplex_free_tableau(problem->blocks[i].tableau);
+        free(problem->blocks[i].lines);
+        free(problem->blocks[i].columns);
+        free(problem->blocks[i].cost);
+        free(problem->blocks[i].point);
+        free(problem->blocks[i].ray);
+    }
+    for(i=0; i<problem->columnCount; ++i)
+    {
+        free(problem->columns[i].values);
+        free(problem->columns[i].coupling);
+    }
+    free(problem->blocks);
+    free(problem->columns);
+    free(problem->coupling);
+    free(problem->prices);
+    free(problem->convexity);
+}
+
+static void decomposition_solve_block(void *data)
+{
+    struct DecompositionBlock *block = (struct DecompositionBlock *)data;
+    struct Decomposition *problem = block->problem;
+    struct Tableau *tableau = block->tableau;
+    struct Rational value;
+    int i, j, limited;
+
+    for(j=0; j<block->cols; ++j) /* cost = c - prices D */
+    {
+        value = *(problem->tableau->c[block->columns[j]]);
+        if(problem->phase == 1)
+        {
+            value.n = 0;
+            value.d = 1;
+        }
+        for(i=0; i<problem->couplings; ++i)
+        {
+            if(problem->prices[i].n != 0 && (problem->tableau->A[problem->coupling[i]][block->columns[j]])->n != 0)
+            {
+                value = rational_difference(value, rational_product(problem->prices[i],
+                                                                    *(problem->tableau->A[problem->coupling[i]][block->columns[j]])));
+            }
+        }
+        block->cost[j] = value;
+    }
+    decomposition_reprice(block);
+
+    block->unbounded = 0;
+    block->context->phase = 1; /* Continue from the last basis, which is valid. */
+    block->status = simplex_iterate(block->context, 0);
+    if(block->status != SIMPLEX_OPTIMAL && block->status != SIMPLEX_UNBOUNDED)
+    {
+        return;
+    }
+
+    block->value.n = 0;
+    block->value.d = 1;
+    for(j=0; j<block->cols; ++j)
+    {
+        simplex_solution_value(tableau, j, &(block->point[j]));
+        block->value = rational_sum(block->value, rational_product(block->cost[j], block->point[j]));
+    }
+
+    if(block->status == SIMPLEX_UNBOUNDED)
+    {
+        for(j=0; j<tableau->cols && !block->unbounded; ++j) /* Improving column without limiting line. */
+        {
+            if((tableau->c[j])->n <= 0 || tableau->nbvs[j] >= tableau->artificials)
+            {
+                continue;
+            }
+            limited = 0;
+            for(i=0; i<tableau->rows; ++i)
+            {
+                if((tableau->A[i][j])->n > 0)
+                {
+                    limited = 1;
+                }
+            }
+            if(limited)
+            {
+                continue;
+            }
+            block->unbounded = 1;
+            for(i=0; i<block->cols; ++i)
+            {
+                block->ray[i].n = 0;
+                block->ray[i].d = 1;
+            }
+            if(tableau->nbvs[j] < block->cols)
+            {
+                block->ray[tableau->nbvs[j]].n = 1;
+            }
+            for(i=0; i<tableau->rows; ++i)
+            {
+                if(tableau->bvs[i] < block->cols)
+                {
+                    block->ray[tableau->bvs[i]].n = -((tableau->A[i][j])->n);
+                    block->ray[tableau->bvs[i]].d = (tableau->A[i][j])->d;
+                }
+            }
+        }
+        if(!block->unbounded)
+        {
+            block->status = SIMPLEX_ERROR;
+        }
+    }
+}
+
+static void decomposition_reprice(struct DecompositionBlock *block)
+{
+    struct Tableau *tableau = block->tableau;
+    struct Rational value;
+    int i, j, variable;
+
+    for(j=0; j<tableau->cols; ++j) /* c_j = cost_j - sum(cost_B A_j), slack and artificial variables have cost 0. */
+    {
+        value.n = 0;
+        value.d = 1;
+        if(tableau->nbvs[j] < block->cols)
+        {
+            value = block->cost[tableau->nbvs[j]];
+        }
+        for(i=0; i<tableau->rows; ++i)
+        {
+            variable = tableau->bvs[i];
+            if(variable < block->cols && block->cost[variable].n != 0)
+            {
+                value = rational_difference(value, rational_product(block->cost[variable], *(tableau->A[i][j])));
+            }
+        }
+        *(tableau->c[j]) = value;
+    }
+
+    value.n = 0; /* z = -sum(cost_B b) */
+    value.d = 1;
+    for(i=0; i<tableau->rows; ++i)
+    {
+        variable = tableau->bvs[i];
+        if(variable < block->cols && block->cost[variable].n != 0)
+        {
+            value = rational_difference(value, rational_product(block->cost[variable], *(tableau->b[i])));
+        }
+    }
+    *(tableau->z) = value;
+}
+
+static enum SimplexStatus decomposition_price(struct Decomposition *problem, struct ThreadPool *pool, int *added)
+{
+    struct DecompositionBlock *block;
+    int k, first = (problem->columnCount == 0);
+
+    if(pool == NULL || problem->count < 2)
+    {
+        for(k=0; k<problem->count; ++k)
+        {
+            decomposition_solve_block(&(problem->blocks[k]));
+        }
+    }
+    else
+    {
+        for(k=0; k<problem->count; ++k)
+        {
+            thread_pool_submit(pool, decomposition_solve_block, &(problem->blocks[k]));
+        }
+        thread_pool_wait(pool);
+    }
+
+    for(k=0; k<problem->count; ++k)
+    {
+        if(problem->blocks[k].status == SIMPLEX_INFEASIBLE)
+        {
+            return SIMPLEX_INFEASIBLE;
+        }
+        if(problem->blocks[k].status != SIMPLEX_OPTIMAL && problem->blocks[k].status != SIMPLEX_UNBOUNDED)
+        {
+            return SIMPLEX_ERROR;
+        }
+    }
+
+    *added = 0;
+    for(k=0; k<problem->count; ++k) /* Reduced cost of corner: value - convexity, of ray: value of the ray. */
+    {
+        block = &(problem->blocks[k]);
+        if(first || rational_compare(block->value, problem->convexity[k]) > 0)
+        {
+            if(decomposition_add_column(problem, block, block->point, 0) != 0)
+            {
+                return SIMPLEX_ERROR;
+            }
+            ++(*added);
+        }
+        if(block->unbounded)
+        {
+            if(decomposition_add_column(problem, block, block->ray, 1) != 0)
+            {
+                return SIMPLEX_ERROR;
+            }
+            ++(*added);
+        }
+    }
+
+    return SIMPLEX_OPTIMAL;
+}
+
+static int decomposition_add_column(struct Decomposition *problem, struct DecompositionBlock *block,
+                                    const struct Rational *values, int ray)
+{
+    struct DecompositionColumn *column, *columns;
+    struct Tableau *tableau = problem->tableau;
+    struct Rational *cell;
+    int i, j, size, failed = 0;
+
+    if(problem->columnCount == problem->columnSize)
+    {
+        size = (problem->columnSize == 0) ? 16 : 2 * problem->columnSize;
+        columns = (struct DecompositionColumn *)realloc(problem->columns, size * sizeof(struct DecompositionColumn));
+        if(columns == NULL)
+        {
+            return -1;
+        }
+        problem->columns = columns;
+        problem->columnSize = size;
+    }
+
+    column = &(problem->columns[problem->columnCount]);
+    column->values = (struct Rational *)decomposition_allocate((block->cols + 1) * sizeof(struct Rational), &failed);
+    column->coupling = (struct Rational *)decomposition_allocate((problem->couplings + 1) * sizeof(struct Rational), &failed);
+    if(failed)
+    {
+        free(column->values);
+        return -1;
+    }
+    ++(problem->columnCount);
+    column->block = (int)(block - problem->blocks);
+    column->ray = ray;
+    column->weight.n = 0;
+    column->weight.d = 1;
+    memcpy(column->values, values, block->cols * sizeof(struct Rational));
+
+    column->cost.n = 0;
+    column->cost.d = 1;
+    for(i=0; i<problem->couplings; ++i)
+    {
+        column->coupling[i] = column->cost;
+    }
+    for(j=0; j<block->cols; ++j)
+    {
+        if(values[j].n == 0)
+        {
+            continue;
+        }
+        column->cost = rational_sum(column->cost, rational_product(*(tableau->c[block->columns[j]]), values[j]));
+        for(i=0; i<problem->couplings; ++i)
+        {
+            cell = tableau->A[problem->coupling[i]][block->columns[j]];
+            if(cell->n != 0)
+            {
+                column->coupling[i] = rational_sum(column->coupling[i], rational_product(*cell, values[j]));
+            }
+        }
+    }
+
+    return 0;
+}
+
+static int decomposition_violated(struct Decomposition *problem)
+{
+    struct Rational sum;
+    int i, j;
+
+    for(i=0; i<problem->couplings; ++i)
+    {
+        sum.n = 0;
+        sum.d = 1;
+        for(j=0; j<problem->columnCount; ++j)
+        {
+            if(!problem->columns[j].ray)
+            {
+                sum = rational_sum(sum, problem->columns[j].coupling[i]);
+            }
+        }
+        if(rational_compare(sum, *(problem->tableau->b[problem->coupling[i]])) > 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static struct Tableau *decomposition_master(struct Decomposition *problem)
+{
+    struct Tableau *master;
+    struct DecompositionColumn *column;
+    int i, j, rows, cols, artificial;
+
+    artificial = (problem->phase == 1) ? problem->couplings : 0;
+    rows = problem->couplings + 2 * problem->count;
+    cols = problem->columnCount + artificial;
+    master = simplex_create_tableau(rows, rows + cols);
+    if(master == NULL)
+    {
+        return NULL;
+    }
+
+    for(j=0; j<cols; ++j)
+    {
+        master->nbvs[j] = j;
+    }
+    for(i=0; i<rows; ++i)
+    {
+        master->bvs[i] = cols + i;
+    }
+    for(i=0; i<problem->couplings; ++i)
+    {
+        *(master->b[i]) = *(problem->tableau->b[problem->coupling[i]]);
+    }
+    for(i=0; i<problem->count; ++i) /* sum(corners) = 1 */
+    {
+        (master->b[problem->couplings + i])->n = 1;
+        (master->b[problem->couplings + problem->count + i])->n = -1;
+    }
+
+    for(j=0; j<problem->columnCount; ++j)
+    {
+        column = &(problem->columns[j]);
+        if(problem->phase == 2)
+        {
+            *(master->c[j]) = column->cost;
+        }
+        for(i=0; i<problem->couplings; ++i)
+        {
+            *(master->A[i][j]) = column->coupling[i];
+        }
+        if(!column->ray)
+        {
+            (master->A[problem->couplings + column->block][j])->n = 1;
+            (master->A[problem->couplings + problem->count + column->block][j])->n = -1;
+        }
+    }
+    for(i=0; i<artificial; ++i)
+    {
+        (master->A[i][problem->columnCount + i])->n = -1;
+        (master->c[problem->columnCount + i])->n = -1;
+    }
+
+    return master;
+}
+
+static enum SimplexStatus decomposition_solve_master(struct Decomposition *problem, struct Tableau *master)
+{
+    struct SimplexContext *context;
+    struct Rational upper, lower;
+    enum SimplexStatus status;
+    int i, variables;
+
+    variables = problem->columnCount + ((problem->phase == 1) ? problem->couplings : 0);
+    context = simplex_context_create(master);
+    if(context == NULL)
+    {
+        return SIMPLEX_ERROR;
+    }
+    status = simplex_iterate(context, 0);
+    simplex_context_free(context);
+    if(status != SIMPLEX_OPTIMAL)
+    {
+        return status;
+    }
+
+    for(i=0; i<problem->couplings; ++i)
+    {
+        if(simplex_dual_value(master, variables + i, &(problem->prices[i])) != 0)
+        {
+            return SIMPLEX_ERROR;
+        }
+    }
+    for(i=0; i<problem->count; ++i) /* Dual value of the equation is the difference of both lines. */
+    {
+        if(simplex_dual_value(master, variables + problem->couplings + i, &upper) != 0
+           || simplex_dual_value(master, variables + problem->couplings + problem->count + i, &lower) != 0)
+        {
+            return SIMPLEX_ERROR;
+        }
+        problem->convexity[i] = rational_difference(upper, lower);
+    }
+    for(i=0; i<problem->columnCount; ++i)
+    {
+        if(simplex_solution_value(master, i, &(problem->columns[i].weight)) != 0)
+        {
+            return SIMPLEX_ERROR;
+        }
+    }
+
+    return SIMPLEX_OPTIMAL;
+}
@@ -0,0 +1,106 @@
+/**
+ * @brief Header file for decomposition.
+ *
+ * This file describes the Dantzig-Wolfe decomposition of block-angular
+ * problems, i.e. independent blocks of equations which are linked by a few
+ * coupling equations.
+ *
+ * @file decomposition.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef DECOMPOSITION_H
+#define DECOMPOSITION_H DECOMPOSITION_H
+
+#include "simplex.h"
+#include "thread_pool.h"
+
+#define DECOMPOSITION_MAX_ROUNDS 1000 /**< Limit for the solves of the master problem. */
+
+/**
+ * @brief Block structure of a tableau.
+ *
+ * This structure assigns the lines and columns of a tableau to blocks. A line
+ * of block k may only have none zero entries in columns of block k. Lines
+ * of no block are the coupling equations, columns of no block are fixed to 0.
+ */
+struct DecompositionBlocks
+{
+    int blocks; /**< Number of blocks. */
+    int *lineBlock; /**< Block of each line, -1 for coupling lines. */
+    int *columnBlock; /**< Block of each column, -1 for columns fixed to 0. */
+};
+
+/**
+ * @brief Find the block structure of a tableau.
+ *
+ * This function marks the lines with the most none zero entries as coupling
+ * lines, one after the other and at most half of the lines, until the
+ * remaining lines split the columns into at least two connected blocks. If no
+ * such split exists, the whole tableau is one block. Columns of artificial
+ * variables are fixed to 0, lines without none zero entries are coupling
+ * lines.
+ *
+ * @param tableau
+ *    tableau to analyze, not changed
+ * @param blocks
+ *    structure to fill, free it with decomposition_blocks_free
+ * @return number of blocks or -1 if no memory is left, nothing is allocated
+ *    then
+ */
+int decomposition_detect(struct Tableau *tableau, struct DecompositionBlocks *blocks);
+
+/**
+ * @brief Free memory of a block structure.
+ *
+ * @param blocks
+ *    structure to free, not the structure itself
+ */
+void decomposition_blocks_free(struct DecompositionBlocks *blocks);
+
+/**
+ * @brief Solve a tableau with the Dantzig-Wolfe decomposition.
+ *
+ * This function solves the problem of the given tableau, i.e.
+ * max cx s.t. x_B + A x_N = b, x >= 0, as combination of corners and rays of
+ * the blocks. Each block is a tableau of its own lines and columns with a
+ * solve context which is kept over all rounds. In each round the restricted
+ * master problem, i.e. the coupling lines and one convexity equation per
+ * block over the known corners and rays, is solved with simplex_iterate. Its
+ * dual values give new target functions of the blocks, which are set in the
+ * current basis of each block, so each block solve continues from its last
+ * corner. The blocks are solved in parallel on the given thread pool. New
+ * corners and rays with positive reduced cost are added to the master problem,
+ * the solve ends if there are none.
+ *
+ * If the first corners violate the coupling lines, a phase 1 with one
+ * artificial column per coupling line minimizes the violation first.
+ *
+ * The tableau is not changed. Only the blocks and the master problem are
+ * stored as tableaus, so memory and time of the pivots depend on the size of
+ * the blocks and not on the size of the whole problem.
+ *
+ * @param tableau
+ *    problem to solve, without artificial variables in the basis
+ * @param blocks
+ *    block structure of the tableau, NULL to use decomposition_detect
+ * @param pool
+ *    pool for the block solves, may be NULL
+ * @param values
+ *    buffer for the values of the cols none basis variables, set if the
+ *    problem is solved
+ * @param objective
+ *    buffer for the target function value cx - z, set if the problem is solved,
+ *    may be NULL
+ * @param rounds
+ *    number of solves of the master problem, may be NULL
+ * @return status of solve, SIMPLEX_LIMIT_REACHED after DECOMPOSITION_MAX_ROUNDS
+ *    rounds and SIMPLEX_ERROR if no memory is left, the blocks do not match
+ *    the tableau or an artificial variable is basis variable
+ */
+enum SimplexStatus decomposition_solve(struct Tableau *tableau, const struct DecompositionBlocks *blocks,
+                                       struct ThreadPool *pool, struct Rational *values,
+                                       struct Rational *objective, int *rounds);
+
+#endif
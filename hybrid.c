@@ -0,0 +1,380 @@
+/**
+ * @brief Source file for hybrid.
+ *
+ * This file implements the floating-point search for the optimal basis and
+ * its rational certification.
+ *
+ * @file hybrid.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#define _POSIX_C_SOURCE 200112L /**< posix_memalign also with -std=c99. */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "hybrid.h"
+#include "modular.h"
+
+#define HYBRID_ALIGNMENT 32 /**< Alignment of the lines of a floating-point tableau in bytes. */
+
+/**
+ * @brief Floating-point tableau.
+ *
+ * This structure stores a tableau in one contiguous array. Each line holds the
+ * cols coefficients followed by the limit and is padded to a multiple of
+ * HYBRID_ALIGNMENT bytes. The line rows holds the target function and its
+ * value, so that all lines are updated with the same loop.
+ */
+struct FloatTableau
+{
+    int rows; /**< Number of equations. */
+    int cols; /**< Number of none basis variables. */
+    int stride; /**< Distance of lines in doubles. */
+    double *data; /**< rows + 1 lines of stride doubles. */
+    int *bvs; /**< Current basis variables. */
+    int *nbvs; /**< Current none basis variables. */
+    int artificials; /**< First artificial variable. */
+};
+
+/**
+ * @brief Convert a tableau into floating-point numbers.
+ *
+ * @param tableau
+ *    tableau to convert
+ * @return new floating-point tableau or NULL if no memory is left
+ */
+static struct FloatTableau *float_create(struct Tableau *tableau);
+
+/**
+ * @brief Free memory of given floating-point tableau.
+ *
+ * @param tableau
+ *    tableau to free
+ */
+static void float_free(struct FloatTableau *tableau);
+
+/**
+ * @brief Choose the pivot element.
+ *
+ * This function chooses the pivot element like update_pivot of the rational
+ * tableau with the rule of Bland. Values within HYBRID_EPSILON are treated as
+ * equal.
+ *
+ * @param tableau
+ *    tableau to check
+ * @param line
+ *    chosen pivot line or -1
+ * @param column
+ *    chosen pivot column or -1
+ */
+static void float_update_pivot(struct FloatTableau *tableau, int *line, int *column);
+
+/**
+ * @brief Exchange a basis variable of a floating-point tableau.
+ *
+ * @param tableau
+ *    tableau to update
+ * @param line
+ *    pivot line
+ * @param column
+ *    pivot column
+ */
+static void float_step(struct FloatTableau *tableau, int line, int column);
+
+/**
+ * @brief Check whether a rational tableau has a pivot element.
+ *
+ * @param tableau
+ *    tableau to check
+ * @return 1 if the rule of Bland finds a pivot element, 0 else
+ */
+static int has_pivot(struct Tableau *tableau);
+
+/**
+ * @brief Arrange a rational tableau like a floating-point tableau.
+ *
+ * This function reorders the lines and columns of the given tableau, so that
+ * its basis and none basis variables are at the same positions as in the
+ * floating-point tableau. Both tableaus must have the same basis.
+ *
+ * @param tableau
+ *    tableau to reorder
+ * @param order
+ *    floating-point tableau with the wanted order
+ * @return 0 on success, -1 if no memory is left, the tableau is not changed then
+ */
+static int arrange_like(struct Tableau *tableau, struct FloatTableau *order);
+
+int simplex_find_best_solution_hybrid(struct Tableau *tableau)
+{
+    struct FloatTableau *candidate;
+    struct Rational *values;
+    int *target;
+    int i, line, column, valid, failed = 0;
+    int variables = tableau->rows + tableau->cols;
+    long pivots, maxPivots = 10L * variables + 100;
+
+    candidate = float_create(tableau);
+    if(candidate == NULL)
+    {
+        return -1;
+    }
+    float_update_pivot(candidate, &line, &column);
+    for(pivots=0; line >= 0 && column >= 0 && pivots < maxPivots; ++pivots)
+    {
+        float_step(candidate, line, column);
+        float_update_pivot(candidate, &line, &column);
+    }
+
+    target = (int *)calloc(variables, sizeof(int));
+    values = (struct Rational *)malloc(variables * sizeof(struct Rational));
+    if(target == NULL || values == NULL)
+    {
+        free(values);
+        free(target);
+        float_free(candidate);
+        return -1;
+    }
+
+    valid = modular_basis_solution(tableau, candidate->bvs, values, NULL);
+    failed = valid < 0;
+    for(i=0; valid > 0 && i<tableau->rows; ++i) /* The basis must be regular and valid in exact arithmetic. */
+    {
+        target[candidate->bvs[i]] = 1;
+        valid = values[candidate->bvs[i]].n >= 0;
+    }
+
+    if(valid > 0)
+    {
+        failed = simplex_pivot_to_basis(tableau, target) != 0 || arrange_like(tableau, candidate) != 0;
+        valid = !failed && !has_pivot(tableau);
+    }
+
+    free(values);
+    free(target);
+    float_free(candidate);
+
+    if(failed || simplex_find_best_solution(tableau) != 0)
+    {
+        return -1;
+    }
+
+    return valid;
+}
+
+static struct FloatTableau *float_create(struct Tableau *tableau)
+{
+    struct FloatTableau *result;
+    int i, j, perLine = HYBRID_ALIGNMENT / sizeof(double);
+    double *line;
+
+    result = (struct FloatTableau *)malloc(sizeof(struct FloatTableau));
+    if(result == NULL)
+    {
+        return NULL;
+    }
+    result->rows = tableau->rows;
+    result->cols = tableau->cols;
+    result->stride = (tableau->cols + 1 + perLine - 1) / perLine * perLine;
+    result->artificials = tableau->artificials;
+    if(posix_memalign((void **)&(result->data), HYBRID_ALIGNMENT, (size_t)(result->rows + 1) * result->stride * sizeof(double)) != 0)
+    {
+        result->data = NULL;
+    }
+    result->bvs = (int *)malloc(tableau->rows * sizeof(int));
+    result->nbvs = (int *)malloc(tableau->cols * sizeof(int));
+    if(result->data == NULL || result->bvs == NULL || result->nbvs == NULL)
+    {
+        float_free(result);
+        return NULL;
+    }
+
+    for(i=0; i<=tableau->rows; ++i)
+    {
+        line = result->data + (size_t)i * result->stride;
+        for(j=0; j<tableau->cols; ++j)
+        {
+            line[j] = (i < tableau->rows) ? (double)(tableau->A[i][j])->n / (tableau->A[i][j])->d
+                                          : (double)(tableau->c[j])->n / (tableau->c[j])->d;
+        }
+        line[tableau->cols] = (i < tableau->rows) ? (double)(tableau->b[i])->n / (tableau->b[i])->d
+                                                  : (double)(tableau->z)->n / (tableau->z)->d;
+        for(j=tableau->cols+1; j<result->stride; ++j)
+        {
+            line[j] = 0.0;
+        }
+    }
+    memcpy(result->bvs, tableau->bvs, tableau->rows * sizeof(int));
+    memcpy(result->nbvs, tableau->nbvs, tableau->cols * sizeof(int));
+
+    return result;
+}
+
+static void float_free(struct FloatTableau *tableau)
+{
+    free(tableau->data);
+    free(tableau->bvs);
+    free(tableau->nbvs);
+    free(tableau);
+}
+
+static void float_update_pivot(struct FloatTableau *tableau, int *line, int *column)
+{
+    const double *cost = tableau->data + (size_t)tableau->rows * tableau->stride;
+    const double *current;
+    double ratio, min = 0.0;
+    int i, j = 0;
+
+    do
+    {
+        for(*column = -1; j<tableau->cols; ++j)
+        {
+            if(cost[j] > HYBRID_EPSILON && tableau->nbvs[j] < tableau->artificials)
+            {
+                *column = j++;
+                break;
+            }
+        }
+
+        *line = -1;
+        for(i=0; *column >= 0 && i<tableau->rows; ++i)
+        {
+            current = tableau->data + (size_t)i * tableau->stride;
+            if(current[*column] > HYBRID_EPSILON)
+            {
+                ratio = current[tableau->cols] / current[*column];
+                if(*line == -1 || ratio < min - HYBRID_EPSILON * (1.0 + fabs(min)))
+                {
+                    *line = i;
+                    min = ratio;
+                }
+            }
+        }
+    }
+    while(*column != -1 && *line == -1);
+}
+
+static void float_step(struct FloatTableau *tableau, int line, int column)
+{
+    double *restrict pivot = tableau->data + (size_t)line * tableau->stride;
+    double *restrict current;
+    double factor;
+    int i, j, temp;
+
+    factor = 1.0 / pivot[column];
+    pivot[column] = 1.0; /* The column of the pivot becomes the column of the leaving variable. */
+    for(j=0; j<tableau->stride; ++j)
+    {
+        pivot[j] *= factor;
+    }
+
+    for(i=0; i<=tableau->rows; ++i)
+    {
+        if(i == line)
+        {
+            continue;
+        }
+        current = tableau->data + (size_t)i * tableau->stride;
+        factor = current[column];
+        if(factor == 0.0)
+        {
+            continue;
+        }
+        current[column] = 0.0;
+        for(j=0; j<tableau->stride; ++j)
+        {
+            current[j] -= factor * pivot[j];
+        }
+    }
+
+    temp = tableau->bvs[line];
+    tableau->bvs[line] = tableau->nbvs[column];
+    tableau->nbvs[column] = temp;
+}
+
+static int has_pivot(struct Tableau *tableau)
+{
+    int i, j;
+
+    for(j=0; j<tableau->cols; ++j)
+    {
+        if((tableau->c[j])->n <= 0 || tableau->nbvs[j] >= tableau->artificials)
+        {
+            continue;
+        }
+        for(i=0; i<tableau->rows; ++i)
+        {
+            if((tableau->A[i][j])->n > 0)
+            {
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static int arrange_like(struct Tableau *tableau, struct FloatTableau *order)
+{
+    struct Rational ***lines, **limits, **cells, **costs;
+    int *position;
+    int i, j;
+
+    position = (int *)malloc((tableau->rows + tableau->cols) * sizeof(int));
+    lines = (struct Rational ***)malloc(tableau->rows * sizeof(struct Rational **));
+    limits = (struct Rational **)malloc(tableau->rows * sizeof(struct Rational *));
+    cells = (struct Rational **)malloc(tableau->cols * sizeof(struct Rational *));
+    costs = (struct Rational **)malloc(tableau->cols * sizeof(struct Rational *));
+    if(position == NULL || lines == NULL || limits == NULL || cells == NULL || costs == NULL
+       || simplex_own_lines(tableau) != 0) /* The lines are reordered and changed in place. */
+    {
+        free(position);
+        free(lines);
+        free(limits);
+        free(cells);
+        free(costs);
+        return -1;
+    }
+    for(i=0; i<tableau->rows; ++i)
+    {
+        position[tableau->bvs[i]] = i;
+    }
+    for(i=0; i<tableau->rows; ++i)
+    {
+        lines[i] = tableau->A[position[order->bvs[i]]];
+        limits[i] = tableau->b[position[order->bvs[i]]];
+    }
+    memcpy(tableau->A, lines, tableau->rows * sizeof(struct Rational **));
+    memcpy(tableau->b, limits, tableau->rows * sizeof(struct Rational *));
+    memcpy(tableau->bvs, order->bvs, tableau->rows * sizeof(int));
+
+    for(j=0; j<tableau->cols; ++j)
+    {
+        position[tableau->nbvs[j]] = j;
+    }
+    for(i=0; i<tableau->rows; ++i)
+    {
+        for(j=0; j<tableau->cols; ++j)
+        {
+            cells[j] = tableau->A[i][position[order->nbvs[j]]];
+        }
+        memcpy(tableau->A[i], cells, tableau->cols * sizeof(struct Rational *));
+    }
+    for(j=0; j<tableau->cols; ++j)
+    {
+        costs[j] = tableau->c[position[order->nbvs[j]]];
+    }
+    memcpy(tableau->c, costs, tableau->cols * sizeof(struct Rational *));
+    memcpy(tableau->nbvs, order->nbvs, tableau->cols * sizeof(int));
+
+    free(position);
+    free(lines);
+    free(limits);
+    free(cells);
+    free(costs);
+
+    return 0;
+}
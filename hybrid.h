@@ -0,0 +1,44 @@
+/**
+ * @brief Header file for hybrid.
+ *
+ * This file describes the phase 2 solve, which searches the optimal basis with
+ * floating-point arithmetic and certifies it with rational arithmetic.
+ *
+ * @file hybrid.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef HYBRID_H
+#define HYBRID_H HYBRID_H
+
+#include "simplex.h"
+
+#define HYBRID_EPSILON 1e-9 /**< Tolerance of floating-point comparisons. */
+
+/**
+ * @brief Phase 2 of simplex algorithm with floating-point search.
+ *
+ * This function runs the rule of Bland on a double copy of the given valid
+ * tableau. The exact values of the found basis are calculated with
+ * modular_basis_solution. If the basis is regular and valid, the rational
+ * tableau is pivoted to it and arranged like the floating-point tableau and
+ * simplex_find_best_solution continues from it, which does no pivot for an
+ * optimal basis. Otherwise the basis is discarded and the solve runs exactly
+ * from the given basis.
+ *
+ * The result is always an exact optimal tableau, so its target function value
+ * is the value simplex_find_best_solution finds. Only this value is
+ * guaranteed to match: the basis, and with it the solution of a problem with
+ * several optimal solutions, is the same only if the floating-point run makes
+ * the same pivot choices as the rational one. This can fail if two ratios or
+ * coefficients differ by less than HYBRID_EPSILON.
+ *
+ * @param tableau
+ *    problem to solve
+ * @return 1 if the floating-point basis was optimal, 0 if rational pivots were needed,
+ *    -1 if no memory is left; the tableau is valid, but not solved then
+ */
+int simplex_find_best_solution_hybrid(struct Tableau *tableau);
+
+#endif
@@ -0,0 +1,824 @@
+/**
+ * @brief Source file for interior.
+ *
+ * This file implements the interior point method of Mehrotra and the
+ * crossover to the simplex tableau.
+ *
+ * @file interior.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "interior.h"
+#include "modular.h"
+
+#define INTERIOR_PARALLEL_MIN 64 /**< Minimal number of lines to split work over the thread pool. */
+
+/**
+ * @brief Problem of the interior point method.
+ *
+ * This structure describes min cx s.t. Ax = b, x >= 0 with a dense matrix A.
+ */
+struct InteriorProblem
+{
+    int m; /**< Number of equations. */
+    int n; /**< Number of variables. */
+    double *A; /**< m x n matrix, stored line by line. */
+    double *b; /**< Limits of equations. */
+    double *c; /**< Cost of variables. */
+    int *variables; /**< Tableau variable of each column. */
+};
+
+/**
+ * @brief Work on a range of lines.
+ */
+typedef void InteriorRange(void *data, int begin, int end);
+
+/**
+ * @brief Part of a parallel loop.
+ */
+struct InteriorChunk
+{
+    InteriorRange *range; /**< Function to run. */
+    void *data; /**< Argument of function. */
+    int begin; /**< First index of part. */
+    int end; /**< Index after part. */
+};
+
+/**
+ * @brief Data to build the normal matrix.
+ */
+struct InteriorNormal
+{
+    const struct InteriorProblem *problem; /**< Problem. */
+    const double *d; /**< Diagonal scaling x / s. */
+    double *M; /**< Lower triangle of A D A^T. */
+};
+
+/**
+ * @brief Data of a Cholesky update step.
+ */
+struct InteriorCholesky
+{
+    double *L; /**< Matrix to factorize in place. */
+    int m; /**< Dimension. */
+    int k; /**< Eliminated column. */
+};
+
+/**
+ * @brief Column of the crossover order.
+ */
+struct InteriorCandidate
+{
+    double value; /**< Value of the variable. */
+    int column; /**< Column of the variable. */
+};
+
+/**
+ * @brief Convert a tableau into an interior point problem.
+ *
+ * @param tableau
+ *    tableau to convert
+ * @return new problem or NULL if no memory is left
+ */
+static struct InteriorProblem *problem_create(struct Tableau *tableau);
+
+/**
+ * @brief Free memory of given problem.
+ *
+ * @param problem
+ *    problem to free
+ */
+static void problem_free(struct InteriorProblem *problem);
+
+/**
+ * @brief Run a loop over the thread pool.
+ *
+ * This function splits [0, count) into one part per worker thread and waits
+ * for all parts. Small loops, loops without pool and loops for which no memory
+ * is left run in the calling thread.
+ *
+ * @param pool
+ *    thread pool, may be NULL
+ * @param range
+ *    function to run for each part
+ * @param data
+ *    argument of function
+ * @param count
+ *    number of indices
+ */
+static void interior_parallel(struct ThreadPool *pool, InteriorRange *range, void *data, int count);
+
+/**
+ * @brief Run a part of a parallel loop.
+ *
+ * @param data
+ *    InteriorChunk to run
+ */
+static void chunk_run(void *data);
+
+/**
+ * @brief Build lines of the normal matrix.
+ *
+ * @param data
+ *    InteriorNormal
+ * @param begin
+ *    first line
+ * @param end
+ *    line after range
+ */
+static void normal_range(void *data, int begin, int end);
+
+/**
+ * @brief Update lines of the remaining matrix of a Cholesky factorization.
+ *
+ * @param data
+ *    InteriorCholesky
+ * @param begin
+ *    first line after the eliminated column
+ * @param end
+ *    line after range
+ */
+static void cholesky_range(void *data, int begin, int end);
+
+/**
+ * @brief Factorize a symmetric matrix.
+ *
+ * This function replaces the lower triangle of the positive semidefinite
+ * matrix with its Cholesky factor. Pivots near 0 are replaced by a huge value,
+ * which sets the corresponding component of solutions to 0.
+ *
+ * @param pool
+ *    thread pool, may be NULL
+ * @param L
+ *    m x m matrix
+ * @param m
+ *    dimension
+ */
+static void cholesky(struct ThreadPool *pool, double *L, int m);
+
+/**
+ * @brief Solve L L^T x = b.
+ *
+ * @param L
+ *    Cholesky factor
+ * @param m
+ *    dimension
+ * @param x
+ *    b, replaced by the solution
+ */
+static void cholesky_solve(const double *L, int m, double *x);
+
+/**
+ * @brief Calculate a search direction.
+ *
+ * This function solves A dx = rp, A^T dy + ds = rd, S dx + X ds = rxs with the
+ * factorized normal matrix.
+ *
+ * @param problem
+ *    problem
+ * @param L
+ *    Cholesky factor of A D A^T
+ * @param vectors
+ *    x, s, d, rd, rxs with n entries each, followed by rp with m entries
+ * @param dx
+ *    primal direction
+ * @param dy
+ *    direction of dual variables
+ * @param ds
+ *    direction of reduced costs
+ */
+static void direction(const struct InteriorProblem *problem, const double *L, double *const *vectors, double *dx,
+                      double *dy, double *ds);
+
+/**
+ * @brief Calculate the longest step which keeps a vector positive.
+ *
+ * @param v
+ *    positive vector
+ * @param dv
+ *    direction
+ * @param n
+ *    number of entries
+ * @return maximal step length, not more than 1
+ */
+static double step_length(const double *v, const double *dv, int n);
+
+/**
+ * @brief Run the predictor-corrector method.
+ *
+ * @param problem
+ *    problem to solve
+ * @param pool
+ *    thread pool, may be NULL
+ * @param x
+ *    array for the primal solution
+ * @param iterations
+ *    number of steps
+ * @return 1 if the method converged, 0 else, -1 if no memory is left
+ */
+static int interior_solve(const struct InteriorProblem *problem, struct ThreadPool *pool, double *x,
+                          int *iterations);
+
+/**
+ * @brief Choose a basis for an interior point solution.
+ *
+ * This function takes the columns in the order of decreasing values and
+ * keeps each column, which is linearly independent of the kept ones.
+ *
+ * @param problem
+ *    problem
+ * @param x
+ *    primal solution
+ * @param basis
+ *    array for m tableau variables
+ * @return 1 if m columns were found, 0 else, -1 if no memory is left
+ */
+static int crossover(const struct InteriorProblem *problem, const double *x, int *basis);
+
+/**
+ * @brief Compare candidates by decreasing value.
+ *
+ * @param a
+ *    first InteriorCandidate
+ * @param b
+ *    second InteriorCandidate
+ * @return order of candidates for qsort
+ */
+static int candidate_compare(const void *a, const void *b);
+
+enum SimplexStatus simplex_interior_point(struct Tableau *tableau, struct ThreadPool *pool, int *iterations)
+{
+    struct InteriorProblem *problem;
+    struct SimplexContext *context;
+    struct Rational *values;
+    enum SimplexStatus status;
+    double *x;
+    int *basis, *target;
+    int i, steps = 0, found = -1, valid = 0, variables = tableau->rows + tableau->cols;
+
+    problem = problem_create(tableau);
+    if(problem == NULL)
+    {
+        return SIMPLEX_ERROR;
+    }
+    x = (double *)malloc((problem->n + 1) * sizeof(double));
+    basis = (int *)malloc((tableau->rows + 1) * sizeof(int));
+    values = (struct Rational *)malloc(variables * sizeof(struct Rational));
+    target = (int *)calloc(variables, sizeof(int));
+    if(x != NULL && basis != NULL && values != NULL && target != NULL)
+    {
+        found = interior_solve(problem, pool, x, &steps);
+    }
+    if(found > 0)
+    {
+        found = crossover(problem, x, basis);
+    }
+    if(found > 0)
+    {
+        found = modular_basis_solution(tableau, basis, values, pool);
+    }
+    if(found > 0)
+    {
+        valid = 1;
+        for(i=0; i<tableau->rows; ++i)
+        {
+            target[basis[i]] = 1;
+            valid = valid && values[basis[i]].n >= 0;
+        }
+    }
+    status = SIMPLEX_ERROR;
+    context = NULL;
+    if(found >= 0 && (!valid || simplex_pivot_to_basis(tableau, target) == 0))
+    {
+        context = simplex_context_create(tableau);
+    }
+    if(context != NULL)
+    {
+        context->form = SIMPLEX_FORM_PRIMAL;
+        status = simplex_iterate(context, 0);
+        simplex_context_free(context);
+    }
+
+    if(iterations != NULL)
+    {
+        *iterations = steps;
+    }
+
+    free(x);
+    free(basis);
+    free(values);
+    free(target);
+    problem_free(problem);
+
+    return status;
+}
+
+static struct InteriorProblem *problem_create(struct Tableau *tableau)
+{
+    struct InteriorProblem *problem;
+    int i, j, k, n = 0;
+
+    problem = (struct InteriorProblem *)malloc(sizeof(struct InteriorProblem));
+    if(problem == NULL)
+    {
+        return NULL;
+    }
+    for(j=0; j<tableau->cols; ++j)
+    {
+        n += tableau->nbvs[j] < tableau->artificials;
+    }
+    for(i=0; i<tableau->rows; ++i)
+    {
+        n += tableau->bvs[i] < tableau->artificials;
+    }
+
+    problem->m = tableau->rows;
+    problem->n = n;
+    problem->A = (double *)calloc((size_t)problem->m * n + 1, sizeof(double));
+    problem->b = (double *)malloc((problem->m + 1) * sizeof(double));
+    problem->c = (double *)calloc(n + 1, sizeof(double));
+    problem->variables = (int *)malloc((n + 1) * sizeof(int));
+    if(problem->A == NULL || problem->b == NULL || problem->c == NULL || problem->variables == NULL)
+    {
+        problem_free(problem);
+        return NULL;
+    }
+
+    k = 0;
+    for(j=0; j<tableau->cols; ++j) /* x_B + A x_N = b, maximize c x_N: minimize -c x_N. */
+    {
+        if(tableau->nbvs[j] >= tableau->artificials)
+        {
+            continue;
+        }
+        for(i=0; i<tableau->rows; ++i)
+        {
+            problem->A[(size_t)i * n + k] = (double)(tableau->A[i][j])->n / (tableau->A[i][j])->d;
+        }
+        problem->c[k] = -(double)(tableau->c[j])->n / (tableau->c[j])->d;
+        problem->variables[k++] = tableau->nbvs[j];
+    }
+    for(i=0; i<tableau->rows; ++i)
+    {
+        problem->b[i] = (double)(tableau->b[i])->n / (tableau->b[i])->d;
+        if(tableau->bvs[i] < tableau->artificials)
+        {
+            problem->A[(size_t)i * n + k] = 1.0;
+            problem->variables[k++] = tableau->bvs[i];
+        }
+    }
+
+    return problem;
+}
+
+static void problem_free(struct InteriorProblem *problem)
+{
+    free(problem->A);
+    free(problem->b);
+    free(problem->c);
+    free(problem->variables);
+    free(problem);
+}
+
+static void interior_parallel(struct ThreadPool *pool, InteriorRange *range, void *data, int count)
+{
+    struct InteriorChunk *chunks;
+    int i, parts;
+
+    chunks = NULL;
+    if(pool != NULL && pool->size >= 2 && count >= INTERIOR_PARALLEL_MIN)
+    {
+        chunks = (struct InteriorChunk *)malloc(pool->size * sizeof(struct InteriorChunk));
+    }
+    if(chunks == NULL)
+    {
+        range(data, 0, count);
+        return;
+    }
+
+    parts = pool->size;
+    for(i=0; i<parts; ++i)
+    {
+        chunks[i].range = range;
+        chunks[i].data = data;
+        chunks[i].begin = (int)((long)count * i / parts);
+        chunks[i].end = (int)((long)count * (i + 1) / parts);
+        thread_pool_submit(pool, chunk_run, &(chunks[i]));
+    }
+    thread_pool_wait(pool);
+    free(chunks);
+}
+
+static void chunk_run(void *data)
+{
+    struct InteriorChunk *chunk = (struct InteriorChunk *)data;
+
+    chunk->range(chunk->data, chunk->begin, chunk->end);
+}
+
+static void normal_range(void *data, int begin, int end)
+{
+    struct InteriorNormal *normal = (struct InteriorNormal *)data;
+    const struct InteriorProblem *problem = normal->problem;
+    const double *a, *b;
+    double sum;
+    int i, j, k;
+
+    for(i=begin; i<end; ++i)
+    {
+        a = problem->A + (size_t)i * problem->n;
+        for(j=0; j<=i; ++j)
+        {
+            b = problem->A + (size_t)j * problem->n;
+            sum = 0.0;
+            for(k=0; k<problem->n; ++k)
+            {
+                sum += a[k] * normal->d[k] * b[k];
+            }
+            normal->M[(size_t)i * problem->m + j] = sum;
+        }
+    }
+}
+
+static void cholesky_range(void *data, int begin, int end)
+{
+    struct InteriorCholesky *step = (struct InteriorCholesky *)data;
+    double *L = step->L;
+    double factor;
+    int i, j, m = step->m, k = step->k;
+
+    for(i=k+1+begin; i<k+1+end; ++i)
+    {
+        factor = L[(size_t)i * m + k];
+        if(factor == 0.0)
+        {
+            continue;
+        }
+        for(j=k+1; j<=i; ++j)
+        {
+            L[(size_t)i * m + j] -= factor * L[(size_t)j * m + k];
+        }
+    }
+}
+
+static void cholesky(struct ThreadPool *pool, double *L, int m)
+{
+    struct InteriorCholesky step;
+    double pivot, largest = 0.0;
+    int i, k;
+
+    for(k=0; k<m; ++k)
+    {
+        largest = fmax(largest, L[(size_t)k * m + k]);
+    }
+
+    step.L = L;
+    step.m = m;
+    for(k=0; k<m; ++k)
+    {
+        pivot = L[(size_t)k * m + k];
+        if(pivot <= 1e-30 * (1.0 + largest)) /* Dependent equation: fix the component to 0. */
+        {
+            L[(size_t)k * m + k] = 1e64;
+            for(i=k+1; i<m; ++i)
+            {
+                L[(size_t)i * m + k] = 0.0;
+            }
+            continue;
+        }
+        pivot = sqrt(pivot);
+        L[(size_t)k * m + k] = pivot;
+        for(i=k+1; i<m; ++i)
+        {
+            L[(size_t)i * m + k] /= pivot;
+        }
+        step.k = k;
+        interior_parallel(pool, cholesky_range, &step, m - k - 1);
+    }
+}
+
+static void cholesky_solve(const double *L, int m, double *x)
+{
+    int i, j;
+
+    for(i=0; i<m; ++i)
+    {
+        for(j=0; j<i; ++j)
+        {
+            x[i] -= L[(size_t)i * m + j] * x[j];
+        }
+        x[i] /= L[(size_t)i * m + i];
+    }
+    for(i=m-1; i>=0; --i)
+    {
+        for(j=i+1; j<m; ++j)
+        {
+            x[i] -= L[(size_t)j * m + i] * x[j];
+        }
+        x[i] /= L[(size_t)i * m + i];
+    }
+}
+
+static void direction(const struct InteriorProblem *problem, const double *L, double *const *vectors, double *dx,
+                      double *dy, double *ds)
+{
+    const double *x = vectors[0], *s = vectors[1], *d = vectors[2], *rd = vectors[3], *rxs = vectors[4];
+    const double *rp = vectors[5];
+    const double *a;
+    int i, j;
+
+    for(j=0; j<problem->n; ++j) /* dx is used as temporary vector D rd - S^-1 rxs. */
+    {
+        dx[j] = d[j] * rd[j] - rxs[j] / s[j];
+    }
+    for(i=0; i<problem->m; ++i)
+    {
+        a = problem->A + (size_t)i * problem->n;
+        dy[i] = rp[i];
+        for(j=0; j<problem->n; ++j)
+        {
+            dy[i] += a[j] * dx[j];
+        }
+    }
+    cholesky_solve(L, problem->m, dy);
+
+    for(j=0; j<problem->n; ++j)
+    {
+        ds[j] = rd[j];
+    }
+    for(i=0; i<problem->m; ++i)
+    {
+        a = problem->A + (size_t)i * problem->n;
+        for(j=0; j<problem->n; ++j)
+        {
+            ds[j] -= a[j] * dy[i];
+        }
+    }
+    for(j=0; j<problem->n; ++j)
+    {
+        dx[j] = (rxs[j] - x[j] * ds[j]) / s[j];
+    }
+}
+
+static double step_length(const double *v, const double *dv, int n)
+{
+    double alpha = 1.0;
+    int j;
+
+    for(j=0; j<n; ++j)
+    {
+        if(dv[j] < 0.0 && -v[j] / dv[j] < alpha)
+        {
+            alpha = -v[j] / dv[j];
+        }
+    }
+
+    return alpha;
+}
+
+static int interior_solve(const struct InteriorProblem *problem, struct ThreadPool *pool, double *x,
+                          int *iterations)
+{
+    struct InteriorNormal normal;
+    double *memory, *s, *y, *rp, *rd, *d, *rxs, *dx, *dy, *ds, *dxa, *dsa, *M;
+    double *vectors[6];
+    double bNorm = 0.0, cNorm = 0.0, pNorm, dNorm, mu, muAffine, sigma, alphaP, alphaD, value;
+    const double *a;
+    int i, j, m = problem->m, n = problem->n, converged = 0;
+
+    if(n == 0)
+    {
+        return 0;
+    }
+
+    memory = (double *)malloc(((size_t)9 * n + 4 * m + (size_t)m * m + 1) * sizeof(double));
+    if(memory == NULL)
+    {
+        return -1;
+    }
+    s = memory;
+    d = s + n;
+    rd = d + n;
+    rxs = rd + n;
+    dx = rxs + n;
+    ds = dx + n;
+    dxa = ds + n;
+    dsa = dxa + n;
+    y = dsa + n;
+    rp = y + m;
+    dy = rp + m;
+    M = dy + m;
+
+    for(i=0; i<m; ++i)
+    {
+        bNorm = fmax(bNorm, fabs(problem->b[i]));
+        y[i] = 0.0;
+    }
+    for(j=0; j<n; ++j)
+    {
+        cNorm = fmax(cNorm, fabs(problem->c[j]));
+    }
+    for(j=0; j<n; ++j)
+    {
+        x[j] = fmax(1.0, bNorm);
+        s[j] = fmax(1.0, cNorm);
+    }
+
+    vectors[0] = x;
+    vectors[1] = s;
+    vectors[2] = d;
+    vectors[3] = rd;
+    vectors[4] = rxs;
+    vectors[5] = rp;
+    normal.problem = problem;
+    normal.d = d;
+    normal.M = M;
+
+    for(*iterations=0; *iterations<INTERIOR_MAX_ITERATIONS; ++(*iterations))
+    {
+        pNorm = 0.0;
+        for(i=0; i<m; ++i) /* rp = b - Ax */
+        {
+            a = problem->A + (size_t)i * n;
+            rp[i] = problem->b[i];
+            for(j=0; j<n; ++j)
+            {
+                rp[i] -= a[j] * x[j];
+            }
+            pNorm = fmax(pNorm, fabs(rp[i]));
+        }
+        for(j=0; j<n; ++j) /* rd = c - A^T y - s */
+        {
+            rd[j] = problem->c[j] - s[j];
+        }
+        for(i=0; i<m; ++i)
+        {
+            a = problem->A + (size_t)i * n;
+            for(j=0; j<n; ++j)
+            {
+                rd[j] -= a[j] * y[i];
+            }
+        }
+        dNorm = 0.0;
+        mu = 0.0;
+        value = 0.0;
+        for(j=0; j<n; ++j)
+        {
+            dNorm = fmax(dNorm, fabs(rd[j]));
+            mu += x[j] * s[j];
+            value += problem->c[j] * x[j];
+        }
+
+        if(pNorm <= INTERIOR_EPSILON * (1.0 + bNorm) && dNorm <= INTERIOR_EPSILON * (1.0 + cNorm)
+           && mu <= INTERIOR_EPSILON * (1.0 + fabs(value)))
+        {
+            converged = 1;
+            break;
+        }
+        mu /= n;
+        if(!isfinite(mu) || mu > 1e30) /* Diverges for infeasible or unbounded problems. */
+        {
+            break;
+        }
+
+        for(j=0; j<n; ++j)
+        {
+            d[j] = x[j] / s[j];
+        }
+        interior_parallel(pool, normal_range, &normal, m);
+        cholesky(pool, M, m);
+
+        for(j=0; j<n; ++j) /* Predictor: affine scaling direction. */
+        {
+            rxs[j] = -x[j] * s[j];
+        }
+        direction(problem, M, vectors, dxa, dy, dsa);
+        alphaP = step_length(x, dxa, n);
+        alphaD = step_length(s, dsa, n);
+        muAffine = 0.0;
+        for(j=0; j<n; ++j)
+        {
+            muAffine += (x[j] + alphaP * dxa[j]) * (s[j] + alphaD * dsa[j]);
+        }
+        muAffine /= n;
+        sigma = pow(muAffine / mu, 3.0);
+
+        for(j=0; j<n; ++j) /* Corrector with centering. */
+        {
+            rxs[j] = -x[j] * s[j] - dxa[j] * dsa[j] + sigma * mu;
+        }
+        direction(problem, M, vectors, dx, dy, ds);
+        alphaP = fmin(1.0, 0.99 * step_length(x, dx, n));
+        alphaD = fmin(1.0, 0.99 * step_length(s, ds, n));
+
+        for(j=0; j<n; ++j)
+        {
+            x[j] += alphaP * dx[j];
+            s[j] += alphaD * ds[j];
+        }
+        for(i=0; i<m; ++i)
+        {
+            y[i] += alphaD * dy[i];
+        }
+    }
+
+    free(memory);
+
+    return converged;
+}
+
+static int crossover(const struct InteriorProblem *problem, const double *x, int *basis)
+{
+    struct InteriorCandidate *candidates;
+    double *reduced, *v, factor, largest, norm;
+    int *line, *used;
+    int i, j, k, t, count = 0, m = problem->m, n = problem->n;
+
+    candidates = (struct InteriorCandidate *)malloc((n + 1) * sizeof(struct InteriorCandidate));
+    reduced = (double *)malloc(((size_t)m * m + 1) * sizeof(double));
+    line = (int *)malloc((m + 1) * sizeof(int));
+    used = (int *)calloc(m + 1, sizeof(int));
+    if(candidates == NULL || reduced == NULL || line == NULL || used == NULL)
+    {
+        free(candidates);
+        free(reduced);
+        free(line);
+        free(used);
+        return -1;
+    }
+    for(j=0; j<n; ++j)
+    {
+        candidates[j].value = x[j];
+        candidates[j].column = j;
+    }
+    qsort(candidates, n, sizeof(struct InteriorCandidate), candidate_compare);
+
+    for(k=0; k<n && count<m; ++k)
+    {
+        v = reduced + (size_t)count * m;
+        norm = 0.0;
+        for(i=0; i<m; ++i)
+        {
+            v[i] = problem->A[(size_t)i * n + candidates[k].column];
+            norm = fmax(norm, fabs(v[i]));
+        }
+        for(t=0; t<count; ++t) /* Reduced columns have 1 in their line and 0 in the lines of the previous ones. */
+        {
+            factor = v[line[t]];
+            if(factor != 0.0)
+            {
+                for(i=0; i<m; ++i)
+                {
+                    v[i] -= factor * reduced[(size_t)t * m + i];
+                }
+            }
+        }
+
+        largest = 0.0;
+        for(i=0; i<m; ++i)
+        {
+            if(!used[i] && fabs(v[i]) > largest)
+            {
+                largest = fabs(v[i]);
+                line[count] = i;
+            }
+        }
+        if(largest <= 1e-9 * (1.0 + norm))
+        {
+            continue;
+        }
+
+        factor = v[line[count]];
+        for(i=0; i<m; ++i)
+        {
+            v[i] /= factor;
+        }
+        used[line[count]] = 1;
+        basis[count++] = problem->variables[candidates[k].column];
+    }
+
+    free(candidates);
+    free(reduced);
+    free(line);
+    free(used);
+
+    return count == m;
+}
+
+static int candidate_compare(const void *a, const void *b)
+{
+    const struct InteriorCandidate *x = (const struct InteriorCandidate *)a;
+    const struct InteriorCandidate *y = (const struct InteriorCandidate *)b;
+
+    if(x->value != y->value)
+    {
+        return (x->value < y->value) ? 1 : -1;
+    }
+
+    return x->column - y->column;
+}
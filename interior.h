@@ -0,0 +1,50 @@
+/**
+ * @brief Header file for interior.
+ *
+ * This file describes the primal-dual interior point method with crossover to
+ * an optimal basis of the simplex tableau.
+ *
+ * @file interior.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef INTERIOR_H
+#define INTERIOR_H INTERIOR_H
+
+#include "simplex.h"
+#include "thread_pool.h"
+
+#define INTERIOR_MAX_ITERATIONS 100 /**< Limit for the steps of the interior point method. */
+#define INTERIOR_EPSILON 1e-8 /**< Relative tolerance of residuals and duality gap. */
+
+/**
+ * @brief Solve a tableau with the interior point method.
+ *
+ * This function solves the problem of the given tableau, i.e.
+ * max cx s.t. x_B + A x_N = b, x >= 0, with the predictor-corrector method of
+ * Mehrotra in double precision. Each step solves the normal equations with a
+ * dense Cholesky factorization. Building and factorizing the normal matrix is
+ * split over the given thread pool.
+ *
+ * The crossover chooses linearly independent columns with the largest values
+ * as basis. If the exact values of this basis, calculated with
+ * modular_basis_solution, are valid, the tableau is pivoted to it. The
+ * tableau is then solved exactly with simplex_iterate, which finishes an
+ * optimal basis without pivots. If the method does not converge, e.g. for
+ * infeasible or unbounded problems, or the basis is invalid, simplex_iterate
+ * solves the tableau from its given basis.
+ *
+ * Artificial variables are not used by the interior point method.
+ *
+ * @param tableau
+ *    problem to solve, solved in place
+ * @param pool
+ *    pool for the parallel parts, may be NULL
+ * @param iterations
+ *    number of interior point steps, may be NULL
+ * @return status of exact solve, SIMPLEX_ERROR if no memory is left; the tableau is valid then
+ */
+enum SimplexStatus simplex_interior_point(struct Tableau *tableau, struct ThreadPool *pool, int *iterations);
+
+#endif
@@ -0,0 +1,781 @@
+/**
+ * @brief Source file for lp model.
+ *
+ * This file implements the sparse optimization problem and its conversion
+ * into a simplex tableau.
+ *
+ * @file lp_model.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "lp_model.h"
+
+#define LP_ROW_SLACK 0 /**< Compiled row with slack basis variable. */
+#define LP_ROW_SURPLUS 1 /**< Compiled row with surplus variable and artificial basis variable. */
+#define LP_ROW_ARTIFICIAL 2 /**< Compiled equation with artificial basis variable. */
+
+/**
+ * @brief Substitution of a model variable by tableau variables.
+ *
+ * x = shift + sign * x[column] - x[negativeColumn]
+ */
+struct LpColumn
+{
+    int column; /**< Tableau variable of x. */
+    int negativeColumn; /**< Tableau variable of negative part of free x or -1. */
+    int sign; /**< 1 or -1. */
+    struct Rational shift; /**< Constant part of x. */
+};
+
+/**
+ * @brief Grow an array.
+ *
+ * This function reallocates the given array to the given number of elements.
+ * If there is not enough memory, the array is kept and failed is set, and
+ * nothing is done while failed is set, so one check after several calls is
+ * enough.
+ *
+ * @param array
+ *    array to grow
+ * @param elements
+ *    new number of elements
+ * @param size
+ *    size of one element
+ * @param failed
+ *    flag which is set if there is not enough memory
+ * @return reallocated array or the old array if failed is set
+ */
+static void *model_grow(void *array, int elements, size_t size, int *failed);
+
+/**
+ * @brief Copy a name.
+ *
+ * @param name
+ *    name to copy, may be NULL
+ * @param length
+ *    length of name
+ * @return new '\0' terminated copy or NULL
+ */
+static char *model_copy_name(const char *name, size_t length);
+
+/**
+ * @brief Calculate the substitution of the model variables.
+ *
+ * This function calculates how each variable of the model is represented by
+ * variables x >= 0 of the tableau.
+ *
+ * @param model
+ *    model to convert
+ * @param columns
+ *    array for the substitutions of the model->variables variables
+ * @param boundRows
+ *    number of rows for upper bounds
+ * @return number of tableau variables without slack variables
+ */
+static int model_columns(const struct LpModel *model, struct LpColumn *columns, int *boundRows);
+
+/**
+ * @brief Calculate the limits of a constraint.
+ *
+ * @param model
+ *    model of constraint
+ * @param row
+ *    index of constraint
+ * @param lower
+ *    lower limit
+ * @param upper
+ *    upper limit
+ * @return LP_HAS_LOWER and LP_HAS_UPPER flags for finite limits
+ */
+static int model_row_limits(const struct LpModel *model, int row, struct Rational *lower, struct Rational *upper);
+
+/**
+ * @brief Add a scaled value to a tableau cell.
+ *
+ * cell = cell + factor * value
+ *
+ * @param cell
+ *    cell to update
+ * @param factor
+ *    factor, 1 or -1
+ * @param value
+ *    value to add
+ */
+static void model_cell_add(struct Rational *cell, int factor, struct Rational value);
+
+/**
+ * @brief Set the target function of a tableau.
+ *
+ * This function substitutes the variables in the target function of the model
+ * and sets c and z of the tableau, which maximizes.
+ *
+ * @param model
+ *    model of tableau
+ * @param columns
+ *    substitutions of the variables
+ * @param tableau
+ *    tableau to update
+ */
+static void model_objective(const struct LpModel *model, const struct LpColumn *columns, struct Tableau *tableau);
+
+/**
+ * @brief Decide the kind of a compiled row.
+ *
+ * This function decides the basis variable of the row "factor * ax <= limit"
+ * or "factor * ax = limit" (equation) of lp_model_compile. Rows with negative
+ * limit are negated.
+ *
+ * @param factor
+ *    factor of ax, negated with the row
+ * @param limit
+ *    limit of row, negated with the row
+ * @param equation
+ *    1 for equations, 0 for inequalities
+ * @return LP_ROW_SLACK, LP_ROW_SURPLUS or LP_ROW_ARTIFICIAL
+ */
+static int model_compile_row(int *factor, struct Rational *limit, int equation);
+
+struct LpModel *lp_model_create(void)
+{
+    struct LpModel *model = NULL;
+
+    model = (struct LpModel *)calloc(1, sizeof(struct LpModel));
+    if(model == NULL)
+    {
+        return NULL;
+    }
+
+    model->offset.n = 0;
+    model->offset.d = 1;
+
+    return model;
+}
+
+void lp_model_free(struct LpModel *model)
+{
+    int i;
+
+    for(i=0; i<model->variables; ++i)
+    {
+        free(model->variableNames[i]);
+    }
+    free(model->variableNames);
+    free(model->cost);
+    free(model->lower);
+    free(model->upper);
+    free(model->bounded);
+
+    for(i=0; i<model->constraints; ++i)
+    {
+        free(model->constraintNames[i]);
+    }
+    free(model->constraintNames);
+    free(model->sense);
+    free(model->rhs);
+    free(model->range);
+    free(model->ranged);
+
+    free(model->entryRow);
+    free(model->entryColumn);
+    free(model->entryValue);
+
+    free(model);
+}
+
+int lp_model_add_variable(struct LpModel *model, const char *name, size_t length)
+{
+    int i = model->variables, size, failed = 0;
+
+    if(i == model->variablesSize)
+    {
+        size = (i == 0) ? 16 : 2 * i;
+        model->variableNames = (char **)model_grow(model->variableNames, size, sizeof(char *), &failed);
+        model->cost = (struct Rational *)model_grow(model->cost, size, sizeof(struct Rational), &failed);
+        model->lower = (struct Rational *)model_grow(model->lower, size, sizeof(struct Rational), &failed);
+        model->upper = (struct Rational *)model_grow(model->upper, size, sizeof(struct Rational), &failed);
+        model->bounded = (int *)model_grow(model->bounded, size, sizeof(int), &failed);
+        if(failed)
+        {
+            return -1;
+        }
+        model->variablesSize = size;
+    }
+
+    model->variableNames[i] = model_copy_name(name, length);
+    if(name != NULL && model->variableNames[i] == NULL)
+    {
+        return -1;
+    }
+    model->cost[i].n = 0;
+    model->cost[i].d = 1;
+    model->lower[i].n = 0;
+    model->lower[i].d = 1;
+    model->upper[i].n = 0;
+    model->upper[i].d = 1;
+    model->bounded[i] = LP_HAS_LOWER;
+
+    ++(model->variables);
+
+    return i;
+}
+
+int lp_model_add_row(struct LpModel *model, const char *name, size_t length, enum LpSense sense)
+{
+    int i = model->constraints, size, failed = 0;
+
+    if(i == model->constraintsSize)
+    {
+        size = (i == 0) ? 16 : 2 * i;
+        model->constraintNames = (char **)model_grow(model->constraintNames, size, sizeof(char *), &failed);
+        model->sense = (enum LpSense *)model_grow(model->sense, size, sizeof(enum LpSense), &failed);
+        model->rhs = (struct Rational *)model_grow(model->rhs, size, sizeof(struct Rational), &failed);
+        model->range = (struct Rational *)model_grow(model->range, size, sizeof(struct Rational), &failed);
+        model->ranged = (int *)model_grow(model->ranged, size, sizeof(int), &failed);
+        if(failed)
+        {
+            return -1;
+        }
+        model->constraintsSize = size;
+    }
+
+    model->constraintNames[i] = model_copy_name(name, length);
+    if(name != NULL && model->constraintNames[i] == NULL)
+    {
+        return -1;
+    }
+    model->sense[i] = sense;
+    model->rhs[i].n = 0;
+    model->rhs[i].d = 1;
+    model->range[i].n = 0;
+    model->range[i].d = 1;
+    model->ranged[i] = 0;
+
+    ++(model->constraints);
+
+    return i;
+}
+
+int lp_model_add_entry(struct LpModel *model, int row, int column, struct Rational value)
+{
+    int i = model->entries, size, failed = 0;
+
+    if(i == model->entriesSize)
+    {
+        size = (i == 0) ? 64 : 2 * i;
+        model->entryRow = (int *)model_grow(model->entryRow, size, sizeof(int), &failed);
+        model->entryColumn = (int *)model_grow(model->entryColumn, size, sizeof(int), &failed);
+        model->entryValue = (struct Rational *)model_grow(model->entryValue, size, sizeof(struct Rational), &failed);
+        if(failed)
+        {
+            return -1;
+        }
+        model->entriesSize = size;
+    }
+
+    model->entryRow[i] = row;
+    model->entryColumn[i] = column;
+    model->entryValue[i] = value;
+
+    ++(model->entries);
+
+    return 0;
+}
+
+int lp_add_var(struct LpModel *model, const char *name)
+{
+    return lp_model_add_variable(model, name, (name == NULL) ? 0 : strlen(name));
+}
+
+int lp_add_constraint(struct LpModel *model, int count, const int *columns, const struct Rational *coeffs,
+                      enum LpSense sense, struct Rational rhs)
+{
+    int i, k, entries = model->entries;
+
+    i = lp_model_add_row(model, NULL, 0, sense);
+    if(i < 0)
+    {
+        return -1;
+    }
+    model->rhs[i] = rhs;
+    for(k=0; k<count; ++k)
+    {
+        if(lp_model_add_entry(model, i, columns[k], coeffs[k]) != 0) /* Remove the incomplete constraint. */
+        {
+            model->entries = entries;
+            --(model->constraints);
+            return -1;
+        }
+    }
+
+    return i;
+}
+
+void lp_set_objective(struct LpModel *model, int maximize, const struct Rational *coeffs)
+{
+    int j;
+
+    model->maximize = maximize;
+    for(j=0; j<model->variables; ++j)
+    {
+        model->cost[j] = coeffs[j];
+    }
+}
+
+struct Tableau *lp_model_to_tableau(const struct LpModel *model)
+{
+    struct Tableau *tableau;
+    struct LpColumn *columns;
+    struct Rational lower, upper, value, constant;
+    int *first, *flags;
+    int i, j, k, r, f, rows = 0, cols, boundRows, failed = 0;
+
+    columns = (struct LpColumn *)model_grow(NULL, model->variables + 1, sizeof(struct LpColumn), &failed);
+    first = (int *)model_grow(NULL, model->constraints + 1, sizeof(int), &failed);
+    flags = (int *)model_grow(NULL, model->constraints + 1, sizeof(int), &failed);
+    if(failed)
+    {
+        free(columns);
+        free(first);
+        free(flags);
+        return NULL;
+    }
+
+    cols = model_columns(model, columns, &boundRows);
+
+    for(i=0; i<model->constraints; ++i) /* One row per finite limit: "<= upper" first, then "-ax <= -lower". */
+    {
+        flags[i] = model_row_limits(model, i, &lower, &upper);
+        first[i] = rows;
+        rows += ((flags[i] & LP_HAS_UPPER) ? 1 : 0) + ((flags[i] & LP_HAS_LOWER) ? 1 : 0);
+    }
+
+    tableau = simplex_create_tableau(rows + boundRows, rows + boundRows + cols);
+    if(tableau == NULL)
+    {
+        free(columns);
+        free(first);
+        free(flags);
+        return NULL;
+    }
+
+    for(i=0; i<model->constraints; ++i)
+    {
+        model_row_limits(model, i, &lower, &upper);
+        r = first[i];
+        if(flags[i] & LP_HAS_UPPER)
+        {
+            model_cell_add(tableau->b[r++], 1, upper);
+        }
+        if(flags[i] & LP_HAS_LOWER)
+        {
+            model_cell_add(tableau->b[r], -1, lower);
+        }
+    }
+
+    for(k=0; k<model->entries; ++k) /* Substitute variables, constant parts move to b. */
+    {
+        i = model->entryRow[k];
+        j = model->entryColumn[k];
+        value = model->entryValue[k];
+        constant = rational_product(value, columns[j].shift);
+
+        for(r=first[i], f=1; f>=-1; f-=2)
+        {
+            if(!(flags[i] & ((f > 0) ? LP_HAS_UPPER : LP_HAS_LOWER)))
+            {
+                continue;
+            }
+            model_cell_add(tableau->A[r][columns[j].column], f * columns[j].sign, value);
+            if(columns[j].negativeColumn >= 0)
+            {
+                model_cell_add(tableau->A[r][columns[j].negativeColumn], -f, value);
+            }
+            model_cell_add(tableau->b[r], -f, constant);
+            ++r;
+        }
+    }
+
+    r = rows;
+    for(j=0; j<model->variables; ++j)
+    {
+        if((model->bounded[j] & LP_HAS_LOWER) && (model->bounded[j] & LP_HAS_UPPER))
+        {
+            (tableau->A[r][columns[j].column])->n = 1;
+            *(tableau->b[r]) = rational_difference(model->upper[j], model->lower[j]);
+            ++r;
+        }
+    }
+    model_objective(model, columns, tableau);
+
+    for(j=0; j<cols; ++j)
+    {
+        tableau->nbvs[j] = j;
+    }
+    for(i=0; i<tableau->rows; ++i)
+    {
+        tableau->bvs[i] = cols + i;
+    }
+
+    free(columns);
+    free(first);
+    free(flags);
+
+    return tableau;
+}
+
+struct Tableau *lp_model_compile(const struct LpModel *model)
+{
+    struct Tableau *tableau;
+    struct LpColumn *columns;
+    struct Rational lower, upper, *constant, *limit;
+    int *first, *count, *factor, *kind;
+    int i, j, k, r, rows = 0, cols, surplus = 0, artificials = 0, column, slack, boundRows, failed = 0;
+
+    columns = (struct LpColumn *)model_grow(NULL, model->variables + 1, sizeof(struct LpColumn), &failed);
+    first = (int *)model_grow(NULL, model->constraints + 1, sizeof(int), &failed);
+    count = (int *)model_grow(NULL, model->constraints + 1, sizeof(int), &failed);
+    constant = (struct Rational *)model_grow(NULL, model->constraints + 1, sizeof(struct Rational), &failed);
+    if(failed)
+    {
+        free(columns);
+        free(first);
+        free(count);
+        free(constant);
+        return NULL;
+    }
+
+    cols = model_columns(model, columns, &boundRows);
+
+    for(i=0; i<model->constraints; ++i) /* One row for equations and for each finite limit of inequalities. */
+    {
+        k = model_row_limits(model, i, &lower, &upper);
+        first[i] = rows;
+        count[i] = (k == (LP_HAS_LOWER | LP_HAS_UPPER) && rational_compare(lower, upper) == 0) ? 1
+                   : ((k & LP_HAS_UPPER) ? 1 : 0) + ((k & LP_HAS_LOWER) ? 1 : 0);
+        rows += count[i];
+        constant[i].n = 0;
+        constant[i].d = 1;
+    }
+    for(k=0; k<model->entries; ++k) /* Constant parts of substituted variables move to the limits. */
+    {
+        if(columns[model->entryColumn[k]].shift.n != 0)
+        {
+            i = model->entryRow[k];
+            constant[i] = rational_sum(constant[i], rational_product(model->entryValue[k], columns[model->entryColumn[k]].shift));
+        }
+    }
+
+    factor = (int *)model_grow(NULL, rows + boundRows + 1, sizeof(int), &failed);
+    kind = (int *)model_grow(NULL, rows + boundRows + 1, sizeof(int), &failed);
+    limit = (struct Rational *)model_grow(NULL, rows + boundRows + 1, sizeof(struct Rational), &failed);
+    if(failed)
+    {
+        tableau = NULL;
+        goto done;
+    }
+
+    for(i=0; i<model->constraints; ++i) /* "ax <= upper" first, then "-ax <= -lower". */
+    {
+        k = model_row_limits(model, i, &lower, &upper);
+        r = first[i];
+        if(k & LP_HAS_UPPER)
+        {
+            factor[r] = 1;
+            limit[r] = rational_difference(upper, constant[i]);
+            kind[r] = model_compile_row(&factor[r], &limit[r], count[i] == 1 && k == (LP_HAS_LOWER | LP_HAS_UPPER));
+            ++r;
+        }
+        if((k & LP_HAS_LOWER) && r < first[i] + count[i])
+        {
+            factor[r] = -1;
+            limit[r] = rational_difference(constant[i], lower);
+            kind[r] = model_compile_row(&factor[r], &limit[r], 0);
+        }
+    }
+    for(j=0, r=rows; j<model->variables; ++j)
+    {
+        if((model->bounded[j] & LP_HAS_LOWER) && (model->bounded[j] & LP_HAS_UPPER))
+        {
+            factor[r] = 1;
+            limit[r] = rational_difference(model->upper[j], model->lower[j]);
+            kind[r] = model_compile_row(&factor[r], &limit[r], 0);
+            ++r;
+        }
+    }
+    for(r=0; r<rows+boundRows; ++r)
+    {
+        surplus += (kind[r] == LP_ROW_SURPLUS) ? 1 : 0;
+        artificials += (kind[r] != LP_ROW_SLACK) ? 1 : 0;
+    }
+
+    tableau = simplex_create_tableau(rows + boundRows, rows + boundRows + cols + surplus);
+    if(tableau == NULL)
+    {
+        goto done;
+    }
+
+    for(k=0; k<model->entries; ++k)
+    {
+        i = model->entryRow[k];
+        j = model->entryColumn[k];
+        for(r=first[i]; r<first[i]+count[i]; ++r)
+        {
+            model_cell_add(tableau->A[r][columns[j].column], factor[r] * columns[j].sign, model->entryValue[k]);
+            if(columns[j].negativeColumn >= 0)
+            {
+                model_cell_add(tableau->A[r][columns[j].negativeColumn], -factor[r], model->entryValue[k]);
+            }
+        }
+    }
+    for(j=0, r=rows; j<model->variables; ++j)
+    {
+        if((model->bounded[j] & LP_HAS_LOWER) && (model->bounded[j] & LP_HAS_UPPER))
+        {
+            (tableau->A[r][columns[j].column])->n = factor[r];
+            ++r;
+        }
+    }
+
+    /* Variables: structural, slack or surplus of inequalities, artificial. */
+    for(j=0; j<cols; ++j)
+    {
+        tableau->nbvs[j] = j;
+    }
+    tableau->artificials = cols + tableau->rows + surplus - artificials;
+    slack = cols;
+    column = cols;
+    k = tableau->artificials;
+    for(r=0; r<tableau->rows; ++r)
+    {
+        *(tableau->b[r]) = limit[r];
+        if(kind[r] == LP_ROW_SLACK)
+        {
+            tableau->bvs[r] = slack++;
+            continue;
+        }
+        if(kind[r] == LP_ROW_SURPLUS)
+        {
+            (tableau->A[r][column])->n = -1;
+            tableau->nbvs[column++] = slack++;
+        }
+        tableau->bvs[r] = k++;
+    }
+
+    model_objective(model, columns, tableau);
+
+done:
+    free(columns);
+    free(first);
+    free(count);
+    free(constant);
+    free(factor);
+    free(kind);
+    free(limit);
+
+    return tableau;
+}
+
+int lp_model_get_solution(const struct LpModel *model, struct Tableau *tableau, struct Rational *values)
+{
+    struct LpColumn *columns;
+    struct Rational part;
+    int j, boundRows, failed = 0;
+
+    columns = (struct LpColumn *)model_grow(NULL, model->variables + 1, sizeof(struct LpColumn), &failed);
+    if(failed)
+    {
+        return -1;
+    }
+    model_columns(model, columns, &boundRows);
+
+    for(j=0; j<model->variables; ++j)
+    {
+        simplex_solution_value(tableau, columns[j].column, &part);
+        part.n *= columns[j].sign;
+        values[j] = rational_sum(columns[j].shift, part);
+        if(columns[j].negativeColumn >= 0)
+        {
+            simplex_solution_value(tableau, columns[j].negativeColumn, &part);
+            values[j] = rational_difference(values[j], part);
+        }
+    }
+
+    free(columns);
+
+    return 0;
+}
+
+struct Rational lp_model_get_objective(const struct LpModel *model, struct Tableau *tableau)
+{
+    struct Rational value = *(tableau->z);
+
+    if(model->maximize)
+    {
+        value.n = -value.n;
+    }
+
+    return value;
+}
+
+static void *model_grow(void *array, int elements, size_t size, int *failed)
+{
+    void *grown;
+
+    if(*failed)
+    {
+        return array;
+    }
+
+    grown = realloc(array, (size_t)elements * size);
+    if(grown == NULL)
+    {
+        *failed = 1;
+        return array;
+    }
+
+    return grown;
+}
+
+static char *model_copy_name(const char *name, size_t length)
+{
+    char *copy;
+
+    if(name == NULL)
+    {
+        return NULL;
+    }
+
+    copy = (char *)malloc(length + 1);
+    if(copy == NULL)
+    {
+        return NULL;
+    }
+    memcpy(copy, name, length);
+    copy[length] = '\0';
+
+    return copy;
+}
+
+static int model_columns(const struct LpModel *model, struct LpColumn *columns, int *boundRows)
+{
+    int j, cols = 0;
+
+    *boundRows = 0;
+    for(j=0; j<model->variables; ++j)
+    {
+        columns[j].column = cols++;
+        columns[j].negativeColumn = -1;
+        columns[j].sign = 1;
+        columns[j].shift.n = 0;
+        columns[j].shift.d = 1;
+
+        if(model->bounded[j] & LP_HAS_LOWER) /* x = l + x' */
+        {
+            columns[j].shift = model->lower[j];
+            if(model->bounded[j] & LP_HAS_UPPER)
+            {
+                ++(*boundRows);
+            }
+        }
+        else if(model->bounded[j] & LP_HAS_UPPER) /* x = u - x' */
+        {
+            columns[j].shift = model->upper[j];
+            columns[j].sign = -1;
+        }
+        else /* x = x' - x'' */
+        {
+            columns[j].negativeColumn = cols++;
+        }
+    }
+
+    return cols;
+}
+
+static int model_row_limits(const struct LpModel *model, int row, struct Rational *lower, struct Rational *upper)
+{
+    struct Rational range = model->range[row];
+    int flags;
+
+    *lower = model->rhs[row];
+    *upper = model->rhs[row];
+
+    switch(model->sense[row])
+    {
+    case LP_LESS_EQUAL:
+        flags = LP_HAS_UPPER;
+        break;
+    case LP_GREATER_EQUAL:
+        flags = LP_HAS_LOWER;
+        break;
+    default:
+        flags = LP_HAS_LOWER | LP_HAS_UPPER;
+        break;
+    }
+
+    if(model->ranged[row]) /* Ranges as defined by the MPS format. */
+    {
+        if(range.n < 0 && model->sense[row] != LP_EQUAL)
+        {
+            range.n = -range.n;
+        }
+        if(model->sense[row] == LP_LESS_EQUAL)
+        {
+            *lower = rational_difference(*upper, range);
+        }
+        else if(model->sense[row] == LP_GREATER_EQUAL || range.n > 0)
+        {
+            *upper = rational_sum(*lower, range);
+        }
+        else
+        {
+            *lower = rational_sum(*upper, range);
+        }
+        flags = LP_HAS_LOWER | LP_HAS_UPPER;
+    }
+
+    return flags;
+}
+
+static void model_cell_add(struct Rational *cell, int factor, struct Rational value)
+{
+    if(factor < 0)
+    {
+        value.n = -value.n;
+    }
+
+    *cell = rational_sum(*cell, value);
+}
+
+static void model_objective(const struct LpModel *model, const struct LpColumn *columns, struct Tableau *tableau)
+{
+    struct Rational constant = model->offset;
+    int j, sign = model->maximize ? 1 : -1;
+
+    for(j=0; j<model->variables; ++j)
+    {
+        model_cell_add(tableau->c[columns[j].column], sign * columns[j].sign, model->cost[j]);
+        if(columns[j].negativeColumn >= 0)
+        {
+            model_cell_add(tableau->c[columns[j].negativeColumn], -sign, model->cost[j]);
+        }
+        constant = rational_sum(constant, rational_product(model->cost[j], columns[j].shift));
+    }
+    (tableau->z)->n = -sign * constant.n;
+    (tableau->z)->d = constant.d;
+}
+
+static int model_compile_row(int *factor, struct Rational *limit, int equation)
+{
+    if(limit->n < 0)
+    {
+        limit->n = -(limit->n);
+        *factor = -(*factor);
+        return equation ? LP_ROW_ARTIFICIAL : LP_ROW_SURPLUS;
+    }
+
+    return equation ? LP_ROW_ARTIFICIAL : LP_ROW_SLACK;
+}
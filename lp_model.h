@@ -0,0 +1,252 @@
+/**
+ * @brief Header file for lp model.
+ *
+ * This file describes a sparse linear optimization problem with named
+ * variables and constraints, bounds and objective sense, and its conversion
+ * into a simplex tableau.
+ *
+ * @file lp_model.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef LP_MODEL_H
+#define LP_MODEL_H LP_MODEL_H
+
+#include <stddef.h>
+
+#include "rational.h"
+#include "simplex.h"
+
+#define LP_HAS_LOWER 1 /**< Flag for finite lower bound. */
+#define LP_HAS_UPPER 2 /**< Flag for finite upper bound. */
+
+/**
+ * @brief Sense of a constraint.
+ */
+enum LpSense
+{
+    LP_LESS_EQUAL, /**< ax <= b */
+    LP_GREATER_EQUAL, /**< ax >= b */
+    LP_EQUAL /**< ax = b */
+};
+
+/**
+ * @brief Sparse linear optimization problem.
+ *
+ * This structure describes the problem
+ * optimize cx + offset s.t. lower(A_i) <= A_i x <= upper(A_i), l <= x <= u.
+ * The matrix A is stored as list of (row, column, value) entries. Arrays are
+ * allocated with spare capacity and grow with the add functions.
+ */
+struct LpModel
+{
+    int maximize; /**< 1 to maximize, 0 to minimize. */
+    struct Rational offset; /**< Constant term of target function. */
+
+    int variables; /**< Number of variables. */
+    int variablesSize; /**< Capacity of variable arrays. */
+    char **variableNames; /**< Names of variables, entries may be NULL. */
+    struct Rational *cost; /**< Target function coefficients. */
+    struct Rational *lower; /**< Lower bounds, valid if LP_HAS_LOWER is set. */
+    struct Rational *upper; /**< Upper bounds, valid if LP_HAS_UPPER is set. */
+    int *bounded; /**< LP_HAS_LOWER and LP_HAS_UPPER flags of variables. Default: lower bound 0. */
+
+    int constraints; /**< Number of constraints. */
+    int constraintsSize; /**< Capacity of constraint arrays. */
+    char **constraintNames; /**< Names of constraints, entries may be NULL. */
+    enum LpSense *sense; /**< Sense of constraints. */
+    struct Rational *rhs; /**< Limits of constraints. */
+    struct Rational *range; /**< Range of constraints, valid if ranged is set. */
+    int *ranged; /**< 1 if constraint has a range, i.e. lower and upper limit. */
+
+    int entries; /**< Number of matrix entries. */
+    int entriesSize; /**< Capacity of entry arrays. */
+    int *entryRow; /**< Constraint of entries. */
+    int *entryColumn; /**< Variable of entries. */
+    struct Rational *entryValue; /**< Value of entries. */
+};
+
+/**
+ * @brief Create an empty model.
+ *
+ * This function creates a new model without variables and constraints, which
+ * minimizes 0.
+ *
+ * @return new model or NULL if no memory is left
+ */
+struct LpModel *lp_model_create(void);
+
+/**
+ * @brief Free memory of given model.
+ *
+ * @param model
+ *    model to free
+ */
+void lp_model_free(struct LpModel *model);
+
+/**
+ * @brief Add a variable.
+ *
+ * This function adds a new variable with bounds 0 <= x < inf and cost 0.
+ *
+ * @param model
+ *    model to extend
+ * @param name
+ *    name of variable, may be NULL
+ * @param length
+ *    length of name
+ * @return index of new variable or -1 if no memory is left
+ */
+int lp_model_add_variable(struct LpModel *model, const char *name, size_t length);
+
+/**
+ * @brief Add a constraint.
+ *
+ * This function adds a new constraint 0 sense 0.
+ *
+ * @param model
+ *    model to extend
+ * @param name
+ *    name of constraint, may be NULL
+ * @param length
+ *    length of name
+ * @param sense
+ *    sense of constraint
+ * @return index of new constraint or -1 if no memory is left
+ */
+int lp_model_add_row(struct LpModel *model, const char *name, size_t length, enum LpSense sense);
+
+/**
+ * @brief Add a matrix entry.
+ *
+ * This function adds value to the coefficient of the given variable in the
+ * given constraint.
+ *
+ * @param model
+ *    model to extend
+ * @param row
+ *    index of constraint
+ * @param column
+ *    index of variable
+ * @param value
+ *    value to add
+ * @return 0 or -1 if no memory is left
+ */
+int lp_model_add_entry(struct LpModel *model, int row, int column, struct Rational value);
+
+/**
+ * @brief Add a variable.
+ *
+ * This function adds a new variable 0 <= x < inf with cost 0 for the model
+ * builder API.
+ *
+ * @param model
+ *    model to extend
+ * @param name
+ *    '\0' terminated name of variable, may be NULL
+ * @return index of new variable or -1 if no memory is left
+ */
+int lp_add_var(struct LpModel *model, const char *name);
+
+/**
+ * @brief Add a constraint.
+ *
+ * This function adds the constraint sum(coeffs[k] x[columns[k]]) sense rhs for
+ * the model builder API.
+ *
+ * @param model
+ *    model to extend
+ * @param count
+ *    number of coefficients
+ * @param columns
+ *    variables of coefficients
+ * @param coeffs
+ *    coefficients
+ * @param sense
+ *    sense of constraint
+ * @param rhs
+ *    right hand side
+ * @return index of new constraint or -1 if no memory is left, the model is
+ *    not changed then
+ */
+int lp_add_constraint(struct LpModel *model, int count, const int *columns, const struct Rational *coeffs,
+                      enum LpSense sense, struct Rational rhs);
+
+/**
+ * @brief Set the target function.
+ *
+ * @param model
+ *    model to change
+ * @param maximize
+ *    1 to maximize, 0 to minimize
+ * @param coeffs
+ *    model->variables cost coefficients
+ */
+void lp_set_objective(struct LpModel *model, int maximize, const struct Rational *coeffs);
+
+/**
+ * @brief Convert model into a tableau.
+ *
+ * This function creates a tableau in the form expected by
+ * simplex_find_start_corner: maximize cx s.t. Ax <= b, x >= 0 with one slack
+ * variable per row. Bounds are substituted, free variables split, ">=" rows
+ * negated and equations and ranges split into two rows.
+ *
+ * @param model
+ *    model to convert
+ * @return new tableau or NULL if no memory is left
+ */
+struct Tableau *lp_model_to_tableau(const struct LpModel *model);
+
+/**
+ * @brief Compile model into a minimal tableau.
+ *
+ * This function creates a tableau for simplex_iterate with as few variables as
+ * possible. Inequalities with valid slack get a slack basis variable. Other
+ * inequalities get a none basis surplus variable and an artificial basis
+ * variable, equations only an artificial basis variable. Rows are negated so
+ * that all basis variables start with valid values and phase 1 runs only for
+ * the artificial variables. Apart from the dense tableau the conversion takes
+ * O(entries) time.
+ *
+ * lp_model_get_solution and lp_model_get_objective can be used with the
+ * result.
+ *
+ * @param model
+ *    model to convert
+ * @return new tableau or NULL if no memory is left
+ */
+struct Tableau *lp_model_compile(const struct LpModel *model);
+
+/**
+ * @brief Get solution of model.
+ *
+ * This function maps the current solution of a tableau created by
+ * lp_model_to_tableau or lp_model_compile back to the variables of the model.
+ *
+ * @param model
+ *    model of tableau
+ * @param tableau
+ *    tableau to read solution
+ * @param values
+ *    array for the values of the model->variables variables
+ * @return 0 or -1 if no memory is left
+ */
+int lp_model_get_solution(const struct LpModel *model, struct Tableau *tableau, struct Rational *values);
+
+/**
+ * @brief Get target function value of model.
+ *
+ * This function returns the current target function value of a tableau
+ * created by lp_model_to_tableau or lp_model_compile in terms of the model.
+ *
+ * @param model
+ *    model of tableau
+ * @param tableau
+ *    tableau to read value
+ * @return target function value
+ */
+struct Rational lp_model_get_objective(const struct LpModel *model, struct Tableau *tableau);
+
+#endif
@@ -0,0 +1,1336 @@
+/**
+ * @brief Source file for lp reader.
+ *
+ * This file implements the readers for MPS and LP files.
+ *
+ * @file lp_reader.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#define _POSIX_C_SOURCE 200112L /**< posix_madvise, mmap and read also with -std=c99. */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "lp_reader.h"
+
+#define READER_MAX_TOKENS 8 /**< Maximal number of tokens of a MPS line. */
+
+/**
+ * @brief Part of the input.
+ */
+struct ReaderToken
+{
+    const char *text; /**< First character. */
+    size_t length; /**< Number of characters. */
+};
+
+/**
+ * @brief Hash table for names.
+ *
+ * This structure maps names to indices of variables or constraints. The names
+ * are stored in the model.
+ */
+struct ReaderNames
+{
+    char ***names; /**< Pointer to name array of model. */
+    int *slots; /**< Index + 1 of name or 0 for free slots. */
+    int size; /**< Number of slots, power of 2. */
+    int used; /**< Number of used slots. */
+    int failed; /**< 1 if there was not enough memory while reading. */
+};
+
+/**
+ * @brief Token types of the LP format.
+ */
+enum LexerType
+{
+    LEXER_END, /**< End of input. */
+    LEXER_NAME, /**< Name or keyword. */
+    LEXER_NUMBER, /**< Number. */
+    LEXER_PLUS, /**< "+" */
+    LEXER_MINUS, /**< "-" */
+    LEXER_COLON, /**< ":" */
+    LEXER_LESS, /**< "<" or "<=" or "=<" */
+    LEXER_GREATER, /**< ">" or ">=" or "=>" */
+    LEXER_EQUAL, /**< "=" */
+    LEXER_INVALID /**< Unknown character. */
+};
+
+/**
+ * @brief Tokenizer of the LP format.
+ */
+struct Lexer
+{
+    const char *data; /**< Input. */
+    size_t length; /**< Length of input. */
+    size_t position; /**< Position of next token. */
+    int line; /**< Line of next token. */
+    enum LexerType type; /**< Type of current token. */
+    struct ReaderToken token; /**< Current token. */
+    struct Rational value; /**< Value of current number. */
+    int infinite; /**< 1 if current number is infinite. */
+    int lineStart; /**< 1 if current token is the first of its line. */
+    int tokenLine; /**< Line of current token. */
+};
+
+/**
+ * @brief Sections of the LP format.
+ */
+enum LpSection
+{
+    SECTION_NONE,
+    SECTION_OBJECTIVE,
+    SECTION_CONSTRAINTS,
+    SECTION_BOUNDS,
+    SECTION_GENERAL,
+    SECTION_BINARY,
+    SECTION_END
+};
+
+/**
+ * @brief Set error description.
+ *
+ * @param error
+ *    error to set, may be NULL
+ * @param line
+ *    line of error
+ * @param format
+ *    printf format string
+ * @return NULL
+ */
+static void *reader_error(struct LpReadError *error, int line, const char *format, ...);
+
+/**
+ * @brief Compare token with keyword, ignoring case.
+ *
+ * @return 1 if equal, 0 else
+ */
+static int reader_is(struct ReaderToken token, const char *keyword);
+
+/**
+ * @brief Parse a number token.
+ *
+ * This function parses the complete token as number. Values like "inf",
+ * "infinity" or numbers >= 1e30 are reported as infinite.
+ *
+ * @param token
+ *    token to parse
+ * @param value
+ *    parsed value
+ * @param infinite
+ *    set to 1 or -1 for infinite values, else 0
+ * @return 1 on success, 0 if the token is no number
+ */
+static int reader_value(struct ReaderToken token, struct Rational *value, int *infinite);
+
+/**
+ * @brief Initialize name table.
+ *
+ * @param table
+ *    table to initialize
+ * @param names
+ *    pointer to name array of model
+ */
+static void names_init(struct ReaderNames *table, char ***names);
+
+/**
+ * @brief Hash of a name.
+ *
+ * @param text
+ *    name
+ * @param length
+ *    length of name
+ * @return hash value
+ */
+static unsigned long names_hash(const char *text, size_t length);
+
+/**
+ * @brief Find name.
+ *
+ * @param table
+ *    table to search
+ * @param token
+ *    name to find
+ * @return index of name or -1
+ */
+static int names_find(struct ReaderNames *table, struct ReaderToken token);
+
+/**
+ * @brief Add name.
+ *
+ * This function adds the given index, whose name must already be stored in
+ * the model, to the table. If there is not enough memory, the table is kept
+ * and failed is set.
+ *
+ * @param table
+ *    table to extend
+ * @param index
+ *    index of new name
+ * @return 0 or -1 if no memory is left
+ */
+static int names_add(struct ReaderNames *table, int index);
+
+/**
+ * @brief Free name table.
+ *
+ * @param table
+ *    table to free
+ */
+static void names_free(struct ReaderNames *table);
+
+/**
+ * @brief Find or create variable.
+ *
+ * @param model
+ *    model to search or extend
+ * @param table
+ *    name table of variables
+ * @param token
+ *    name of variable
+ * @return index of variable or -1 if no memory is left, failed of table is
+ *    set then
+ */
+static int reader_variable(struct LpModel *model, struct ReaderNames *table, struct ReaderToken token);
+
+/**
+ * @brief Read next token of LP format.
+ *
+ * @param lexer
+ *    tokenizer to advance
+ */
+static void lexer_next(struct Lexer *lexer);
+
+/**
+ * @brief Check for a section keyword.
+ *
+ * This function checks if the current token starts a new section and reads
+ * the remaining tokens of the keyword.
+ *
+ * @param lexer
+ *    tokenizer
+ * @param section
+ *    detected section
+ * @return 1 if a section starts, 0 else
+ */
+static int lexer_section(struct Lexer *lexer, enum LpSection *section);
+
+/**
+ * @brief Check if the current token can start a linear expression term.
+ *
+ * @return 1 if current token is a sign, number or name and no section keyword or label
+ */
+static int lexer_is_term(struct Lexer *lexer);
+
+/**
+ * @brief Parse a linear expression of the LP format.
+ *
+ * This function parses terms "[+|-] [number] name" and constants and adds the
+ * coefficients to the given row or, for row -1, to the target function.
+ *
+ * @param lexer
+ *    tokenizer
+ * @param model
+ *    model to extend
+ * @param table
+ *    name table of variables
+ * @param row
+ *    row index or -1 for target function
+ * @param constant
+ *    sum of constants
+ * @return 1 on success, 0 on syntax error
+ */
+static int lexer_expression(struct Lexer *lexer, struct LpModel *model, struct ReaderNames *table, int row, struct Rational *constant);
+
+/**
+ * @brief Parse an optionally signed number or infinity.
+ *
+ * @param lexer
+ *    tokenizer
+ * @param value
+ *    parsed value
+ * @param infinite
+ *    set to 1 or -1 for infinite values, else 0
+ * @return 1 on success, 0 if the current token is no number
+ */
+static int lexer_number(struct Lexer *lexer, struct Rational *value, int *infinite);
+
+/**
+ * @brief Parse one bound of the LP format.
+ *
+ * @return 1 on success, 0 on syntax error
+ */
+static int lexer_bound(struct Lexer *lexer, struct LpModel *model, struct ReaderNames *table);
+
+/**
+ * @brief Set a bound of a variable.
+ *
+ * This function applies "x op value" to the bounds of variable j.
+ *
+ * @param model
+ *    model to change
+ * @param j
+ *    index of variable
+ * @param op
+ *    LEXER_LESS, LEXER_GREATER or LEXER_EQUAL
+ * @param value
+ *    bound value
+ * @param infinite
+ *    1 or -1 for infinite bounds
+ */
+static void reader_set_bound(struct LpModel *model, int j, enum LexerType op, struct Rational value, int infinite);
+
+struct LpModel *lp_read_mps(const char *data, size_t length, struct LpReadError *error)
+{
+    struct LpModel *model = lp_model_create();
+    struct ReaderNames rows, columns;
+    struct ReaderToken tokens[READER_MAX_TOKENS], objective = {NULL, 0};
+    struct Rational value;
+    const char *section = "", *end, *p = data, *last = data + length;
+    char *objectiveName = NULL;
+    int line = 0, count, i, j, k, infinite, novalue, failed;
+    enum LpSense sense;
+
+    if(model == NULL)
+    {
+        return reader_error(error, 0, "out of memory");
+    }
+    names_init(&rows, &(model->constraintNames));
+    names_init(&columns, &(model->variableNames));
+
+    for(; p < last; p = end + 1)
+    {
+        ++line;
+        end = memchr(p, '\n', (size_t)(last - p));
+        if(end == NULL)
+        {
+            end = last;
+        }
+
+        for(count = 0, i = 0; p + i < end && count < READER_MAX_TOKENS;) /* Split line at white space. */
+        {
+            while(p + i < end && (p[i] == ' ' || p[i] == '\t' || p[i] == '\r'))
+            {
+                ++i;
+            }
+            if(p + i >= end)
+            {
+                break;
+            }
+            tokens[count].text = p + i;
+            while(p + i < end && p[i] != ' ' && p[i] != '\t' && p[i] != '\r')
+            {
+                ++i;
+            }
+            tokens[count].length = (size_t)(p + i - tokens[count].text);
+            ++count;
+        }
+
+        if(count == 0 || tokens[0].text[0] == '*')
+        {
+            continue;
+        }
+
+        if(tokens[0].text == p) /* Section header. */
+        {
+            if(reader_is(tokens[0], "NAME") || reader_is(tokens[0], "ROWS") || reader_is(tokens[0], "COLUMNS")
+               || reader_is(tokens[0], "RHS") || reader_is(tokens[0], "RANGES") || reader_is(tokens[0], "BOUNDS")
+               || reader_is(tokens[0], "OBJSENSE") || reader_is(tokens[0], "ENDATA"))
+            {
+                for(section = "NAME\0ROWS\0COLUMNS\0RHS\0RANGES\0BOUNDS\0OBJSENSE\0ENDATA\0"; !reader_is(tokens[0], section); section += strlen(section) + 1);
+                if(reader_is(tokens[0], "OBJSENSE") && count > 1)
+                {
+                    model->maximize = reader_is(tokens[1], "MAX") || reader_is(tokens[1], "MAXIMIZE");
+                }
+                if(reader_is(tokens[0], "ENDATA"))
+                {
+                    break;
+                }
+                continue;
+            }
+            free(objectiveName);
+            lp_model_free(model);
+            names_free(&rows);
+            names_free(&columns);
+            return reader_error(error, line, "unknown section %.*s", (int)tokens[0].length, tokens[0].text);
+        }
+
+        if(strcmp(section, "OBJSENSE") == 0)
+        {
+            model->maximize = reader_is(tokens[0], "MAX") || reader_is(tokens[0], "MAXIMIZE");
+        }
+        else if(strcmp(section, "ROWS") == 0 && count >= 2)
+        {
+            if(reader_is(tokens[0], "N"))
+            {
+                if(objectiveName == NULL)
+                {
+                    objectiveName = (char *)malloc(tokens[1].length + 1);
+                    if(objectiveName == NULL)
+                    {
+                        rows.failed = 1;
+                        break;
+                    }
+                    memcpy(objectiveName, tokens[1].text, tokens[1].length);
+                    objectiveName[tokens[1].length] = '\0';
+                    objective.text = objectiveName;
+                    objective.length = tokens[1].length;
+                }
+                continue;
+            }
+            sense = reader_is(tokens[0], "L") ? LP_LESS_EQUAL : (reader_is(tokens[0], "G") ? LP_GREATER_EQUAL : LP_EQUAL);
+            if(!reader_is(tokens[0], "L") && !reader_is(tokens[0], "G") && !reader_is(tokens[0], "E"))
+            {
+                break;
+            }
+            i = lp_model_add_row(model, tokens[1].text, tokens[1].length, sense);
+            if(i < 0 || names_add(&rows, i) != 0)
+            {
+                rows.failed = 1;
+                break;
+            }
+        }
+        else if(strcmp(section, "COLUMNS") == 0 || strcmp(section, "RHS") == 0 || strcmp(section, "RANGES") == 0)
+        {
+            if(count >= 3 && tokens[1].length == 8 && memcmp(tokens[1].text, "'MARKER'", 8) == 0)
+            {
+                continue;
+            }
+
+            k = (strcmp(section, "COLUMNS") == 0 || count % 2 == 1) ? 1 : 0; /* Name of column or optional set name. */
+            j = -1;
+            if(strcmp(section, "COLUMNS") == 0)
+            {
+                j = reader_variable(model, &columns, tokens[0]);
+                if(j < 0)
+                {
+                    break;
+                }
+            }
+
+            for(; k + 1 < count; k += 2)
+            {
+                if(!reader_value(tokens[k+1], &value, &infinite) || infinite != 0)
+                {
+                    break;
+                }
+                if(objective.text != NULL && tokens[k].length == objective.length
+                   && memcmp(tokens[k].text, objective.text, objective.length) == 0)
+                {
+                    if(j >= 0)
+                    {
+                        model->cost[j] = value;
+                    }
+                    else if(strcmp(section, "RHS") == 0) /* RHS of target function is -offset. */
+                    {
+                        model->offset.n = -value.n;
+                        model->offset.d = value.d;
+                    }
+                    continue;
+                }
+                i = names_find(&rows, tokens[k]);
+                if(i < 0)
+                {
+                    break;
+                }
+                if(j >= 0)
+                {
+                    if(lp_model_add_entry(model, i, j, value) != 0)
+                    {
+                        columns.failed = 1;
+                        break;
+                    }
+                }
+                else if(strcmp(section, "RHS") == 0)
+                {
+                    model->rhs[i] = value;
+                }
+                else
+                {
+                    model->range[i] = value;
+                    model->ranged[i] = 1;
+                }
+            }
+            if(k + 1 < count || k < count)
+            {
+                break;
+            }
+        }
+        else if(strcmp(section, "BOUNDS") == 0 && count >= 2)
+        {
+            novalue = reader_is(tokens[0], "FR") || reader_is(tokens[0], "MI") || reader_is(tokens[0], "PL")
+                      || (reader_is(tokens[0], "BV") && count < 4); /* Bound types without value. */
+            k = (count >= (novalue ? 3 : 4)) ? 2 : 1;
+            j = reader_variable(model, &columns, tokens[k]);
+            infinite = 0;
+            if(j < 0 || (!novalue && (k + 1 >= count || !reader_value(tokens[k+1], &value, &infinite))))
+            {
+                break;
+            }
+
+            if(reader_is(tokens[0], "UP") || reader_is(tokens[0], "UI"))
+            {
+                if(infinite == 0 && value.n < 0 && (model->bounded[j] & LP_HAS_LOWER) && (model->lower[j]).n == 0)
+                {
+                    model->bounded[j] &= ~LP_HAS_LOWER;
+                }
+                reader_set_bound(model, j, LEXER_LESS, value, infinite);
+            }
+            else if(reader_is(tokens[0], "LO") || reader_is(tokens[0], "LI"))
+            {
+                reader_set_bound(model, j, LEXER_GREATER, value, infinite);
+            }
+            else if(reader_is(tokens[0], "FX"))
+            {
+                reader_set_bound(model, j, LEXER_EQUAL, value, infinite);
+            }
+            else if(reader_is(tokens[0], "FR"))
+            {
+                model->bounded[j] = 0;
+            }
+            else if(reader_is(tokens[0], "MI"))
+            {
+                model->bounded[j] &= ~LP_HAS_LOWER;
+            }
+            else if(reader_is(tokens[0], "PL"))
+            {
+                model->bounded[j] &= ~LP_HAS_UPPER;
+            }
+            else if(reader_is(tokens[0], "BV"))
+            {
+                value.n = 0;
+                value.d = 1;
+                reader_set_bound(model, j, LEXER_GREATER, value, 0);
+                value.n = 1;
+                reader_set_bound(model, j, LEXER_LESS, value, 0);
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    free(objectiveName);
+    failed = rows.failed || columns.failed;
+    names_free(&rows);
+    names_free(&columns);
+
+    if(failed)
+    {
+        lp_model_free(model);
+        return reader_error(error, line, "out of memory");
+    }
+    if(p < last && strcmp(section, "ENDATA") != 0)
+    {
+        lp_model_free(model);
+        return reader_error(error, line, "invalid %s entry", section);
+    }
+
+    return model;
+}
+
+struct LpModel *lp_read_lp(const char *data, size_t length, struct LpReadError *error)
+{
+    struct LpModel *model = lp_model_create();
+    struct ReaderNames columns;
+    struct Lexer lexer, label;
+    struct Rational constant, value, second;
+    struct ReaderToken keyword;
+    enum LpSection section = SECTION_NONE;
+    enum LexerType op;
+    int row, infinite, secondInfinite, ok = 1;
+
+    if(model == NULL)
+    {
+        return reader_error(error, 0, "out of memory");
+    }
+    names_init(&columns, &(model->variableNames));
+
+    lexer.data = data;
+    lexer.length = length;
+    lexer.position = 0;
+    lexer.line = 1;
+    lexer_next(&lexer);
+
+    while(ok && lexer.type != LEXER_END && section != SECTION_END)
+    {
+        keyword = lexer.token;
+        if(lexer.lineStart && lexer_section(&lexer, &section))
+        {
+            lexer_next(&lexer);
+            if(section == SECTION_OBJECTIVE) /* Target function, optional label. */
+            {
+                model->maximize = (keyword.length >= 3 && strncasecmp(keyword.text, "max", 3) == 0);
+                label = lexer;
+                lexer_next(&label);
+                if(lexer.type == LEXER_NAME && label.type == LEXER_COLON)
+                {
+                    lexer = label;
+                    lexer_next(&lexer);
+                }
+                constant.n = 0;
+                constant.d = 1;
+                ok = lexer_expression(&lexer, model, &columns, -1, &constant);
+                model->offset = constant;
+            }
+            continue;
+        }
+
+        switch(section)
+        {
+        case SECTION_CONSTRAINTS:
+            label = lexer;
+            lexer_next(&label);
+            row = -1;
+            if(lexer.type == LEXER_NAME && label.type == LEXER_COLON)
+            {
+                row = lp_model_add_row(model, lexer.token.text, lexer.token.length, LP_LESS_EQUAL);
+                lexer = label;
+                lexer_next(&lexer);
+            }
+            else
+            {
+                row = lp_model_add_row(model, NULL, 0, LP_LESS_EQUAL);
+            }
+            if(row < 0)
+            {
+                columns.failed = 1;
+                ok = 0;
+                break;
+            }
+
+            infinite = 0;
+            label = lexer;
+            if(lexer_number(&label, &value, &infinite) && (label.type == LEXER_LESS || label.type == LEXER_GREATER)) /* l <= ax <= u */
+            {
+                op = label.type;
+                lexer = label;
+                lexer_next(&lexer);
+                constant.n = 0;
+                constant.d = 1;
+                ok = lexer_expression(&lexer, model, &columns, row, &constant) && lexer.type == op && infinite == 0;
+                lexer_next(&lexer);
+                ok = ok && lexer_number(&lexer, &second, &secondInfinite) && secondInfinite == 0;
+                if(ok)
+                {
+                    if(op == LEXER_GREATER)
+                    {
+                        struct Rational swap = value;
+                        value = second;
+                        second = swap;
+                    }
+                    model->rhs[row] = rational_difference(second, constant);
+                    model->range[row] = rational_difference(second, value);
+                    model->ranged[row] = 1;
+                }
+                break;
+            }
+
+            constant.n = 0;
+            constant.d = 1;
+            ok = lexer_expression(&lexer, model, &columns, row, &constant);
+            op = lexer.type;
+            ok = ok && (op == LEXER_LESS || op == LEXER_GREATER || op == LEXER_EQUAL);
+            lexer_next(&lexer);
+            ok = ok && lexer_number(&lexer, &value, &infinite) && infinite == 0;
+            if(ok)
+            {
+                model->sense[row] = (op == LEXER_LESS) ? LP_LESS_EQUAL : ((op == LEXER_GREATER) ? LP_GREATER_EQUAL : LP_EQUAL);
+                model->rhs[row] = rational_difference(value, constant);
+            }
+            break;
+        case SECTION_BOUNDS:
+            ok = lexer_bound(&lexer, model, &columns);
+            break;
+        case SECTION_GENERAL:
+        case SECTION_BINARY:
+            ok = (lexer.type == LEXER_NAME);
+            if(ok)
+            {
+                row = reader_variable(model, &columns, lexer.token);
+                if(row < 0)
+                {
+                    ok = 0;
+                    break;
+                }
+                if(section == SECTION_BINARY)
+                {
+                    value.n = 0;
+                    value.d = 1;
+                    reader_set_bound(model, row, LEXER_GREATER, value, 0);
+                    value.n = 1;
+                    reader_set_bound(model, row, LEXER_LESS, value, 0);
+                }
+                lexer_next(&lexer);
+            }
+            break;
+        default:
+            ok = 0;
+            break;
+        }
+    }
+
+    ok = ok ? 1 : (columns.failed ? -1 : 0);
+    names_free(&columns);
+
+    if(ok < 0)
+    {
+        lp_model_free(model);
+        return reader_error(error, lexer.tokenLine, "out of memory");
+    }
+    if(!ok)
+    {
+        lp_model_free(model);
+        return reader_error(error, lexer.tokenLine, "unexpected \"%.*s\"", (int)lexer.token.length, lexer.token.text);
+    }
+
+    return model;
+}
+
+struct LpModel *lp_read(const char *data, size_t length, struct LpReadError *error)
+{
+    size_t i;
+    int mps;
+
+    for(i = 0; i < length && (data[i] == '*' || data[i] == '\\' || data[i] == '\n' || data[i] == '\r');)
+    {
+        if(data[i] == '*' || data[i] == '\\')
+        {
+            while(i < length && data[i] != '\n')
+            {
+                ++i;
+            }
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    mps = (length - i >= 4 && (strncmp(data + i, "NAME", 4) == 0 || strncmp(data + i, "ROWS", 4) == 0));
+
+    return mps ? lp_read_mps(data, length, error) : lp_read_lp(data, length, error);
+}
+
+struct LpModel *lp_read_file(const char *path, struct LpReadError *error)
+{
+    struct LpModel *model;
+    struct stat info;
+    char *data = NULL, *grown;
+    size_t length = 0, size = 0, n;
+    int fd, mapped = 0;
+
+    if(strcmp(path, "-") == 0) /* stdin can not be mapped, read it into a growing buffer. */
+    {
+        fd = STDIN_FILENO;
+        do
+        {
+            if(length == size)
+            {
+                size = (size == 0) ? 65536 : 2 * size;
+                grown = (char *)realloc(data, size);
+                if(grown == NULL)
+                {
+                    free(data);
+                    return reader_error(error, 0, "out of memory");
+                }
+                data = grown;
+            }
+            n = (size_t)read(fd, data + length, size - length);
+            if(n != (size_t)-1)
+            {
+                length += n;
+            }
+        }
+        while(n != 0 && n != (size_t)-1);
+    }
+    else
+    {
+        fd = open(path, O_RDONLY);
+        if(fd < 0 || fstat(fd, &info) != 0)
+        {
+            if(fd >= 0)
+            {
+                close(fd);
+            }
+            return reader_error(error, 0, "can not open %s", path);
+        }
+        length = (size_t)info.st_size;
+        if(length > 0)
+        {
+            data = (char *)mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(data == MAP_FAILED)
+            {
+                close(fd);
+                return reader_error(error, 0, "can not map %s", path);
+            }
+            posix_madvise(data, length, POSIX_MADV_SEQUENTIAL);
+            mapped = 1;
+        }
+        close(fd);
+    }
+
+    n = strlen(path);
+    if(n > 4 && strcasecmp(path + n - 4, ".mps") == 0)
+    {
+        model = lp_read_mps(data, length, error);
+    }
+    else if(n > 3 && strcasecmp(path + n - 3, ".lp") == 0)
+    {
+        model = lp_read_lp(data, length, error);
+    }
+    else
+    {
+        model = lp_read(data, length, error);
+    }
+
+    if(mapped)
+    {
+        munmap(data, length);
+    }
+    else
+    {
+        free(data);
+    }
+
+    return model;
+}
+
+static void *reader_error(struct LpReadError *error, int line, const char *format, ...)
+{
+    va_list args;
+
+    if(error != NULL)
+    {
+        error->line = line;
+        va_start(args, format);
+        vsnprintf(error->message, sizeof(error->message), format, args);
+        va_end(args);
+    }
+
+    return NULL;
+}
+
+static int reader_is(struct ReaderToken token, const char *keyword)
+{
+    return strlen(keyword) == token.length && strncasecmp(token.text, keyword, token.length) == 0;
+}
+
+static int reader_value(struct ReaderToken token, struct Rational *value, int *infinite)
+{
+    struct ReaderToken rest = token;
+    size_t i;
+    int sign = 1;
+
+    *infinite = 0;
+    if(rational_parse(token.text, token.length, value) == token.length)
+    {
+        return 1;
+    }
+
+    if(rest.length > 0 && (rest.text[0] == '-' || rest.text[0] == '+'))
+    {
+        sign = (rest.text[0] == '-') ? -1 : 1;
+        ++(rest.text);
+        --(rest.length);
+    }
+    if(reader_is(rest, "inf") || reader_is(rest, "infinity"))
+    {
+        *infinite = sign;
+        return 1;
+    }
+
+    for(i = 0; i < rest.length && ((rest.text[i] >= '0' && rest.text[i] <= '9') || rest.text[i] == '.'); ++i);
+    if(i > 0 && i + 1 < rest.length && (rest.text[i] == 'e' || rest.text[i] == 'E') && rest.text[i+1] != '-'
+       && atoi(rest.text + i + 1 + (rest.text[i+1] == '+')) >= 30) /* Values >= 1e30 are infinite. */
+    {
+        *infinite = sign;
+        return 1;
+    }
+
+    return 0;
+}
+
+static void names_init(struct ReaderNames *table, char ***names)
+{
+    table->names = names;
+    table->size = 0;
+    table->used = 0;
+    table->slots = NULL;
+    table->failed = 0;
+}
+
+static unsigned long names_hash(const char *text, size_t length)
+{
+    unsigned long hash = 5381;
+    size_t i;
+
+    for(i = 0; i < length; ++i)
+    {
+        hash = hash * 33 + (unsigned char)text[i];
+    }
+
+    return hash;
+}
+
+static int names_find(struct ReaderNames *table, struct ReaderToken token)
+{
+    unsigned long slot;
+    const char *name;
+
+    if(table->size == 0)
+    {
+        return -1;
+    }
+
+    for(slot = names_hash(token.text, token.length) & (unsigned long)(table->size - 1); table->slots[slot] != 0;
+        slot = (slot + 1) & (unsigned long)(table->size - 1))
+    {
+        name = (*(table->names))[table->slots[slot] - 1];
+        if(name != NULL && strncmp(name, token.text, token.length) == 0 && name[token.length] == '\0')
+        {
+            return table->slots[slot] - 1;
+        }
+    }
+
+    return -1;
+}
+
+static int names_add(struct ReaderNames *table, int index)
+{
+    unsigned long slot;
+    int *old = table->slots, oldSize = table->size, i;
+    const char *name;
+
+    if(2 * (table->used + 1) > table->size) /* Keep load factor <= 1/2. */
+    {
+        table->slots = (int *)calloc((size_t)((oldSize == 0) ? 64 : 2 * oldSize), sizeof(int));
+        if(table->slots == NULL)
+        {
+            table->slots = old;
+            table->failed = 1;
+            return -1;
+        }
+        table->size = (oldSize == 0) ? 64 : 2 * oldSize;
+        table->used = 0;
+        for(i = 0; i < oldSize; ++i)
+        {
+            if(old[i] != 0)
+            {
+                names_add(table, old[i] - 1);
+            }
+        }
+        free(old);
+    }
+
+    name = (*(table->names))[index];
+    if(name == NULL)
+    {
+        return 0;
+    }
+    for(slot = names_hash(name, strlen(name)) & (unsigned long)(table->size - 1); table->slots[slot] != 0;
+        slot = (slot + 1) & (unsigned long)(table->size - 1));
+    table->slots[slot] = index + 1;
+    ++(table->used);
+
+    return 0;
+}
+
+static void names_free(struct ReaderNames *table)
+{
+    free(table->slots);
+    table->slots = NULL;
+    table->size = 0;
+    table->used = 0;
+}
+
+static int reader_variable(struct LpModel *model, struct ReaderNames *table, struct ReaderToken token)
+{
+    int j = names_find(table, token);
+
+    if(j < 0)
+    {
+        j = lp_model_add_variable(model, token.text, token.length);
+        if(j < 0 || names_add(table, j) != 0)
+        {
+            table->failed = 1;
+            return -1;
+        }
+    }
+
+    return j;
+}
+
+static void reader_set_bound(struct LpModel *model, int j, enum LexerType op, struct Rational value, int infinite)
+{
+    if(op == LEXER_LESS || op == LEXER_EQUAL)
+    {
+        if(infinite > 0)
+        {
+            model->bounded[j] &= ~LP_HAS_UPPER;
+        }
+        else
+        {
+            model->upper[j] = value;
+            model->bounded[j] |= LP_HAS_UPPER;
+        }
+    }
+    if(op == LEXER_GREATER || op == LEXER_EQUAL)
+    {
+        if(infinite < 0)
+        {
+            model->bounded[j] &= ~LP_HAS_LOWER;
+        }
+        else
+        {
+            model->lower[j] = value;
+            model->bounded[j] |= LP_HAS_LOWER;
+        }
+    }
+}
+
+static void lexer_next(struct Lexer *lexer)
+{
+    const char *d = lexer->data;
+    size_t p = lexer->position, n = lexer->length;
+    int newLine = (p == 0);
+
+    for(;;) /* Skip white space and comments. */
+    {
+        while(p < n && (d[p] == ' ' || d[p] == '\t' || d[p] == '\r' || d[p] == '\n'))
+        {
+            if(d[p] == '\n')
+            {
+                ++(lexer->line);
+                newLine = 1;
+            }
+            ++p;
+        }
+        if(p < n && d[p] == '\\')
+        {
+            while(p < n && d[p] != '\n')
+            {
+                ++p;
+            }
+            continue;
+        }
+        break;
+    }
+
+    lexer->lineStart = newLine;
+    lexer->tokenLine = lexer->line;
+    lexer->token.text = d + p;
+    lexer->token.length = 1;
+
+    if(p >= n)
+    {
+        lexer->type = LEXER_END;
+        lexer->token.length = 0;
+    }
+    else if((d[p] >= '0' && d[p] <= '9') || d[p] == '.')
+    {
+        size_t i = p;
+
+        while(i < n && ((d[i] >= '0' && d[i] <= '9') || d[i] == '.'))
+        {
+            ++i;
+        }
+        if(i + 1 < n && (d[i] == 'e' || d[i] == 'E')
+           && ((d[i+1] >= '0' && d[i+1] <= '9') || ((d[i+1] == '-' || d[i+1] == '+') && i + 2 < n && d[i+2] >= '0' && d[i+2] <= '9')))
+        {
+            for(i += 2; i < n && d[i] >= '0' && d[i] <= '9'; ++i);
+        }
+        lexer->token.length = i - p;
+        lexer->type = reader_value(lexer->token, &(lexer->value), &(lexer->infinite)) ? LEXER_NUMBER : LEXER_INVALID;
+    }
+    else if(d[p] == '<' || d[p] == '>' || d[p] == '=')
+    {
+        lexer->type = (d[p] == '<') ? LEXER_LESS : ((d[p] == '>') ? LEXER_GREATER : LEXER_EQUAL);
+        if(p + 1 < n && (d[p+1] == '=' || (d[p] == '=' && (d[p+1] == '<' || d[p+1] == '>'))))
+        {
+            if(d[p] == '=')
+            {
+                lexer->type = (d[p+1] == '<') ? LEXER_LESS : ((d[p+1] == '>') ? LEXER_GREATER : LEXER_EQUAL);
+            }
+            lexer->token.length = 2;
+        }
+    }
+    else if(d[p] == '+' || d[p] == '-' || d[p] == ':')
+    {
+        lexer->type = (d[p] == '+') ? LEXER_PLUS : ((d[p] == '-') ? LEXER_MINUS : LEXER_COLON);
+    }
+    else if(strchr("!\"#$%&()/,;?@_`'{}|~", d[p]) != NULL || (d[p] >= 'a' && d[p] <= 'z') || (d[p] >= 'A' && d[p] <= 'Z'))
+    {
+        lexer->type = LEXER_NAME;
+        while(p + lexer->token.length < n)
+        {
+            char c = d[p + lexer->token.length];
+            if(!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '.'
+                 || strchr("!\"#$%&()/,;?@_`'{}|~", c) != NULL) || c == '\0')
+            {
+                break;
+            }
+            ++(lexer->token.length);
+        }
+    }
+    else
+    {
+        lexer->type = LEXER_INVALID;
+    }
+
+    lexer->position = p + lexer->token.length;
+}
+
+static int lexer_section(struct Lexer *lexer, enum LpSection *section)
+{
+    struct Lexer next;
+    struct ReaderToken t = lexer->token;
+
+    if(lexer->type != LEXER_NAME)
+    {
+        return 0;
+    }
+
+    if(reader_is(t, "maximize") || reader_is(t, "maximum") || reader_is(t, "max")
+       || reader_is(t, "minimize") || reader_is(t, "minimum") || reader_is(t, "min"))
+    {
+        *section = SECTION_OBJECTIVE;
+    }
+    else if(reader_is(t, "subject") || reader_is(t, "such"))
+    {
+        next = *lexer;
+        lexer_next(&next);
+        if(next.type != LEXER_NAME || !(reader_is(next.token, "to") || reader_is(next.token, "that")))
+        {
+            return 0;
+        }
+        *lexer = next;
+        *section = SECTION_CONSTRAINTS;
+    }
+    else if(reader_is(t, "st") || reader_is(t, "s.t.") || reader_is(t, "st."))
+    {
+        *section = SECTION_CONSTRAINTS;
+    }
+    else if(reader_is(t, "bounds") || reader_is(t, "bound"))
+    {
+        *section = SECTION_BOUNDS;
+    }
+    else if(reader_is(t, "general") || reader_is(t, "generals") || reader_is(t, "gen")
+            || reader_is(t, "integer") || reader_is(t, "integers"))
+    {
+        *section = SECTION_GENERAL;
+    }
+    else if(reader_is(t, "binary") || reader_is(t, "binaries") || reader_is(t, "bin"))
+    {
+        *section = SECTION_BINARY;
+    }
+    else if(reader_is(t, "end"))
+    {
+        *section = SECTION_END;
+    }
+    else
+    {
+        return 0;
+    }
+
+    next = *lexer;
+    lexer_next(&next);
+    if(next.type == LEXER_COLON) /* "bounds:" is a label, not a section. */
+    {
+        return 0;
+    }
+
+    return 1;
+}
+
+static int lexer_is_term(struct Lexer *lexer)
+{
+    struct Lexer next;
+    enum LpSection section;
+
+    if(lexer->type == LEXER_PLUS || lexer->type == LEXER_MINUS || lexer->type == LEXER_NUMBER)
+    {
+        return 1;
+    }
+    if(lexer->type != LEXER_NAME)
+    {
+        return 0;
+    }
+
+    next = *lexer;
+    if(next.lineStart && lexer_section(&next, &section))
+    {
+        return 0;
+    }
+    next = *lexer;
+    lexer_next(&next);
+
+    return next.type != LEXER_COLON;
+}
+
+static int lexer_expression(struct Lexer *lexer, struct LpModel *model, struct ReaderNames *table, int row, struct Rational *constant)
+{
+    struct Rational coefficient;
+    int sign, j, number;
+
+    while(lexer_is_term(lexer))
+    {
+        sign = 1;
+        number = 0;
+        coefficient.n = 1;
+        coefficient.d = 1;
+
+        while(lexer->type == LEXER_PLUS || lexer->type == LEXER_MINUS)
+        {
+            sign = (lexer->type == LEXER_MINUS) ? -sign : sign;
+            lexer_next(lexer);
+        }
+        if(lexer->type == LEXER_NUMBER)
+        {
+            if(lexer->infinite)
+            {
+                return 0;
+            }
+            coefficient = lexer->value;
+            number = 1;
+            lexer_next(lexer);
+        }
+        coefficient.n *= sign;
+
+        if(lexer->type == LEXER_NAME && lexer_is_term(lexer))
+        {
+            j = reader_variable(model, table, lexer->token);
+            if(j < 0)
+            {
+                return 0;
+            }
+            if(row < 0)
+            {
+                model->cost[j] = rational_sum(model->cost[j], coefficient);
+            }
+            else if(lp_model_add_entry(model, row, j, coefficient) != 0)
+            {
+                table->failed = 1;
+                return 0;
+            }
+            lexer_next(lexer);
+        }
+        else if(number)
+        {
+            *constant = rational_sum(*constant, coefficient);
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static int lexer_number(struct Lexer *lexer, struct Rational *value, int *infinite)
+{
+    int sign = 1;
+
+    *infinite = 0;
+    while(lexer->type == LEXER_PLUS || lexer->type == LEXER_MINUS)
+    {
+        sign = (lexer->type == LEXER_MINUS) ? -sign : sign;
+        lexer_next(lexer);
+    }
+
+    if(lexer->type == LEXER_NUMBER)
+    {
+        *value = lexer->value;
+        value->n *= sign;
+        *infinite = sign * lexer->infinite;
+        lexer_next(lexer);
+        return 1;
+    }
+
+    if(lexer->type == LEXER_NAME && (reader_is(lexer->token, "inf") || reader_is(lexer->token, "infinity")))
+    {
+        *infinite = sign;
+        lexer_next(lexer);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int lexer_bound(struct Lexer *lexer, struct LpModel *model, struct ReaderNames *table)
+{
+    struct Rational value;
+    enum LexerType op;
+    int j, infinite;
+
+    if(lexer->type == LEXER_NAME && !(reader_is(lexer->token, "inf") || reader_is(lexer->token, "infinity")))
+    {
+        j = reader_variable(model, table, lexer->token);
+        if(j < 0)
+        {
+            return 0;
+        }
+        lexer_next(lexer);
+        if(lexer->type == LEXER_NAME && reader_is(lexer->token, "free"))
+        {
+            model->bounded[j] = 0;
+            lexer_next(lexer);
+            return 1;
+        }
+        op = lexer->type;
+        if(op != LEXER_LESS && op != LEXER_GREATER && op != LEXER_EQUAL)
+        {
+            return 0;
+        }
+        lexer_next(lexer);
+        if(!lexer_number(lexer, &value, &infinite))
+        {
+            return 0;
+        }
+        reader_set_bound(model, j, op, value, infinite);
+        return 1;
+    }
+
+    if(!lexer_number(lexer, &value, &infinite)) /* value op x [op value] */
+    {
+        return 0;
+    }
+    op = lexer->type;
+    if((op != LEXER_LESS && op != LEXER_GREATER && op != LEXER_EQUAL))
+    {
+        return 0;
+    }
+    lexer_next(lexer);
+    if(lexer->type != LEXER_NAME)
+    {
+        return 0;
+    }
+    j = reader_variable(model, table, lexer->token);
+    if(j < 0)
+    {
+        return 0;
+    }
+    reader_set_bound(model, j, (op == LEXER_LESS) ? LEXER_GREATER : ((op == LEXER_GREATER) ? LEXER_LESS : LEXER_EQUAL), value, infinite);
+    lexer_next(lexer);
+
+    if(lexer->type == op && op != LEXER_EQUAL)
+    {
+        lexer_next(lexer);
+        if(!lexer_number(lexer, &value, &infinite))
+        {
+            return 0;
+        }
+        reader_set_bound(model, j, op, value, infinite);
+    }
+
+    return 1;
+}
@@ -0,0 +1,99 @@
+/**
+ * @brief Header file for lp reader.
+ *
+ * This file describes the readers for problem files in free MPS format and
+ * CPLEX LP format. The readers parse the input in one pass into a sparse
+ * LpModel, which lp_model_to_tableau converts into a tableau.
+ *
+ * @file lp_reader.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef LP_READER_H
+#define LP_READER_H LP_READER_H
+
+#include <stddef.h>
+
+#include "lp_model.h"
+
+/**
+ * @brief Error of a reader.
+ *
+ * This structure describes why a file could not be read.
+ */
+struct LpReadError
+{
+    int line; /**< Line of the error, 0 if not related to a line. */
+    char message[128]; /**< Description of the error. */
+};
+
+/**
+ * @brief Read problem in free MPS format.
+ *
+ * This function parses the given characters as free MPS file with the sections
+ * NAME, OBJSENSE, ROWS, COLUMNS, RHS, RANGES, BOUNDS and ENDATA. Integer
+ * markers are ignored. The data does not need to be terminated by '\0'.
+ *
+ * @param data
+ *    content of the file
+ * @param length
+ *    number of characters
+ * @param error
+ *    description of the error if NULL is returned, may be NULL
+ * @return new model or NULL if the data is invalid
+ */
+struct LpModel *lp_read_mps(const char *data, size_t length, struct LpReadError *error);
+
+/**
+ * @brief Read problem in CPLEX LP format.
+ *
+ * This function parses the given characters as LP file with the sections
+ * objective (maximize/minimize), subject to, bounds, general, binary and end.
+ * Integrality is ignored, binary variables get the bounds 0 and 1. The data
+ * does not need to be terminated by '\0'.
+ *
+ * @param data
+ *    content of the file
+ * @param length
+ *    number of characters
+ * @param error
+ *    description of the error if NULL is returned, may be NULL
+ * @return new model or NULL if the data is invalid
+ */
+struct LpModel *lp_read_lp(const char *data, size_t length, struct LpReadError *error);
+
+/**
+ * @brief Read problem in MPS or LP format.
+ *
+ * This function detects the format from the first section name, i.e. NAME or
+ * ROWS for MPS files, and parses the given characters. Comment lines before
+ * the first section are skipped.
+ *
+ * @param data
+ *    content of the file
+ * @param length
+ *    number of characters
+ * @param error
+ *    description of the error if NULL is returned, may be NULL
+ * @return new model or NULL if the data is invalid
+ */
+struct LpModel *lp_read(const char *data, size_t length, struct LpReadError *error);
+
+/**
+ * @brief Read problem file.
+ *
+ * This function maps the given file into memory and parses it. The path "-"
+ * reads from stdin. Files ending with ".mps" are read as MPS files, files
+ * ending with ".lp" as LP files, otherwise the format is detected from the
+ * first section name.
+ *
+ * @param path
+ *    path of file or "-"
+ * @param error
+ *    description of the error if NULL is returned, may be NULL
+ * @return new model or NULL if the file could not be read
+ */
+struct LpModel *lp_read_file(const char *path, struct LpReadError *error);
+
+#endif
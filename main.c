@@ -1,7 +1,13 @@
 /**
  * @brief Little program using simplex algorithm.
  *
- * This file implements a little example using the simplex algorithm.
+ * This file implements a little example using the simplex algorithm. Given
+ * problem files or directories it solves them in parallel instead and prints
+ * one result line per problem, see batch_solve.
+ *
+ * Usage: main [--threads N] [--quiet] [FILE|DIRECTORY]...
+ *   --threads N   number of worker threads, number of cores by default
+ *   --quiet       do not print the final tableaus to stderr
  *
  * @file rational_test.c
  * @author Thomas Irgang
@@ -14,6 +20,7 @@
 #include <time.h>
 
 #include "simplex.h"
+#include "batch.h"
 
 /**
  * @brief Create tableau with example problem.
@@ -36,11 +43,68 @@ struct Tableau *create_testproblem_tableau(void);
  *
  * This function solves the little example problem using
  * phase 1 and 2 of simplex algorithm.
+ *
+ * @return EXIT_SUCCESS
+ */
+int run_example(void);
+
+/**
+ * @brief Solve example problem or problem files.
+ *
+ * @param argc
+ *    number of arguments
+ * @param argv
+ *    arguments
+ * @return EXIT_SUCCESS or EXIT_FAILURE if a file could not be read
  */
-int main(void)
+int main(int argc, char **argv)
+{
+    struct BatchFiles files;
+    int i, threads = 0, quiet = 0;
+    long failed = 0;
+
+    if(argc == 1)
+    {
+        return run_example();
+    }
+
+    batch_files_init(&files);
+    for(i=1; i<argc; ++i)
+    {
+        if(strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+        {
+            threads = atoi(argv[++i]);
+        }
+        else if(strcmp(argv[i], "--quiet") == 0)
+        {
+            quiet = 1;
+        }
+        else if(batch_files_add(&files, argv[i]) != 0)
+        {
+            fprintf(stderr, "Can not add %s\n", argv[i]);
+            ++failed;
+        }
+    }
+
+    failed += batch_solve(&files, threads, stdout, quiet ? NULL : stderr);
+    batch_files_free(&files);
+
+    return (failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int run_example(void)
 {
     struct Tableau *tableau = NULL, *phase1 = NULL; /* variables for tableaus */
     clock_t start, s_p1, e_p1, s_prep = 0, e_prep = 0, s_p2 = 0, e_p2 = 0, end, calc; /* variables for time */
+    struct SimplexStats stats; /* profiling counters */
+    struct SimplexLog log; /* log of the solve functions */
+    char json[512];
+    int failed = 0;
+
+    stats_reset(&stats);
+    stats_bind(&stats); /* Count all operations of this thread. */
+    simplex_log_init(&log, SIMPLEX_LOG_TABLEAU, simplex_log_file_sink, stdout);
+    simplex_log_bind(&log); /* Print tableaus of the solve functions to stdout. */
 
     start = clock();
 
@@ -51,26 +115,44 @@ int main(void)
 
     printf("Run simplex phase 1 ...\n");
     s_p1 = clock();
+    stats.phase = 1;
     phase1 = simplex_find_start_corner(tableau); /* Calculate start corner for phase 2 of simplex algorithm. */
     e_p1 = clock();
-    simplex_print_tableau(phase1); /* Print solved, extended tableau. */
-    printf("Solution of phase 1:\n");
-    simplex_print_solution(phase1); /* Print solution of phase 1. */
+    if(phase1 == NULL)
+    {
+        failed = 1;
+    }
+    else
+    {
+        simplex_print_tableau(phase1); /* Print solved, extended tableau. */
+        printf("Solution of phase 1:\n");
+        simplex_print_solution(phase1); /* Print solution of phase 1. */
+    }
 
-    if((phase1->z)->n == 0)
+    if(!failed && (phase1->z)->n == 0)
     {
         printf("Phase 1 found a start corner for phase 2.\n");
         printf("Prepare tableau for phase 2 ...\n");
         s_prep = clock();
-        prepare_with_start_corner(phase1, tableau); /* Update tableau with found solution of phase 1. */
+        stats.phase = 0;
+        failed = prepare_with_start_corner(phase1, tableau) != 0; /* Update tableau with found solution of phase 1. */
         e_prep = clock();
+    }
+
+    if(!failed && (phase1->z)->n == 0)
+    {
         printf("Tableau updated for phase 2:\n");
         simplex_print_tableau(tableau); /* Print tableau used for phase 2 of simplex algorithm. */
 
         printf("Run simplex phase 2 ...\n");
         s_p2 = clock();
-        simplex_find_best_solution(tableau); /* Phase 2: Find best solution for problem. */
+        stats.phase = 2;
+        failed = simplex_find_best_solution(tableau) != 0; /* Phase 2: Find best solution for problem. */
         e_p2 = clock();
+    }
+
+    if(!failed && (phase1->z)->n == 0)
+    {
         simplex_print_tableau(tableau); /* Print final tableau of phase 2. */
         printf("Best solution of problem: ");
         simplex_print_solution(tableau); /* Print best solution of problem. */
@@ -82,7 +164,7 @@ int main(void)
     printf("Total time: %f ms\n", (double)(calc*1000)/CLOCKS_PER_SEC);
     calc = (double)(e_p1 - s_p1);
 
-    if((phase1->z)->n == 0)
+    if(!failed && (phase1->z)->n == 0)
     {
       printf("Simplex phase 1: %f ms\n", (double)(calc*1000)/CLOCKS_PER_SEC);
       calc = (double)(e_prep - s_prep);
@@ -91,10 +173,22 @@ int main(void)
       printf("Simplex phase 2: %f ms\n", (double)(calc*1000)/CLOCKS_PER_SEC);
     }
 
+    stats_bind(NULL);
+    simplex_log_bind(NULL);
+    simplex_log_free(&log);
+    stats_to_json(&stats, json, sizeof(json));
+    printf("Profiling counters: %s\n", json);
+
     printf("Free tableau memory ...\n");
     simplex_free_tableau(phase1); /* Free memory of tableaus. */
     simplex_free_tableau(tableau);
 
+    if(failed)
+    {
+        fprintf(stderr, ERROR_MALLOC_FAILED);
+        return EXIT_FAILURE;
+    }
+
     return EXIT_SUCCESS;
 }
 
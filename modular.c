@@ -0,0 +1,469 @@
+/**
+ * @brief Source file for modular.
+ *
+ * This file implements the multi-modular solve of linear equation systems.
+ *
+ * @file modular.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "modular.h"
+
+const uint64_t modular_primes[MODULAR_PRIMES] =
+{
+    4611686018427387847ULL, 4611686018427387817ULL, 4611686018427387787ULL, 4611686018427387761ULL,
+    4611686018427387751ULL, 4611686018427387737ULL, 4611686018427387733ULL, 4611686018427387709ULL
+};
+
+/**
+ * @brief Solution of a system modulo one prime.
+ */
+struct ModularImage
+{
+    int n; /**< Number of unknowns. */
+    const struct Rational *matrix; /**< Matrix of system. */
+    const struct Rational *rhs; /**< Limits of system. */
+    int prime; /**< Index of prime in modular_primes, -1 if no prime is left. */
+    uint64_t *values; /**< Solution modulo the prime. */
+    int regular; /**< 1 if the matrix is regular modulo the prime, -1 if no memory was left. */
+};
+
+/**
+ * @brief Multiply modulo a prime.
+ *
+ * @param a
+ *    first factor below p
+ * @param b
+ *    second factor below p
+ * @param p
+ *    prime
+ * @return a * b mod p
+ */
+static uint64_t mod_multiply(uint64_t a, uint64_t b, uint64_t p);
+
+/**
+ * @brief Invert modulo a prime.
+ *
+ * @param a
+ *    number between 1 and p - 1
+ * @param p
+ *    prime
+ * @return number b with a * b = 1 mod p
+ */
+static uint64_t mod_invert(uint64_t a, uint64_t p);
+
+/**
+ * @brief Map a rational number to its residue modulo a prime.
+ *
+ * @param r
+ *    number to map, the denominator is not divisible by p
+ * @param p
+ *    prime
+ * @return n / d mod p
+ */
+static uint64_t mod_rational(struct Rational r, uint64_t p);
+
+/**
+ * @brief Solve a system modulo the prime of an image.
+ *
+ * This function runs the gaussian elimination on the system modulo the prime
+ * of the given image and sets its values and regular flag. If no memory is
+ * left, the regular flag is -1.
+ *
+ * @param data
+ *    ModularImage to compute
+ */
+static void image_solve(void *data);
+
+/**
+ * @brief Compute the image of the next usable prime.
+ *
+ * @param image
+ *    image to compute
+ * @param next
+ *    index of next unused prime, updated
+ * @return 1 if an image was computed, 0 if no regular prime is left, -1 if no memory is left
+ */
+static int image_next(struct ModularImage *image, int *next);
+
+/**
+ * @brief Reconstruct a rational number from its residue.
+ *
+ * This function searches n / d = u mod m with |n| <= bound and 0 < d <= bound
+ * by the extended euclidean algorithm. The result is unique if 2 bound^2 < m.
+ *
+ * @param u
+ *    residue
+ * @param m
+ *    modulus
+ * @param bound
+ *    limit for numerator and denominator
+ * @param r
+ *    reconstructed number
+ * @return 1 if a number was found, 0 else
+ */
+static int reconstruct(__int128 u, __int128 m, __int128 bound, struct Rational *r);
+
+/**
+ * @brief Check reconstructed numbers with an image.
+ *
+ * @param x
+ *    reconstructed numbers
+ * @param image
+ *    image of a prime which was not used for the reconstruction
+ * @return 1 if all numbers match the image, 0 else
+ */
+static int image_matches(const struct Rational *x, const struct ModularImage *image);
+
+int modular_solve(int n, const struct Rational *matrix, const struct Rational *rhs, struct Rational *x,
+                  struct ThreadPool *pool)
+{
+    struct ModularImage images[3];
+    uint64_t p0, p1;
+    __int128 m, u, bound, half;
+    int i, next = 2, found = 0;
+
+    for(i=0; i<3; ++i)
+    {
+        images[i].n = n;
+        images[i].matrix = matrix;
+        images[i].rhs = rhs;
+        images[i].prime = (i < 2) ? i : -1;
+        images[i].regular = 0;
+        images[i].values = (uint64_t *)malloc((n > 0 ? n : 1) * sizeof(uint64_t));
+        if(images[i].values == NULL)
+        {
+            found = -1;
+        }
+    }
+    if(found < 0)
+    {
+        goto done;
+    }
+
+    if(pool != NULL) /* The first two images are always needed. */
+    {
+        thread_pool_submit(pool, image_solve, &(images[0]));
+        thread_pool_submit(pool, image_solve, &(images[1]));
+        thread_pool_wait(pool);
+    }
+    else
+    {
+        image_solve(&(images[0]));
+        image_solve(&(images[1]));
+    }
+
+    if(images[0].regular < 0 || images[1].regular < 0)
+    {
+        found = -1;
+        goto done;
+    }
+    if(!images[0].regular && !images[1].regular) /* A singular matrix is singular for all primes. */
+    {
+        goto done;
+    }
+    for(i=0; i<2; ++i)
+    {
+        if(!images[i].regular && (found = image_next(&(images[i]), &next)) <= 0) /* 0 or out of memory. */
+        {
+            goto done;
+        }
+    }
+    found = 0;
+
+    p0 = modular_primes[images[0].prime];
+    p1 = modular_primes[images[1].prime];
+
+    half = p0 / 2; /* Early termination: small values are found with one prime, bound = sqrt(p0 / 2). */
+    for(bound=half, u=(bound + half / bound) / 2; u < bound; u=(bound + half / bound) / 2)
+    {
+        bound = u;
+    }
+    for(i=0; i<n; ++i)
+    {
+        if(!reconstruct(images[0].values[i], p0, bound, &(x[i])))
+        {
+            break;
+        }
+    }
+    if(i == n && image_matches(x, &(images[1])))
+    {
+        found = 1;
+        goto done;
+    }
+
+    if((found = image_next(&(images[2]), &next)) <= 0)
+    {
+        goto done;
+    }
+    found = 0;
+
+    m = (__int128)p0 * p1;
+    for(i=0; i<n; ++i) /* u = v0 + p0 * ((v1 - v0) / p0 mod p1) */
+    {
+        u = (__int128)((images[1].values[i] + p1 - images[0].values[i] % p1) % p1);
+        u = mod_multiply((uint64_t)u, mod_invert(p0 % p1, p1), p1);
+        u = images[0].values[i] + (__int128)p0 * u;
+        if(!reconstruct(u, m, INT_MAX, &(x[i])))
+        {
+            goto done;
+        }
+    }
+    found = image_matches(x, &(images[2]));
+
+done:
+    for(i=0; i<3; ++i)
+    {
+        free(images[i].values);
+    }
+
+    return found;
+}
+
+int modular_basis_solution(struct Tableau *tableau, const int *basis, struct Rational *values,
+                           struct ThreadPool *pool)
+{
+    struct Rational *matrix, *rhs, *x;
+    int *position;
+    int i, k, rows = tableau->rows, variables = tableau->rows + tableau->cols, found;
+
+    matrix = (struct Rational *)calloc((size_t)rows * rows + 1, sizeof(struct Rational));
+    rhs = (struct Rational *)malloc((rows + 1) * sizeof(struct Rational));
+    x = (struct Rational *)malloc((rows + 1) * sizeof(struct Rational));
+    position = (int *)malloc(variables * sizeof(int));
+    if(matrix == NULL || rhs == NULL || x == NULL || position == NULL)
+    {
+        free(matrix);
+        free(rhs);
+        free(x);
+        free(position);
+        return -1;
+    }
+
+    for(i=0; i<tableau->rows; ++i) /* x_B + A x_N = b: unit columns for the basis variables of the tableau. */
+    {
+        position[tableau->bvs[i]] = -1 - i;
+        rhs[i] = *(tableau->b[i]);
+    }
+    for(i=0; i<tableau->cols; ++i)
+    {
+        position[tableau->nbvs[i]] = i;
+    }
+
+    for(k=0; k<rows; ++k)
+    {
+        for(i=0; i<rows; ++i)
+        {
+            matrix[(size_t)i * rows + k].d = 1;
+            if(position[basis[k]] >= 0)
+            {
+                matrix[(size_t)i * rows + k] = *(tableau->A[i][position[basis[k]]]);
+            }
+        }
+        if(position[basis[k]] < 0)
+        {
+            matrix[(size_t)(-1 - position[basis[k]]) * rows + k].n = 1;
+        }
+    }
+
+    found = modular_solve(rows, matrix, rhs, x, pool);
+    if(found > 0)
+    {
+        for(i=0; i<variables; ++i)
+        {
+            values[i].n = 0;
+            values[i].d = 1;
+        }
+        for(k=0; k<rows; ++k)
+        {
+            values[basis[k]] = x[k];
+        }
+    }
+
+    free(matrix);
+    free(rhs);
+    free(x);
+    free(position);
+
+    return found;
+}
+
+static uint64_t mod_multiply(uint64_t a, uint64_t b, uint64_t p)
+{
+    return (uint64_t)(((unsigned __int128)a * b) % p);
+}
+
+static uint64_t mod_invert(uint64_t a, uint64_t p)
+{
+    uint64_t result = 1, e = p - 2;
+
+    while(e > 0) /* Fermat: a^(p-2) = a^-1 mod p. */
+    {
+        if(e & 1)
+        {
+            result = mod_multiply(result, a, p);
+        }
+        a = mod_multiply(a, a, p);
+        e >>= 1;
+    }
+
+    return result;
+}
+
+static uint64_t mod_rational(struct Rational r, uint64_t p)
+{
+    uint64_t n, d;
+
+    n = (r.n < 0) ? p - (uint64_t)(-(long long)r.n) % p : (uint64_t)r.n % p;
+    d = (r.d < 0) ? p - (uint64_t)(-(long long)r.d) % p : (uint64_t)r.d % p;
+
+    return mod_multiply(n % p, mod_invert(d, p), p);
+}
+
+static void image_solve(void *data)
+{
+    struct ModularImage *image = (struct ModularImage *)data;
+    uint64_t *a, p, factor, inverse, temp;
+    int n = image->n, stride = image->n + 1;
+    int i, j, k, pivot;
+
+    p = modular_primes[image->prime];
+    a = (uint64_t *)malloc(((size_t)n * stride + 1) * sizeof(uint64_t));
+    if(a == NULL)
+    {
+        image->regular = -1;
+        return;
+    }
+    for(i=0; i<n; ++i)
+    {
+        for(j=0; j<n; ++j)
+        {
+            a[(size_t)i * stride + j] = mod_rational(image->matrix[(size_t)i * n + j], p);
+        }
+        a[(size_t)i * stride + n] = mod_rational(image->rhs[i], p);
+    }
+
+    image->regular = 1;
+    for(k=0; k<n && image->regular; ++k)
+    {
+        for(pivot=k; pivot<n && a[(size_t)pivot * stride + k] == 0; ++pivot);
+        if(pivot == n)
+        {
+            image->regular = 0;
+            break;
+        }
+        if(pivot != k)
+        {
+            for(j=k; j<stride; ++j)
+            {
+                temp = a[(size_t)k * stride + j];
+                a[(size_t)k * stride + j] = a[(size_t)pivot * stride + j];
+                a[(size_t)pivot * stride + j] = temp;
+            }
+        }
+
+        inverse = mod_invert(a[(size_t)k * stride + k], p);
+        for(j=k; j<stride; ++j)
+        {
+            a[(size_t)k * stride + j] = mod_multiply(a[(size_t)k * stride + j], inverse, p);
+        }
+        for(i=0; i<n; ++i)
+        {
+            factor = a[(size_t)i * stride + k];
+            if(i == k || factor == 0)
+            {
+                continue;
+            }
+            for(j=k; j<stride; ++j)
+            {
+                temp = mod_multiply(factor, a[(size_t)k * stride + j], p);
+                a[(size_t)i * stride + j] = (a[(size_t)i * stride + j] + p - temp) % p;
+            }
+        }
+    }
+
+    for(i=0; i<n && image->regular; ++i)
+    {
+        image->values[i] = a[(size_t)i * stride + n];
+    }
+
+    free(a);
+}
+
+static int image_next(struct ModularImage *image, int *next)
+{
+    while(*next < MODULAR_PRIMES)
+    {
+        image->prime = (*next)++;
+        image_solve(image);
+        if(image->regular != 0)
+        {
+            return image->regular;
+        }
+    }
+
+    return 0;
+}
+
+static int reconstruct(__int128 u, __int128 m, __int128 bound, struct Rational *r)
+{
+    __int128 r0 = m, r1 = u % m, t0 = 0, t1 = 1, q, temp;
+
+    while(r1 > bound)
+    {
+        q = r0 / r1;
+        temp = r0 - q * r1;
+        r0 = r1;
+        r1 = temp;
+        temp = t0 - q * t1;
+        t0 = t1;
+        t1 = temp;
+    }
+
+    if(t1 < 0)
+    {
+        r1 = -r1;
+        t1 = -t1;
+    }
+    if(t1 == 0 || t1 > bound)
+    {
+        return 0;
+    }
+
+    for(r0=(r1 < 0) ? -r1 : r1, q=t1; q != 0; ) /* gcd(n, d) must be 1. */
+    {
+        temp = r0 % q;
+        r0 = q;
+        q = temp;
+    }
+    if(r0 != 1)
+    {
+        return 0;
+    }
+
+    r->n = (int)r1;
+    r->d = (int)t1;
+
+    return 1;
+}
+
+static int image_matches(const struct Rational *x, const struct ModularImage *image)
+{
+    uint64_t p = modular_primes[image->prime];
+    int i;
+
+    for(i=0; i<image->n; ++i)
+    {
+        if(mod_rational(x[i], p) != image->values[i])
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
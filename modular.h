@@ -0,0 +1,78 @@
+/**
+ * @brief Header file for modular.
+ *
+ * This file describes the exact solve of linear equation systems with modular
+ * arithmetic. The system is solved modulo 62 bit primes, the results are
+ * combined with the chinese remainder theorem and the rational solution is
+ * recovered by rational reconstruction.
+ *
+ * @file modular.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef MODULAR_H
+#define MODULAR_H MODULAR_H
+
+#include <stdint.h>
+
+#include "rational.h"
+#include "simplex.h"
+#include "thread_pool.h"
+
+#define MODULAR_PRIMES 8 /**< Number of available primes. */
+
+/**
+ * @brief Primes below 2^62 used for the images of a system.
+ */
+extern const uint64_t modular_primes[MODULAR_PRIMES];
+
+/**
+ * @brief Solve a linear equation system exactly.
+ *
+ * This function solves Ax = b for a regular n x n matrix A. The first image
+ * modulo one prime is reconstructed with numerator and denominator below
+ * sqrt(p/2) and accepted if it matches the image of a second prime. Otherwise
+ * both images are combined and reconstructed with numerator and denominator of
+ * int range, which is checked with a third prime. Primes for which the matrix
+ * is singular are skipped.
+ *
+ * @param n
+ *    number of equations and unknowns
+ * @param matrix
+ *    n x n matrix A, stored line by line
+ * @param rhs
+ *    vector b
+ * @param x
+ *    array for the n values of the solution
+ * @param pool
+ *    pool to compute the first two images in parallel, may be NULL
+ * @return 1 if the solution was found, 0 if A is singular or the solution does not fit into Rational,
+ *    -1 if no memory is left
+ */
+int modular_solve(int n, const struct Rational *matrix, const struct Rational *rhs, struct Rational *x,
+                  struct ThreadPool *pool);
+
+/**
+ * @brief Calculate the exact values of a basis.
+ *
+ * This function calculates the values of all variables for the given basis
+ * from a tableau of the problem, e.g. the start tableau of a solve, without
+ * pivoting it. The basis matrix is built from the columns of the none basis
+ * variables and the unit columns of the basis variables of the tableau.
+ *
+ * @param tableau
+ *    tableau of problem, not changed
+ * @param basis
+ *    tableau->rows variables of the basis
+ * @param values
+ *    array for the values of the tableau->rows + tableau->cols variables, indexed by variable
+ * @param pool
+ *    pool to compute images in parallel, may be NULL
+ * @return 1 if the values were found, 0 if the basis is singular or a value does not fit into Rational,
+ *    -1 if no memory is left
+ */
+int modular_basis_solution(struct Tableau *tableau, const int *basis, struct Rational *values,
+                           struct ThreadPool *pool);
+
+#endif
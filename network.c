@@ -0,0 +1,623 @@
+/**
+ * @brief Source file for network.
+ *
+ * This file implements the network simplex algorithm.
+ *
+ * @file network.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+
+#include "network.h"
+
+/**
+ * @brief Find the arc of a tableau column.
+ *
+ * This function checks that the column has at most one +1 and one -1 entry
+ * and 0 else.
+ *
+ * @param tableau
+ *    tableau to check
+ * @param column
+ *    column to check
+ * @param root
+ *    node for missing entries
+ * @param from
+ *    line of the +1 entry or root
+ * @param to
+ *    line of the -1 entry or root
+ * @return 1 if the column is an arc, 0 else
+ */
+static int column_arc(struct Tableau *tableau, int column, int root, int *from, int *to);
+
+/**
+ * @brief Allocate an array.
+ *
+ * This function does nothing if failed is already set, so several arrays can
+ * be allocated before the flag is checked once.
+ *
+ * @param count
+ *    number of elements
+ * @param size
+ *    size of an element
+ * @param failed
+ *    set to 1 if no memory is left
+ * @return new zero-filled array or NULL
+ */
+static void *network_alloc(int count, size_t size, int *failed);
+
+/**
+ * @brief Add a node as first child.
+ *
+ * @param network
+ *    network to change
+ * @param node
+ *    node without parent
+ * @param parent
+ *    new parent of node
+ */
+static void tree_attach(struct Network *network, int node, int parent);
+
+/**
+ * @brief Remove a node from the children of its parent.
+ *
+ * @param network
+ *    network to change
+ * @param node
+ *    node to remove
+ */
+static void tree_detach(struct Network *network, int node);
+
+/**
+ * @brief Update depth and potential of a subtree.
+ *
+ * @param network
+ *    network to change
+ * @param top
+ *    root of subtree with valid parent links
+ */
+static void tree_update(struct Network *network, int top);
+
+/**
+ * @brief Choose the entering arc.
+ *
+ * This function prices the arcs in blocks, starting after the last chosen
+ * block, and returns the arc with the most negative reduced cost of the first
+ * block which has one.
+ *
+ * @param network
+ *    network to check
+ * @return entering arc or -1 if the flow is optimal
+ */
+static int network_price(struct Network *network);
+
+/**
+ * @brief Exchange a tree arc.
+ *
+ * This function pushes flow around the cycle of the entering arc and replaces
+ * the last blocking arc of the cycle, which keeps the tree strongly feasible.
+ *
+ * @param network
+ *    network to change
+ * @param entering
+ *    arc with negative reduced cost
+ * @return 1 if done, 0 if the cycle has no blocking arc, i.e. the problem is unbounded
+ */
+static int network_pivot(struct Network *network, int entering);
+
+/**
+ * @brief Pivot until the flow is optimal.
+ *
+ * @param network
+ *    network to solve with valid potentials
+ * @return 1 if the flow is optimal, 0 if the problem is unbounded
+ */
+static int network_run(struct Network *network);
+
+struct Network *network_create(struct Tableau *tableau)
+{
+    struct Network *network;
+    long long supply, total = 0, largest = 0;
+    int i, j, k, from, to, root = tableau->rows, artificial = tableau->rows + 1, failed = 0;
+
+    if(tableau->artificials < tableau->rows + tableau->cols)
+    {
+        return NULL;
+    }
+    for(i=0; i<tableau->rows; ++i)
+    {
+        if((tableau->b[i])->d != 1)
+        {
+            return NULL;
+        }
+        total += (tableau->b[i])->n;
+    }
+    for(j=0; j<tableau->cols; ++j)
+    {
+        if((tableau->c[j])->d != 1 || !column_arc(tableau, j, root, &from, &to))
+        {
+            return NULL;
+        }
+        largest = (llabs((tableau->c[j])->n) > largest) ? llabs((tableau->c[j])->n) : largest;
+    }
+
+    network = (struct Network *)malloc(sizeof(struct Network));
+    if(network == NULL)
+    {
+        return NULL;
+    }
+    network->nodes = tableau->rows + 2;
+    network->arcs = tableau->cols + tableau->rows + network->nodes - 1;
+    network->variables = tableau->rows + tableau->cols;
+    network->offset.n = -((tableau->z)->n);
+    network->offset.d = (tableau->z)->d;
+    network->from = (int *)network_alloc(network->arcs, sizeof(int), &failed);
+    network->to = (int *)network_alloc(network->arcs, sizeof(int), &failed);
+    network->cost = (long long *)network_alloc(network->arcs, sizeof(long long), &failed);
+    network->flow = (long long *)network_alloc(network->arcs, sizeof(long long), &failed);
+    network->variable = (int *)network_alloc(network->arcs, sizeof(int), &failed);
+    network->inTree = (int *)network_alloc(network->arcs, sizeof(int), &failed);
+    network->parent = (int *)network_alloc(network->nodes, sizeof(int), &failed);
+    network->parentArc = (int *)network_alloc(network->nodes, sizeof(int), &failed);
+    network->depth = (int *)network_alloc(network->nodes, sizeof(int), &failed);
+    network->firstChild = (int *)network_alloc(network->nodes, sizeof(int), &failed);
+    network->nextSibling = (int *)network_alloc(network->nodes, sizeof(int), &failed);
+    network->prevSibling = (int *)network_alloc(network->nodes, sizeof(int), &failed);
+    network->potential = (long long *)network_alloc(network->nodes, sizeof(long long), &failed);
+    if(failed)
+    {
+        network_free(network);
+        return NULL;
+    }
+    network->block = (int)sqrt((double)network->arcs);
+    network->block = (network->block < 10) ? 10 : network->block;
+    network->next = 0;
+    network->pivots = 0;
+
+    k = 0;
+    for(j=0; j<tableau->cols; ++j) /* Maximize cx: minimize -cx. */
+    {
+        column_arc(tableau, j, root, &(network->from[k]), &(network->to[k]));
+        network->cost[k] = -(long long)(tableau->c[j])->n;
+        network->variable[k++] = tableau->nbvs[j];
+    }
+    for(i=0; i<tableau->rows; ++i)
+    {
+        network->from[k] = i;
+        network->to[k] = root;
+        network->variable[k++] = tableau->bvs[i];
+    }
+
+    for(i=0; i<network->nodes; ++i)
+    {
+        network->firstChild[i] = -1;
+        network->nextSibling[i] = -1;
+        network->prevSibling[i] = -1;
+    }
+    network->parent[artificial] = -1;
+    network->parentArc[artificial] = -1;
+    network->depth[artificial] = 0;
+    network->potential[artificial] = 0;
+
+    largest = (largest + 1) * network->nodes; /* Cost of artificial arcs exceeds the cost of each path. */
+    for(i=0; i<=root; ++i) /* Start tree: artificial arcs, arcs with flow 0 point away from the root. */
+    {
+        supply = (i < root) ? (tableau->b[i])->n : -total;
+        network->variable[k] = -1;
+        network->cost[k] = largest;
+        network->inTree[k] = 1;
+        if(supply > 0)
+        {
+            network->from[k] = i;
+            network->to[k] = artificial;
+            network->flow[k] = supply;
+            network->potential[i] = -largest;
+        }
+        else
+        {
+            network->from[k] = artificial;
+            network->to[k] = i;
+            network->flow[k] = -supply;
+            network->potential[i] = largest;
+        }
+        network->parent[i] = artificial;
+        network->parentArc[i] = k++;
+        network->depth[i] = 1;
+        tree_attach(network, i, artificial);
+    }
+
+    return network;
+}
+
+void network_free(struct Network *network)
+{
+    free(network->from);
+    free(network->to);
+    free(network->cost);
+    free(network->flow);
+    free(network->variable);
+    free(network->inTree);
+    free(network->parent);
+    free(network->parentArc);
+    free(network->depth);
+    free(network->firstChild);
+    free(network->nextSibling);
+    free(network->prevSibling);
+    free(network->potential);
+    free(network);
+}
+
+enum SimplexStatus network_solve(struct Network *network)
+{
+    long long *cost;
+    int k, node, failed = 0;
+
+    cost = network->cost; /* Phase 1 minimizes the flow on artificial arcs. */
+    network->cost = (long long *)network_alloc(network->arcs, sizeof(long long), &failed);
+    if(failed)
+    {
+        network->cost = cost;
+        return SIMPLEX_ERROR;
+    }
+    for(k=0; k<network->arcs; ++k)
+    {
+        network->cost[k] = (network->variable[k] < 0) ? 1 : 0;
+    }
+    for(node=network->firstChild[network->nodes-1]; node >= 0; node=network->nextSibling[node])
+    {
+        tree_update(network, node);
+    }
+    network_run(network);
+    free(network->cost);
+    network->cost = cost;
+
+    for(k=0; k<network->arcs; ++k)
+    {
+        if(network->variable[k] < 0 && network->flow[k] > 0)
+        {
+            return SIMPLEX_INFEASIBLE;
+        }
+    }
+
+    for(node=network->firstChild[network->nodes-1]; node >= 0; node=network->nextSibling[node])
+    {
+        tree_update(network, node);
+    }
+
+    return network_run(network) ? SIMPLEX_OPTIMAL : SIMPLEX_UNBOUNDED;
+}
+
+static int network_run(struct Network *network)
+{
+    int entering;
+
+    while((entering = network_price(network)) >= 0)
+    {
+        if(!network_pivot(network, entering))
+        {
+            return 0;
+        }
+        ++(network->pivots);
+    }
+
+    return 1;
+}
+
+struct Rational **network_get_solution(struct Network *network)
+{
+    struct Rational **solution;
+    int k, failed = 0;
+
+    solution = (struct Rational **)malloc(sizeof(struct Rational *));
+    if(solution == NULL)
+    {
+        return NULL;
+    }
+    *solution = (struct Rational *)network_alloc(network->variables, sizeof(struct Rational), &failed);
+    if(failed)
+    {
+        free(solution);
+        return NULL;
+    }
+    for(k=0; k<network->variables; ++k)
+    {
+        (*solution)[k].d = 1;
+    }
+    for(k=0; k<network->arcs; ++k)
+    {
+        if(network->variable[k] >= 0)
+        {
+            (*solution)[network->variable[k]].n = (int)network->flow[k];
+        }
+    }
+
+    return solution;
+}
+
+struct Rational network_get_objective(struct Network *network)
+{
+    struct Rational value;
+    long long cost = 0;
+    int k;
+
+    for(k=0; k<network->arcs; ++k)
+    {
+        if(network->variable[k] >= 0)
+        {
+            cost += network->cost[k] * network->flow[k];
+        }
+    }
+    value.n = (int)(-cost);
+    value.d = 1;
+
+    return rational_sum(network->offset, value);
+}
+
+int network_apply(struct Network *network, struct Tableau *tableau)
+{
+    int *target;
+    int k, result, failed = 0;
+
+    target = (int *)network_alloc(network->variables, sizeof(int), &failed);
+    if(failed)
+    {
+        return -1;
+    }
+    for(k=0; k<network->arcs; ++k)
+    {
+        if(network->inTree[k] && network->variable[k] >= 0)
+        {
+            target[network->variable[k]] = 1;
+        }
+    }
+
+    result = simplex_pivot_to_basis(tableau, target);
+    if(result == 0)
+    {
+        result = simplex_find_best_solution(tableau);
+    }
+
+    free(target);
+
+    return result;
+}
+
+static int column_arc(struct Tableau *tableau, int column, int root, int *from, int *to)
+{
+    struct Rational *a;
+    int i;
+
+    *from = root;
+    *to = root;
+    for(i=0; i<tableau->rows; ++i)
+    {
+        a = tableau->A[i][column];
+        if(a->n == 0)
+        {
+            continue;
+        }
+        if(a->d != 1 || (a->n != 1 && a->n != -1))
+        {
+            return 0;
+        }
+        if(a->n == 1)
+        {
+            if(*from != root)
+            {
+                return 0;
+            }
+            *from = i;
+        }
+        else
+        {
+            if(*to != root)
+            {
+                return 0;
+            }
+            *to = i;
+        }
+    }
+
+    return 1;
+}
+
+static void *network_alloc(int count, size_t size, int *failed)
+{
+    void *memory;
+
+    if(*failed)
+    {
+        return NULL;
+    }
+    memory = calloc((count > 0) ? count : 1, size);
+    if(memory == NULL)
+    {
+        *failed = 1;
+    }
+
+    return memory;
+}
+
+static void tree_attach(struct Network *network, int node, int parent)
+{
+    network->parent[node] = parent;
+    network->prevSibling[node] = -1;
+    network->nextSibling[node] = network->firstChild[parent];
+    if(network->firstChild[parent] >= 0)
+    {
+        network->prevSibling[network->firstChild[parent]] = node;
+    }
+    network->firstChild[parent] = node;
+}
+
+static void tree_detach(struct Network *network, int node)
+{
+    int parent = network->parent[node];
+
+    if(network->prevSibling[node] >= 0)
+    {
+        network->nextSibling[network->prevSibling[node]] = network->nextSibling[node];
+    }
+    else
+    {
+        network->firstChild[parent] = network->nextSibling[node];
+    }
+    if(network->nextSibling[node] >= 0)
+    {
+        network->prevSibling[network->nextSibling[node]] = network->prevSibling[node];
+    }
+    network->nextSibling[node] = -1;
+    network->prevSibling[node] = -1;
+}
+
+static void tree_update(struct Network *network, int top)
+{
+    int node = top, arc;
+
+    for(;;)
+    {
+        arc = network->parentArc[node];
+        network->depth[node] = network->depth[network->parent[node]] + 1;
+        if(network->from[arc] == network->parent[node]) /* Reduced cost c + pi_from - pi_to = 0. */
+        {
+            network->potential[node] = network->potential[network->parent[node]] + network->cost[arc];
+        }
+        else
+        {
+            network->potential[node] = network->potential[network->parent[node]] - network->cost[arc];
+        }
+
+        if(network->firstChild[node] >= 0) /* Depth first walk through the subtree. */
+        {
+            node = network->firstChild[node];
+            continue;
+        }
+        while(node != top && network->nextSibling[node] < 0)
+        {
+            node = network->parent[node];
+        }
+        if(node == top)
+        {
+            break;
+        }
+        node = network->nextSibling[node];
+    }
+}
+
+static int network_price(struct Network *network)
+{
+    long long reduced, best = 0;
+    int k, arc, checked, entering = -1;
+
+    for(checked=0; checked<network->arcs; )
+    {
+        for(k=0; k<network->block && checked<network->arcs; ++k, ++checked)
+        {
+            arc = network->next;
+            network->next = (network->next + 1) % network->arcs;
+            if(network->inTree[arc])
+            {
+                continue;
+            }
+            reduced = network->cost[arc] + network->potential[network->from[arc]] - network->potential[network->to[arc]];
+            if(reduced < best)
+            {
+                best = reduced;
+                entering = arc;
+            }
+        }
+        if(entering >= 0)
+        {
+            break;
+        }
+    }
+
+    return entering;
+}
+
+static int network_pivot(struct Network *network, int entering)
+{
+    long long delta = LLONG_MAX;
+    int u = network->from[entering], v = network->to[entering];
+    int a, b, x, next, arc, nextArc, apex, leave = -1, leaveNode = -1, side = 0;
+
+    for(a=u, b=v; a != b; ) /* Apex of the cycle. */
+    {
+        if(network->depth[a] >= network->depth[b])
+        {
+            a = network->parent[a];
+        }
+        else
+        {
+            b = network->parent[b];
+        }
+    }
+    apex = a;
+
+    for(x=u; x != apex; x=network->parent[x]) /* apex -> u: arcs towards the apex decrease. */
+    {
+        arc = network->parentArc[x];
+        if(network->from[arc] == x && network->flow[arc] < delta)
+        {
+            delta = network->flow[arc];
+            leave = arc;
+            leaveNode = x;
+            side = 1;
+        }
+    }
+    for(x=v; x != apex; x=network->parent[x]) /* v -> apex: arcs away from the apex decrease. */
+    {
+        arc = network->parentArc[x];
+        if(network->to[arc] == x && network->flow[arc] <= delta)
+        {
+            delta = network->flow[arc];
+            leave = arc;
+            leaveNode = x;
+            side = 2;
+        }
+    }
+    if(leave < 0)
+    {
+        return 0;
+    }
+
+    network->flow[entering] += delta;
+    for(x=u; x != apex; x=network->parent[x])
+    {
+        arc = network->parentArc[x];
+        network->flow[arc] += (network->from[arc] == x) ? -delta : delta;
+    }
+    for(x=v; x != apex; x=network->parent[x])
+    {
+        arc = network->parentArc[x];
+        network->flow[arc] += (network->to[arc] == x) ? -delta : delta;
+    }
+
+    a = (side == 1) ? u : v; /* Hang the subtree of the leaving arc at the other end of the entering arc. */
+    b = (side == 1) ? v : u;
+    nextArc = entering;
+    for(x=a; ; x=next)
+    {
+        next = network->parent[x];
+        arc = network->parentArc[x];
+        tree_detach(network, x);
+        tree_attach(network, x, b);
+        network->parentArc[x] = nextArc;
+        if(x == leaveNode)
+        {
+            break;
+        }
+        b = x;
+        nextArc = arc;
+    }
+    network->inTree[leave] = 0;
+    network->inTree[entering] = 1;
+    tree_update(network, a);
+
+    return 1;
+}
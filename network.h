@@ -0,0 +1,132 @@
+/**
+ * @brief Header file for network.
+ *
+ * This file describes the network simplex algorithm for tableaus whose
+ * constraint matrix is a node-arc incidence matrix, e.g. transportation,
+ * assignment and minimum cost flow problems.
+ *
+ * @file network.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef NETWORK_H
+#define NETWORK_H NETWORK_H
+
+#include "simplex.h"
+
+/**
+ * @brief Minimum cost flow problem of a tableau.
+ *
+ * This structure describes the network of a tableau x_B + A x_N = b: each
+ * equation is a node with supply b_i, an additional root node balances the
+ * supplies. Each none basis variable is an arc from the line of its +1 entry
+ * to the line of its -1 entry, or the root if there is none. Each basis
+ * variable is an arc from its line to the root. The arcs have the negated
+ * target function coefficients as cost.
+ *
+ * The basis is a spanning tree, stored with parent, child and sibling links,
+ * and rooted at an artificial node. Artificial arcs connect this node with
+ * all other nodes and form the start tree.
+ */
+struct Network
+{
+    int nodes; /**< Number of nodes, including the root and the artificial node. */
+    int arcs; /**< Number of arcs, including the artificial arcs. */
+    int variables; /**< Number of tableau variables. */
+    struct Rational offset; /**< Target function value of the tableau for x = 0, i.e. -z. */
+    int *from; /**< Start node of arcs. */
+    int *to; /**< End node of arcs. */
+    long long *cost; /**< Cost of arcs. */
+    long long *flow; /**< Flow on arcs. */
+    int *variable; /**< Tableau variable of arcs, -1 for artificial arcs. */
+    int *inTree; /**< 1 if the arc is in the spanning tree. */
+    int *parent; /**< Parent node in the tree, -1 for the artificial node. */
+    int *parentArc; /**< Tree arc to the parent node. */
+    int *depth; /**< Depth in the tree. */
+    int *firstChild; /**< First child node or -1. */
+    int *nextSibling; /**< Next child of the parent or -1. */
+    int *prevSibling; /**< Previous child of the parent or -1. */
+    long long *potential; /**< Node potentials. Tree arcs have reduced cost 0. */
+    int block; /**< Number of arcs priced per block. */
+    int next; /**< First arc of the next pricing block. */
+    long pivots; /**< Number of pivots done so far. */
+};
+
+/**
+ * @brief Create network of a tableau.
+ *
+ * This function checks whether the tableau has network structure, i.e. no
+ * artificial variables, integer limits and target function coefficients, and
+ * columns with at most one +1 and one -1 entry and 0 else.
+ *
+ * @param tableau
+ *    tableau to check, not changed
+ * @return new network or NULL if the tableau has no network structure or no memory is left
+ */
+struct Network *network_create(struct Tableau *tableau);
+
+/**
+ * @brief Free memory of given network.
+ *
+ * @param network
+ *    network to free
+ */
+void network_free(struct Network *network);
+
+/**
+ * @brief Solve a network.
+ *
+ * This function runs the network simplex algorithm with strongly feasible
+ * trees and block search pricing. Phase 1 removes the flow from the
+ * artificial arcs, phase 2 minimizes the cost with a large cost for the
+ * artificial arcs. A pivot costs the length of the cycle closed by the
+ * entering arc and the size of the moved subtree instead of a complete
+ * tableau update.
+ *
+ * @param network
+ *    network to solve
+ * @return SIMPLEX_OPTIMAL, SIMPLEX_UNBOUNDED or SIMPLEX_INFEASIBLE, SIMPLEX_ERROR if no memory is
+ *    left; the network is not changed then
+ */
+enum SimplexStatus network_solve(struct Network *network);
+
+/**
+ * @brief Get solution of network.
+ *
+ * This function returns the values of the tableau variables in the format of
+ * simplex_get_solution.
+ *
+ * @param network
+ *    solved network
+ * @return pointer to array of network->variables values or NULL if no memory is left
+ */
+struct Rational **network_get_solution(struct Network *network);
+
+/**
+ * @brief Get target function value of network.
+ *
+ * @param network
+ *    solved network
+ * @return target function value of the tableau for the current flow
+ */
+struct Rational network_get_objective(struct Network *network);
+
+/**
+ * @brief Pivot a tableau to the basis of a network.
+ *
+ * This function exchanges the basis of the tableau of the network with the
+ * variables of the spanning tree and finishes the solve with
+ * simplex_find_best_solution, which is only needed if artificial arcs with
+ * flow 0 are left in the tree. Afterwards all tableau functions, e.g.
+ * simplex_get_solution or simplex_sensitivity, can be used.
+ *
+ * @param network
+ *    optimal network
+ * @param tableau
+ *    tableau of network
+ * @return 0 on success, -1 if no memory is left
+ */
+int network_apply(struct Network *network, struct Tableau *tableau);
+
+#endif
@@ -0,0 +1,409 @@
+/**
+ * @brief Source file for parametric.
+ *
+ * This file implements the parametric simplex algorithm for limits and target
+ * function coefficients.
+ *
+ * @file parametric.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdlib.h>
+
+#include "parametric.h"
+
+/**
+ * @brief Allocate an array.
+ *
+ * This function allocates the given number of elements, at least one.
+ *
+ * @param elements
+ *    number of elements
+ * @param size
+ *    size of one element
+ * @return new array or NULL if no memory is left
+ */
+static void *parametric_alloc(int elements, size_t size);
+
+/**
+ * @brief Create an empty optimal value function.
+ *
+ * @return new function or NULL if no memory is left
+ */
+static struct SimplexParametric *parametric_create(void);
+
+/**
+ * @brief Start a new piece.
+ *
+ * This function appends a piece at t. A previous piece which also starts at t
+ * has length 0 and is replaced.
+ *
+ * @param parametric
+ *    function to extend
+ * @param t
+ *    start of piece
+ * @param value
+ *    target function value at t
+ * @param slope
+ *    slope of piece
+ * @return 0 or -1 if no memory is left, the function is not changed then
+ */
+static int parametric_add(struct SimplexParametric *parametric, struct Rational t, struct Rational value,
+                          struct Rational slope);
+
+/**
+ * @brief Limit the step to the next breakpoint.
+ *
+ * This function limits the step length of the parameter to maxT - t.
+ *
+ * @param step
+ *    step length, updated
+ * @param bounded
+ *    1 if step is valid, updated
+ * @param t
+ *    current parameter
+ * @param maxT
+ *    largest value of t or NULL
+ * @return 1 if the step was limited by maxT
+ */
+static int parametric_limit(struct Rational *step, int *bounded, struct Rational t, const struct Rational *maxT);
+
+struct SimplexParametric *simplex_parametric_rhs(struct Tableau *tableau, const struct Rational *db, const struct Rational *maxT)
+{
+    struct SimplexParametric *parametric = parametric_create();
+    struct Rational *d, t = {0, 1}, step = {0, 1}, best = {0, 1}, ratio, slope, value;
+    int i, j, k, n = tableau->artificials - tableau->rows, line, column, bounded = 0, limited;
+
+    d = (struct Rational *)parametric_alloc(tableau->rows, sizeof(struct Rational));
+    if(parametric == NULL || d == NULL)
+    {
+        if(parametric != NULL)
+        {
+            simplex_parametric_free(parametric);
+        }
+        free(d);
+        return NULL;
+    }
+
+    for(;;)
+    {
+        slope.n = 0; /* d = direction of the basis variables, slope = dual values * db */
+        slope.d = 1;
+        for(k=0; k<tableau->rows; ++k)
+        {
+            d[k].n = 0;
+            d[k].d = 1;
+            if(tableau->bvs[k] >= n && tableau->bvs[k] < tableau->artificials)
+            {
+                d[k] = db[tableau->bvs[k] - n];
+            }
+        }
+        for(j=0; j<tableau->cols; ++j)
+        {
+            i = tableau->nbvs[j] - n;
+            if(i < 0 || tableau->nbvs[j] >= tableau->artificials || db[i].n == 0)
+            {
+                continue;
+            }
+            for(k=0; k<tableau->rows; ++k)
+            {
+                d[k] = rational_sum(d[k], rational_product(db[i], *(tableau->A[k][j])));
+            }
+            slope = rational_difference(slope, rational_product(db[i], *(tableau->c[j])));
+        }
+
+        value = *(tableau->z);
+        value.n = -value.n;
+        if(parametric_add(parametric, t, value, slope) != 0)
+        {
+            parametric->status = SIMPLEX_ERROR;
+            break;
+        }
+
+        line = -1; /* Ratio test: first basis variable which becomes negative. */
+        bounded = 0;
+        for(k=0; k<tableau->rows; ++k)
+        {
+            if(d[k].n >= 0)
+            {
+                continue;
+            }
+            ratio = rational_quotient(*(tableau->b[k]), d[k]);
+            ratio.n = -ratio.n;
+            if(!bounded || rational_compare(ratio, step) < 0
+               || (rational_compare(ratio, step) == 0 && tableau->bvs[k] < tableau->bvs[line]))
+            {
+                step = ratio;
+                line = k;
+                bounded = 1;
+            }
+        }
+        limited = parametric_limit(&step, &bounded, t, maxT);
+
+        if(bounded) /* Move to the breakpoint. */
+        {
+            for(k=0; k<tableau->rows; ++k)
+            {
+                *(tableau->b[k]) = rational_sum(*(tableau->b[k]), rational_product(step, d[k]));
+            }
+            *(tableau->z) = rational_difference(*(tableau->z), rational_product(step, slope));
+            t = rational_sum(t, step);
+        }
+        if(!bounded || limited)
+        {
+            parametric->status = SIMPLEX_OPTIMAL;
+            break;
+        }
+
+        column = -1; /* Dual ratio test: entering variable keeps all reduced costs <= 0. */
+        for(j=0; j<tableau->cols; ++j)
+        {
+            if((tableau->A[line][j])->n >= 0 || tableau->nbvs[j] >= tableau->artificials)
+            {
+                continue;
+            }
+            ratio = rational_quotient(*(tableau->c[j]), *(tableau->A[line][j]));
+            if(column < 0 || rational_compare(ratio, best) < 0
+               || (rational_compare(ratio, best) == 0 && tableau->nbvs[j] < tableau->nbvs[column]))
+            {
+                best = ratio;
+                column = j;
+            }
+        }
+        if(column < 0)
+        {
+            parametric->status = SIMPLEX_INFEASIBLE;
+            break;
+        }
+        if(simplex_pivot(tableau, line, column) != 0)
+        {
+            parametric->status = SIMPLEX_ERROR;
+            break;
+        }
+    }
+
+    parametric->end = t;
+    parametric->bounded = bounded;
+    tableau->pivotLine = -1;
+    tableau->pivotColumn = -1;
+    free(d);
+
+    return parametric;
+}
+
+struct SimplexParametric *simplex_parametric_cost(struct Tableau *tableau, const struct Rational *dc, const struct Rational *maxT)
+{
+    struct SimplexParametric *parametric = parametric_create();
+    struct Rational *e, t = {0, 1}, step = {0, 1}, best = {0, 1}, ratio, slope, value;
+    int i, j, k, n = tableau->artificials - tableau->rows, line, column, bounded = 0, limited;
+
+    e = (struct Rational *)parametric_alloc(tableau->cols, sizeof(struct Rational));
+    if(parametric == NULL || e == NULL)
+    {
+        if(parametric != NULL)
+        {
+            simplex_parametric_free(parametric);
+        }
+        free(e);
+        return NULL;
+    }
+
+    for(;;)
+    {
+        for(j=0; j<tableau->cols; ++j) /* e = dc_N - dc_B A, slope = dc_B b */
+        {
+            e[j].n = 0;
+            e[j].d = 1;
+            if(tableau->nbvs[j] < n)
+            {
+                e[j] = dc[tableau->nbvs[j]];
+            }
+        }
+        slope.n = 0;
+        slope.d = 1;
+        for(k=0; k<tableau->rows; ++k)
+        {
+            i = tableau->bvs[k];
+            if(i >= n || dc[i].n == 0)
+            {
+                continue;
+            }
+            for(j=0; j<tableau->cols; ++j)
+            {
+                e[j] = rational_difference(e[j], rational_product(dc[i], *(tableau->A[k][j])));
+            }
+            slope = rational_sum(slope, rational_product(dc[i], *(tableau->b[k])));
+        }
+
+        value = *(tableau->z);
+        value.n = -value.n;
+        if(parametric_add(parametric, t, value, slope) != 0)
+        {
+            parametric->status = SIMPLEX_ERROR;
+            break;
+        }
+
+        column = -1; /* First reduced cost which becomes positive. */
+        bounded = 0;
+        for(j=0; j<tableau->cols; ++j)
+        {
+            if(e[j].n <= 0 || tableau->nbvs[j] >= tableau->artificials)
+            {
+                continue;
+            }
+            ratio = rational_quotient(*(tableau->c[j]), e[j]);
+            ratio.n = -ratio.n;
+            if(!bounded || rational_compare(ratio, step) < 0
+               || (rational_compare(ratio, step) == 0 && tableau->nbvs[j] < tableau->nbvs[column]))
+            {
+                step = ratio;
+                column = j;
+                bounded = 1;
+            }
+        }
+        limited = parametric_limit(&step, &bounded, t, maxT);
+
+        if(bounded) /* Move to the breakpoint. */
+        {
+            for(j=0; j<tableau->cols; ++j)
+            {
+                *(tableau->c[j]) = rational_sum(*(tableau->c[j]), rational_product(step, e[j]));
+            }
+            *(tableau->z) = rational_difference(*(tableau->z), rational_product(step, slope));
+            t = rational_sum(t, step);
+        }
+        if(!bounded || limited)
+        {
+            parametric->status = SIMPLEX_OPTIMAL;
+            break;
+        }
+
+        line = -1; /* Primal ratio test. */
+        for(k=0; k<tableau->rows; ++k)
+        {
+            if((tableau->A[k][column])->n <= 0)
+            {
+                continue;
+            }
+            ratio = rational_quotient(*(tableau->b[k]), *(tableau->A[k][column]));
+            if(line < 0 || rational_compare(ratio, best) < 0
+               || (rational_compare(ratio, best) == 0 && tableau->bvs[k] < tableau->bvs[line]))
+            {
+                best = ratio;
+                line = k;
+            }
+        }
+        if(line < 0)
+        {
+            parametric->status = SIMPLEX_UNBOUNDED;
+            break;
+        }
+        if(simplex_pivot(tableau, line, column) != 0)
+        {
+            parametric->status = SIMPLEX_ERROR;
+            break;
+        }
+    }
+
+    parametric->end = t;
+    parametric->bounded = bounded;
+    tableau->pivotLine = -1;
+    tableau->pivotColumn = -1;
+    free(e);
+
+    return parametric;
+}
+
+void simplex_parametric_free(struct SimplexParametric *parametric)
+{
+    free(parametric->piece);
+    free(parametric);
+}
+
+static void *parametric_alloc(int elements, size_t size)
+{
+    void *array;
+
+    array = malloc((size_t)((elements > 0) ? elements : 1) * size);
+
+    return array;
+}
+
+static struct SimplexParametric *parametric_create(void)
+{
+    struct SimplexParametric *parametric;
+
+    parametric = (struct SimplexParametric *)parametric_alloc(1, sizeof(struct SimplexParametric));
+    if(parametric == NULL)
+    {
+        return NULL;
+    }
+    parametric->pieces = 0;
+    parametric->size = 4;
+    parametric->piece = (struct SimplexPiece *)parametric_alloc(parametric->size, sizeof(struct SimplexPiece));
+    if(parametric->piece == NULL)
+    {
+        free(parametric);
+        return NULL;
+    }
+    parametric->end.n = 0;
+    parametric->end.d = 1;
+    parametric->bounded = 0;
+    parametric->status = SIMPLEX_OPTIMAL;
+
+    return parametric;
+}
+
+static int parametric_add(struct SimplexParametric *parametric, struct Rational t, struct Rational value,
+                          struct Rational slope)
+{
+    struct SimplexPiece *last, *piece;
+
+    if(parametric->pieces > 0 && rational_compare(parametric->piece[parametric->pieces - 1].start, t) == 0)
+    {
+        --(parametric->pieces); /* Several pivots at one breakpoint. */
+    }
+    if(parametric->pieces > 0 && rational_compare(parametric->piece[parametric->pieces - 1].slope, slope) == 0)
+    {
+        return 0; /* The function does not change at this breakpoint. */
+    }
+
+    if(parametric->pieces == parametric->size)
+    {
+        piece = (struct SimplexPiece *)realloc(parametric->piece, 2 * parametric->size * sizeof(struct SimplexPiece));
+        if(piece == NULL)
+        {
+            return -1;
+        }
+        parametric->piece = piece;
+        parametric->size *= 2;
+    }
+
+    last = &(parametric->piece[(parametric->pieces)++]);
+    last->start = t;
+    last->value = value;
+    last->slope = slope;
+
+    return 0;
+}
+
+static int parametric_limit(struct Rational *step, int *bounded, struct Rational t, const struct Rational *maxT)
+{
+    struct Rational rest;
+
+    if(maxT == NULL)
+    {
+        return 0;
+    }
+
+    rest = rational_difference(*maxT, t);
+    if(!(*bounded) || rational_compare(rest, *step) <= 0)
+    {
+        *step = rest;
+        *bounded = 1;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+/**
+ * @brief Header file for parametric.
+ *
+ * This file describes the parametric simplex algorithm, which follows an
+ * optimal tableau while the limits b + t*db or the target function
+ * coefficients c + t*dc change with a parameter t >= 0.
+ *
+ * @file parametric.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef PARAMETRIC_H
+#define PARAMETRIC_H PARAMETRIC_H
+
+#include "rational.h"
+#include "simplex.h"
+
+/**
+ * @brief Linear piece of the optimal value function.
+ *
+ * value(t) = value + slope * (t - start) from start to the start of the next
+ * piece.
+ */
+struct SimplexPiece
+{
+    struct Rational start; /**< Breakpoint where the piece starts. */
+    struct Rational value; /**< Optimal target function value at start. */
+    struct Rational slope; /**< Slope of the optimal target function value. */
+};
+
+/**
+ * @brief Optimal value function of a parametric problem.
+ *
+ * This structure describes the piecewise linear optimal target function value
+ * for 0 <= t <= end.
+ */
+struct SimplexParametric
+{
+    int pieces; /**< Number of pieces. */
+    int size; /**< Capacity of piece array. */
+    struct SimplexPiece *piece; /**< Pieces ordered by start. */
+    struct Rational end; /**< End of the last piece, valid if bounded is set. */
+    int bounded; /**< 1 if the function ends at end, 0 if it continues to infinity. */
+    enum SimplexStatus status; /**< Status after end: infeasible, unbounded, optimal if the limit of t was reached or error if no memory was left for a pivot or a piece. */
+};
+
+/**
+ * @brief Parametric limits.
+ *
+ * This function follows the given optimal tableau for the limits b + t*db with
+ * the dual simplex algorithm. At each breakpoint the basis variable which
+ * would become negative leaves the basis. The tableau must use the variables
+ * 0, ..., n-1 and the slack variable n+i of equation i, see
+ * simplex_sensitivity. Afterwards the tableau is optimal for the end of the
+ * function.
+ *
+ * @param tableau
+ *    optimal tableau, updated in place
+ * @param db
+ *    direction of the limits, one entry per equation
+ * @param maxT
+ *    largest value of t or NULL for no limit
+ * @return new optimal value function or NULL if no memory is left
+ */
+struct SimplexParametric *simplex_parametric_rhs(struct Tableau *tableau, const struct Rational *db, const struct Rational *maxT);
+
+/**
+ * @brief Parametric target function.
+ *
+ * This function follows the given optimal tableau for the target function
+ * coefficients c + t*dc with the primal simplex algorithm. At each breakpoint
+ * the none basis variable whose reduced cost would become positive enters the
+ * basis. The tableau must use the variables as described for
+ * simplex_parametric_rhs.
+ *
+ * @param tableau
+ *    optimal tableau, updated in place
+ * @param dc
+ *    direction of the target function, one entry per variable without slack variables
+ * @param maxT
+ *    largest value of t or NULL for no limit
+ * @return new optimal value function or NULL if no memory is left
+ */
+struct SimplexParametric *simplex_parametric_cost(struct Tableau *tableau, const struct Rational *dc, const struct Rational *maxT);
+
+/**
+ * @brief Free memory of given optimal value function.
+ *
+ * @param parametric
+ *    function to free
+ */
+void simplex_parametric_free(struct SimplexParametric *parametric);
+
+#endif
@@ -0,0 +1,191 @@
+/**
+ * @brief Source file for race.
+ *
+ * This file implements the concurrent solve with competing strategies.
+ *
+ * @file race.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdlib.h>
+#include <stdatomic.h>
+
+#include "race.h"
+#include "thread_pool.h"
+
+const struct SimplexStrategy simplex_race_strategies[SIMPLEX_RACE_STRATEGIES] =
+{
+    {SIMPLEX_PRICING_BLAND, SIMPLEX_FORM_AUTO, 1},
+    {SIMPLEX_PRICING_DANTZIG, SIMPLEX_FORM_PRIMAL, 1},
+    {SIMPLEX_PRICING_DANTZIG, SIMPLEX_FORM_DUAL, 1},
+    {SIMPLEX_PRICING_DANTZIG, SIMPLEX_FORM_PRIMAL, 0}
+};
+
+/**
+ * @brief Shared state of a race.
+ */
+struct Race
+{
+    atomic_int winner; /**< Index of the winning strategy or -1. */
+    struct SimplexContext **contexts; /**< Solves of the strategies. */
+    int count; /**< Number of strategies. */
+};
+
+/**
+ * @brief Argument of a race task.
+ */
+struct RaceEntry
+{
+    struct Race *race; /**< Race of the strategy. */
+    int index; /**< Index of the strategy. */
+};
+
+/**
+ * @brief Solve with one strategy.
+ *
+ * This function runs the solve of one strategy unless the race is already
+ * decided. If it finishes first it cancels the other solves.
+ *
+ * @param data
+ *    RaceEntry of strategy
+ */
+static void race_task(void *data);
+
+enum SimplexStatus simplex_race(struct Tableau *tableau, const struct SimplexStrategy *strategies, int count,
+                                int threads, int *winner)
+{
+    struct Race race;
+    struct RaceEntry *entries;
+    struct ThreadPool *pool;
+    struct Tableau swap, *copy;
+    enum SimplexStatus status = SIMPLEX_CANCELLED;
+    int i, index;
+
+    if(strategies == NULL)
+    {
+        strategies = simplex_race_strategies;
+        count = SIMPLEX_RACE_STRATEGIES;
+    }
+    if(threads <= 0)
+    {
+        threads = (count < thread_pool_cores()) ? count : thread_pool_cores();
+    }
+
+    atomic_init(&(race.winner), -1);
+    race.count = count;
+    race.contexts = (struct SimplexContext **)malloc(count * sizeof(struct SimplexContext *));
+    entries = (struct RaceEntry *)malloc(count * sizeof(struct RaceEntry));
+    if(race.contexts == NULL || entries == NULL)
+    {
+        free(race.contexts);
+        free(entries);
+        if(winner != NULL)
+        {
+            *winner = -1;
+        }
+        return SIMPLEX_ERROR;
+    }
+
+    for(i=0; i<count; ++i) /* All contexts exist before the first task can cancel them. */
+    {
+        race.contexts[i] = NULL;
+        copy = simplex_copy_tableau(tableau);
+        if(copy != NULL)
+        {
+            race.contexts[i] = simplex_context_create(copy);
+        }
+        if(race.contexts[i] == NULL)
+        {
+            simplex_free_tableau(copy);
+            while(--i >= 0)
+            {
+                simplex_free_tableau(race.contexts[i]->tableau);
+                simplex_context_free(race.contexts[i]);
+            }
+            free(race.contexts);
+            free(entries);
+            if(winner != NULL)
+            {
+                *winner = -1;
+            }
+            return SIMPLEX_ERROR;
+        }
+        race.contexts[i]->tableau->pricing = strategies[i].pricing;
+        race.contexts[i]->form = strategies[i].form;
+        race.contexts[i]->crash = strategies[i].crash;
+        entries[i].race = &race;
+        entries[i].index = i;
+    }
+
+    pool = thread_pool_create(threads);
+    for(i=0; i<count; ++i)
+    {
+        if(pool != NULL)
+        {
+            thread_pool_submit(pool, race_task, &(entries[i]));
+        }
+        else /* No worker thread, the first strategy runs in the calling thread and wins. */
+        {
+            race_task(&(entries[i]));
+        }
+    }
+    if(pool != NULL)
+    {
+        thread_pool_free(pool);
+    }
+
+    index = atomic_load(&(race.winner));
+    if(index >= 0)
+    {
+        status = race.contexts[index]->status;
+        swap = *tableau;
+        *tableau = *(race.contexts[index]->tableau);
+        *(race.contexts[index]->tableau) = swap;
+        tableau->pricing = swap.pricing;
+    }
+    if(winner != NULL)
+    {
+        *winner = index;
+    }
+
+    for(i=0; i<count; ++i)
+    {
+        simplex_free_tableau(race.contexts[i]->tableau);
+        simplex_context_free(race.contexts[i]);
+    }
+    free(race.contexts);
+    free(entries);
+
+    return status;
+}
+
+static void race_task(void *data)
+{
+    struct RaceEntry *entry = (struct RaceEntry *)data;
+    struct Race *race = entry->race;
+    enum SimplexStatus status;
+    int i, expected = -1;
+
+    if(atomic_load(&(race->winner)) >= 0)
+    {
+        return;
+    }
+
+    status = simplex_iterate(race->contexts[entry->index], 0);
+    if(status == SIMPLEX_CANCELLED || status == SIMPLEX_LIMIT_REACHED)
+    {
+        return;
+    }
+
+    if(atomic_compare_exchange_strong(&(race->winner), &expected, entry->index))
+    {
+        for(i=0; i<race->count; ++i)
+        {
+            if(i != entry->index)
+            {
+                simplex_cancel(race->contexts[i]);
+            }
+        }
+    }
+}
@@ -0,0 +1,62 @@
+/**
+ * @brief Header file for race.
+ *
+ * This file describes the concurrent solve of one problem with several
+ * strategies. Each strategy solves its own copy of the tableau on a worker
+ * thread, the first strategy which finishes wins and cancels the others.
+ *
+ * @file race.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef RACE_H
+#define RACE_H RACE_H
+
+#include "simplex.h"
+
+#define SIMPLEX_RACE_STRATEGIES 4 /**< Number of default strategies. */
+
+/**
+ * @brief Configuration of a solve.
+ */
+struct SimplexStrategy
+{
+    enum SimplexPricing pricing; /**< Rule to choose the pivot column. */
+    enum SimplexForm form; /**< Form of the solved problem. */
+    int crash; /**< 1 to start phase 1 with a crash basis. */
+};
+
+/**
+ * @brief Default strategies.
+ *
+ * Bland with automatic form, Dantzig for the primal and the dual problem and
+ * Dantzig without crash basis.
+ */
+extern const struct SimplexStrategy simplex_race_strategies[SIMPLEX_RACE_STRATEGIES];
+
+/**
+ * @brief Solve a tableau with competing strategies.
+ *
+ * This function solves a copy of the given tableau with each strategy on a
+ * pool of worker threads. The first strategy which finds the result cancels the
+ * others, its solved tableau replaces the content of the given tableau. If no
+ * worker thread can be started, the first strategy solves in the calling
+ * thread.
+ *
+ * @param tableau
+ *    tableau of optimization problem, solved in place
+ * @param strategies
+ *    strategies to run, NULL for simplex_race_strategies
+ * @param count
+ *    number of strategies
+ * @param threads
+ *    number of worker threads, one per strategy up to the number of cores if <= 0
+ * @param winner
+ *    index of the winning strategy, may be NULL
+ * @return status of solve, SIMPLEX_ERROR if no memory is left for the copies
+ */
+enum SimplexStatus simplex_race(struct Tableau *tableau, const struct SimplexStrategy *strategies, int count,
+                                int threads, int *winner);
+
+#endif
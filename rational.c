@@ -1,7 +1,10 @@
 /**
  * @brief Source file for rational.
  *
- * This file implements the rational functions.
+ * This file implements the rational functions. None of them has global state
+ * except the statistics counters, which are bound per thread, and the overflow
+ * flag, which is kept per thread, so all functions are reentrant and can be
+ * used from several threads at once.
  *
  * @file rational.c
  * @author Thomas Irgang
@@ -10,8 +13,13 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <limits.h>
 
 #include "rational.h"
+#include "stats.h"
+
+static _Thread_local int r_overflow = 0; /**< 1 if a result of the current thread was rounded since the last rational_clear_overflow. */
 
 /**
  * @brief Largest common divisor.
@@ -25,7 +33,69 @@
  *    integer b
  * @return largest common divisor of a and b
  */
-static int r_largest_common_divisor(int a, int b);
+static long long r_largest_common_divisor(long long a, long long b);
+
+/**
+ * @brief Normalize rational number given as 64 bit values.
+ *
+ * This function normalizes the given 64 bit fraction and returns the result.
+ * Intermediate values which do not fit into an int are counted as overflow
+ * promotion. If the normalized fraction still does not fit, the result is
+ * the closest fraction with int numerator and denominator, see
+ * r_approximated, which is counted as overflow rounding and sets the overflow
+ * flag of the current thread.
+ *
+ * @param n
+ *    numerator
+ * @param d
+ *    denominator
+ * @return normalized rational number n/d
+ */
+static struct Rational r_normalized(long long n, long long d);
+
+/**
+ * @brief Approximate a fraction which does not fit into an int.
+ *
+ * This function follows the continued fraction of n/d until the next
+ * convergent does not fit into an int anymore and returns the best of the last
+ * convergent and the largest fitting intermediate fraction. Values beyond
+ * +-INT_MAX saturate to +-INT_MAX.
+ *
+ * @param n
+ *    numerator
+ * @param d
+ *    denominator, > 0
+ * @return normalized rational number close to n/d
+ */
+static struct Rational r_approximated(long long n, long long d);
+
+/**
+ * @brief Write integer value in decimal.
+ *
+ * This function writes the decimal representation of the given value to the
+ * given buffer, which must have room for 21 characters. The string is not
+ * terminated.
+ *
+ * @param buffer
+ *    buffer for the digits
+ * @param value
+ *    value to write
+ * @return number of written characters
+ */
+static size_t r_format_integer(char *buffer, long long value);
+
+/**
+ * @brief Multiply with power of 10.
+ *
+ * This function multiplies the given value with 10^exponent.
+ *
+ * @param value
+ *    value to multiply
+ * @param exponent
+ *    exponent of 10
+ * @return 1 on success, 0 if the result does not fit into a long long
+ */
+static int r_scale_decimal(long long *value, long long exponent);
 
 struct Rational *rational_create()
 {
@@ -39,9 +109,9 @@ struct Rational *rational_get(int nominator, int denominator)
     r = (struct Rational *)malloc(sizeof(struct Rational));
     if(r == NULL)
     {
-        fprintf(stderr, ERROR_MALLOC_FAILED);
-        exit(EXIT_FAILURE);
+        return NULL;
     }
+    STATS_ALLOC(sizeof(struct Rational));
 
     r->n = nominator;
     r->d = denominator;
@@ -52,10 +122,13 @@ struct Rational *rational_get(int nominator, int denominator)
 
 void rational_normalize(struct Rational *r)
 {
-    int div = r_largest_common_divisor(r->n , r->d);
+    int div = (int)r_largest_common_divisor(r->n , r->d);
 
-    r->n = (r->n)/div;
-    r->d = (r->d)/div;
+    if(div > 1)
+    {
+        r->n = (r->n)/div;
+        r->d = (r->d)/div;
+    }
 
     if(r->d < 0)
     {
@@ -67,157 +140,454 @@ void rational_normalize(struct Rational *r)
 
 struct Rational *rational_multiply(struct Rational *a, struct Rational *b)
 {
-    int n, d;
-    struct Rational *r;
+    struct Rational r = rational_product(*a, *b);
 
-    n = (a->n) * (b->n);
-    d = (a->d) * (b->d);
-
-    r = rational_get(n, d);
-    rational_normalize(r);
-
-    return r;
+    return rational_get(r.n, r.d);
 }
 
 struct Rational *rational_divide(struct Rational *a, struct Rational *b)
 {
-    int n, d;
-    struct Rational *r = NULL;
-
-    n = (a->n) * (b->d);
-    d = (a->d) * (b->n);
+    struct Rational r;
 
-    r = rational_get(n, d);
-    rational_normalize(r);
+    if(b->n == 0)
+    {
+        return NULL;
+    }
+    r = rational_quotient(*a, *b);
 
-    return r;
+    return rational_get(r.n, r.d);
 }
 
 struct Rational *rational_add(struct Rational *a, struct Rational *b)
 {
-    int n, d;
-    struct Rational *r;
+    struct Rational r = rational_sum(*a, *b);
 
-    n = (a->n) * (b->d) + (b->n) * (a->d);
-    d = (a->d) * (b->d);
+    return rational_get(r.n, r.d);
+}
 
-    r = rational_get(n, d);
-    rational_normalize(r);
 
-    return r;
+struct Rational *rational_subtract(struct Rational *a, struct Rational *b)
+{
+    struct Rational r = rational_difference(*a, *b);
+
+    return rational_get(r.n, r.d);
 }
 
+void rational_print(struct Rational *a)
+{
+    char string[BUFFER];
 
-struct Rational *rational_subtract(struct Rational *a, struct Rational *b)
+    rational_format(string, BUFFER, *a);
+    fputs(string, stdout);
+}
+
+char **rational_to_string(struct Rational *a)
 {
-    int n, d;
-    struct Rational *r;
+    char **string = NULL;
+    char buffer[BUFFER];
+    size_t n;
 
-    n = (a->n) * (b->d) - (b->n) * (a->d);
-    d = (a->d) * (b->d);
+    n = rational_format(buffer, BUFFER, *a);
 
-    r = rational_get(n, d);
-    rational_normalize(r);
+    string = (char **)malloc(sizeof(char *));
+    if(string == NULL)
+    {
+        return NULL;
+    }
+    *string = (char *)malloc((n+1) * sizeof(char));
+    if(*string == NULL)
+    {
+        free(string);
+        return NULL;
+    }
+    STATS_ALLOC(sizeof(char *) + (n+1) * sizeof(char));
 
-    return r;
+    memcpy(*string, buffer, n+1);
+
+    return string;
 }
 
-void rational_print(struct Rational *a)
+
+static long long r_largest_common_divisor(long long a, long long b)
 {
-    if(a->d == 1)
+    long long tmp;
+
+    STATS_COUNT(gcdCalls);
+
+    a = (a<0)?-a:a;
+    b = (b<0)?-b:b;
+
+    if(a == 0)
     {
-        printf("%d", a->n);
+        return b;
     }
-    else
+
+    while(b > 0)
     {
-        printf("%d/%d", a->n, a->d);
+        tmp = a % b;
+        a = b;
+        b = tmp;
     }
+
+    return a;
 }
 
-char **rational_to_string(struct Rational *a)
+static struct Rational r_normalized(long long n, long long d)
 {
-    char **string = NULL;
-    int n;
+    long long div;
+    struct Rational r;
 
-    string = (char **)malloc(sizeof(char *));
-    if(string == NULL)
+    if(n < INT_MIN || n > INT_MAX || d < INT_MIN || d > INT_MAX)
     {
-        fprintf(stderr, ERROR_MALLOC_FAILED);
-        exit(EXIT_FAILURE);
+        STATS_COUNT(overflowPromotions);
     }
-    *string = (char *)malloc(BUFFER * sizeof(char));
-    if(*string == NULL)
+
+    div = r_largest_common_divisor(n, d);
+    if(div > 1)
     {
-        fprintf(stderr, ERROR_MALLOC_FAILED);
-        exit(EXIT_FAILURE);
+        n /= div;
+        d /= div;
     }
 
-    if(a->d == 1)
+    if(d < 0)
     {
-        n = sprintf(*string, "%d", a->n);
+        n = -n;
+        d = -d;
     }
-    else
+
+    if(n < INT_MIN || n > INT_MAX || d > INT_MAX)
+    {
+        STATS_COUNT(overflowRoundings);
+        r_overflow = 1;
+        return r_approximated(n, d);
+    }
+
+    r.n = (int)n;
+    r.d = (int)d;
+
+    return r;
+}
+
+static struct Rational r_approximated(long long n, long long d)
+{
+    long long x = (n < 0) ? -n : n, y = d, a, t, tmp, p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+    struct Rational r;
+
+    for(;;) /* p1/q1 is the last convergent, p0/q0 the one before. */
     {
-        n = sprintf(*string, "%d/%d", a->n, a->d);
+        a = x / y;
+        if((p1 > 0 && a > (INT_MAX - p0) / p1) || (q1 > 0 && a > (INT_MAX - q0) / q1))
+        {
+            break;
+        }
+        tmp = a * p1 + p0;
+        p0 = p1;
+        p1 = tmp;
+        tmp = a * q1 + q0;
+        q0 = q1;
+        q1 = tmp;
+        tmp = x - a * y;
+        x = y;
+        y = tmp;
+        if(y == 0) /* n/d itself, only reached for fractions which fit. */
+        {
+            r.n = (int)((n < 0) ? -p1 : p1);
+            r.d = (int)q1;
+            return r;
+        }
     }
 
-    if(n>(BUFFER - 1))
+    t = (p1 > 0) ? (INT_MAX - p0) / p1 : INT_MAX; /* Largest intermediate fraction (t p1 + p0) / (t q1 + q0) which fits. */
+    if(q1 > 0 && (INT_MAX - q0) / q1 < t)
+    {
+        t = (INT_MAX - q0) / q1;
+    }
+    if(q1 == 0 || 2 * t > a) /* The intermediate fraction is closer than p1/q1. */
     {
-        fprintf(stderr, "Memory error in toString() method of rational. Emergeny stop program!\n");
-        exit(EXIT_FAILURE);
+        p1 = t * p1 + p0;
+        q1 = t * q1 + q0;
     }
 
-    *string = (char *)realloc(*string, (n+1) * sizeof(char));
+    r.n = (int)((n < 0) ? -p1 : p1);
+    r.d = (int)q1;
 
-    return string;
+    return r;
 }
 
+int rational_is_a_smaller_than_b(struct Rational *a, struct Rational *b)
+{
+    return (rational_compare(*a, *b) < 0) ? 1 : 0;
+}
 
-static int r_largest_common_divisor(int a, int b)
+struct Rational *rational_invert_sign(struct Rational *a)
 {
-    int tmp;
+    return rational_get(-a->n, a->d);
+}
 
-    a = (a<0)?-a:a;
-    b = (b<0)?-b:b;
+struct Rational *rational_clone(struct Rational *a)
+{
+    return rational_get(a->n, a->d);
+}
 
-    do
+size_t rational_format(char *buffer, size_t size, struct Rational a)
+{
+    char string[BUFFER];
+    size_t n;
+
+    n = r_format_integer(string, a.n);
+    if(a.d != 1)
     {
-        if(b > a)
+        string[n++] = '/';
+        n += r_format_integer(string + n, a.d);
+    }
+
+    if(n >= size)
+    {
+        if(size > 0)
         {
-            tmp = a;
-            a = b;
-            b = tmp;
+            buffer[0] = '\0';
         }
-        a -= b;
+        return 0;
     }
-    while(b > 0);
 
-    return a;
+    memcpy(buffer, string, n);
+    buffer[n] = '\0';
+
+    return n;
 }
 
-int rational_is_a_smaller_than_b(struct Rational *a, struct Rational *b)
+size_t rational_parse(const char *string, size_t length, struct Rational *r)
 {
-    int va, vb;
+    size_t i = 0, digits = 0, zeros = 0;
+    int negative = 0, exponentNegative = 0;
+    long long n = 0, d = 1, exponent = 0, div;
 
-    va = (a->n) * (b->d);
-    vb = (b->n) * (a->d);
+    if(i < length && (string[i] == '-' || string[i] == '+'))
+    {
+        negative = (string[i] == '-');
+        ++i;
+    }
 
-    if(va < vb)
+    for(; i < length && string[i] >= '0' && string[i] <= '9'; ++i, ++digits)
     {
-        return 1;
+        if(n > (LLONG_MAX - 9) / 10)
+        {
+            return 0;
+        }
+        n = n * 10 + (string[i] - '0');
+    }
+
+    if(digits > 0 && i + 1 < length && string[i] == '/' && string[i+1] >= '0' && string[i+1] <= '9')
+    {
+        for(++i, d = 0; i < length && string[i] >= '0' && string[i] <= '9'; ++i)
+        {
+            if(d > (LLONG_MAX - 9) / 10)
+            {
+                return 0;
+            }
+            d = d * 10 + (string[i] - '0');
+        }
+        if(d == 0)
+        {
+            return 0;
+        }
     }
     else
+    {
+        if(i < length && string[i] == '.')
+        {
+            for(++i; i < length && string[i] >= '0' && string[i] <= '9'; ++i, ++digits)
+            {
+                if(string[i] == '0') /* Trailing zeros do not change the value. */
+                {
+                    ++zeros;
+                    continue;
+                }
+                if(!r_scale_decimal(&n, (long long)zeros + 1) || !r_scale_decimal(&d, (long long)zeros + 1))
+                {
+                    return 0;
+                }
+                n += string[i] - '0';
+                zeros = 0;
+            }
+        }
+
+        if(digits == 0)
+        {
+            return 0;
+        }
+
+        if(i + 1 < length && (string[i] == 'e' || string[i] == 'E'))
+        {
+            size_t j = i + 1;
+
+            if(j < length && (string[j] == '-' || string[j] == '+'))
+            {
+                exponentNegative = (string[j] == '-');
+                ++j;
+            }
+            if(j < length && string[j] >= '0' && string[j] <= '9')
+            {
+                for(i = j; i < length && string[i] >= '0' && string[i] <= '9'; ++i)
+                {
+                    exponent = exponent * 10 + (string[i] - '0');
+                    if(exponent > 40)
+                    {
+                        return 0;
+                    }
+                }
+                if(n != 0 && !r_scale_decimal(exponentNegative ? &d : &n, exponent))
+                {
+                    return 0;
+                }
+            }
+        }
+    }
+
+    if(digits == 0)
+    {
+        return 0;
+    }
+
+    div = r_largest_common_divisor(n, d);
+    if(div > 1)
+    {
+        n /= div;
+        d /= div;
+    }
+
+    if(n > INT_MAX || d > INT_MAX)
     {
         return 0;
     }
+
+    r->n = negative ? -(int)n : (int)n;
+    r->d = (int)d;
+
+    return i;
 }
 
-struct Rational *rational_invert_sign(struct Rational *a)
+static size_t r_format_integer(char *buffer, long long value)
 {
-    return rational_get(-a->n, a->d);
+    static const char pairs[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+    char digits[20];
+    unsigned long long u;
+    size_t n = 0, k = sizeof(digits);
+
+    if(value < 0)
+    {
+        buffer[n++] = '-';
+        u = 0ULL - (unsigned long long)value;
+    }
+    else
+    {
+        u = (unsigned long long)value;
+    }
+
+    while(u >= 100)
+    {
+        k -= 2;
+        memcpy(digits + k, pairs + 2 * (u % 100), 2);
+        u /= 100;
+    }
+    if(u >= 10)
+    {
+        k -= 2;
+        memcpy(digits + k, pairs + 2 * u, 2);
+    }
+    else
+    {
+        digits[--k] = (char)('0' + u);
+    }
+
+    memcpy(buffer + n, digits + k, sizeof(digits) - k);
+
+    return n + sizeof(digits) - k;
 }
 
-struct Rational *rational_clone(struct Rational *a)
+static int r_scale_decimal(long long *value, long long exponent)
 {
-    return rational_get(a->n, a->d);
+    for(; exponent > 0; --exponent)
+    {
+        if(*value > LLONG_MAX / 10)
+        {
+            return 0;
+        }
+        *value *= 10;
+    }
+
+    return 1;
+}
+
+struct Rational rational_product(struct Rational a, struct Rational b)
+{
+    long long n, d;
+
+    STATS_COUNT(rationalOperations);
+
+    n = (long long)(a.n) * (b.n);
+    d = (long long)(a.d) * (b.d);
+
+    return r_normalized(n, d);
+}
+
+struct Rational rational_quotient(struct Rational a, struct Rational b)
+{
+    long long n, d;
+
+    STATS_COUNT(rationalOperations);
+
+    n = (long long)(a.n) * (b.d);
+    d = (long long)(a.d) * (b.n);
+
+    return r_normalized(n, d);
+}
+
+struct Rational rational_sum(struct Rational a, struct Rational b)
+{
+    long long n, d;
+
+    STATS_COUNT(rationalOperations);
+
+    n = (long long)(a.n) * (b.d) + (long long)(b.n) * (a.d);
+    d = (long long)(a.d) * (b.d);
+
+    return r_normalized(n, d);
+}
+
+struct Rational rational_difference(struct Rational a, struct Rational b)
+{
+    long long n, d;
+
+    STATS_COUNT(rationalOperations);
+
+    n = (long long)(a.n) * (b.d) - (long long)(b.n) * (a.d);
+    d = (long long)(a.d) * (b.d);
+
+    return r_normalized(n, d);
+}
+
+int rational_compare(struct Rational a, struct Rational b)
+{
+    long long va, vb;
+
+    STATS_COUNT(rationalOperations);
+
+    va = (long long)(a.n) * (b.d);
+    vb = (long long)(b.n) * (a.d);
+
+    return (va < vb) ? -1 : ((va > vb) ? 1 : 0);
+}
+
+int rational_overflow()
+{
+    return r_overflow;
+}
+
+void rational_clear_overflow()
+{
+    r_overflow = 0;
 }
@@ -3,6 +3,23 @@
  *
  * This file describes the rational functions and the rational data structure.
  *
+ * The functions never stop the program. Functions which allocate a number
+ * return NULL if no memory is left. A division by zero is reported as NULL by
+ * rational_divide and as denominator 0 by rational_quotient. All functions are
+ * reentrant and thread-safe; a number must not be changed by one thread while
+ * another thread reads it.
+ *
+ * Intermediate products are computed with 64 bit integers and the fraction is
+ * normalized with the Euclidean algorithm before it is narrowed to int, so a
+ * result is exact whenever its normalized form fits into an int, even if the
+ * products of the operands do not.
+ *
+ * Results whose normalized numerator or denominator does not fit into an int
+ * are not exact: they are rounded to the closest fraction which fits, values
+ * beyond +-INT_MAX saturate. Each rounding sets the overflow flag of the
+ * calling thread, see rational_overflow, and is counted as overflowRoundings
+ * of the bound struct SimplexStats.
+ *
  * @file rational.h
  * @author Thomas Irgang
  * @date 17 Feb 2015
@@ -11,6 +28,8 @@
 #ifndef RATIONAL_H
 #define RATIONAL_H RATIONAL_H
 
+#include <stddef.h>
+
 #define BUFFER 40 /**< Buffer size for string representations of rational numbers.  */
 #define ERROR_MALLOC_FAILED "Not enough memory! The call to malloc failed and the programm will stop."
 
@@ -32,7 +51,7 @@ struct Rational
  * This function creates a new rational number with value 0, i.e.
  * n = 0, d = 1.
  *
- * @return new rational number representing 0
+ * @return new rational number representing 0 or NULL if no memory is left
  */
 struct Rational *rational_create();
 
@@ -42,7 +61,7 @@ struct Rational *rational_create();
  * This function creates a new rational number with the
  * value nominator/denominator.
  *
- * @return new rational number nominator/denominator
+ * @return new rational number nominator/denominator or NULL if no memory is left
  */
 struct Rational *rational_get(int nominator, int denominator);
 
@@ -52,7 +71,7 @@ struct Rational *rational_get(int nominator, int denominator);
  * This function creates a new rational number with the
  * value of the given rational number.
  *
- * @return clone of given number
+ * @return clone of given number or NULL if no memory is left
  */
 struct Rational *rational_clone(struct Rational *a);
 
@@ -71,7 +90,7 @@ void rational_normalize(struct Rational *r);
  * This function multiplies to rational numbers and returns the result
  * as new rational number.
  *
- * @return result of multiplication
+ * @return result of multiplication or NULL if no memory is left
  */
 struct Rational *rational_multiply(struct Rational *a, struct Rational *b);
 
@@ -81,7 +100,7 @@ struct Rational *rational_multiply(struct Rational *a, struct Rational *b);
  * This function divides to rational numbers and returns the result
  * as new rational number.
  *
- * @return result of division
+ * @return result of division or NULL if b is 0 or no memory is left
  */
 struct Rational *rational_divide(struct Rational *a, struct Rational *b);
 
@@ -91,7 +110,7 @@ struct Rational *rational_divide(struct Rational *a, struct Rational *b);
  * This function adds to rational numbers and returns the result
  * as new rational number.
  *
- * @return result of addition
+ * @return result of addition or NULL if no memory is left
  */
 struct Rational *rational_add(struct Rational *a, struct Rational *b);
 
@@ -101,7 +120,7 @@ struct Rational *rational_add(struct Rational *a, struct Rational *b);
  * This function subtracts to rational numbers and returns the result
  * as new rational number.
  *
- * @return result of subtraction
+ * @return result of subtraction or NULL if no memory is left
  */
 struct Rational *rational_subtract(struct Rational *a, struct Rational *b);
 
@@ -111,7 +130,7 @@ struct Rational *rational_subtract(struct Rational *a, struct Rational *b);
  * This function inverts the sign of the given rational number and returns
  * the result as new rational number.
  *
- * @return new rational number with inverted sign
+ * @return new rational number with inverted sign or NULL if no memory is left
  */
 struct Rational *rational_invert_sign(struct Rational *a);
 
@@ -125,6 +144,71 @@ struct Rational *rational_invert_sign(struct Rational *a);
  */
 int rational_is_a_smaller_than_b(struct Rational *a, struct Rational *b);
 
+/**
+ * @brief Multiply two rational numbers without allocation.
+ *
+ * This function multiplies the given normalized numbers.
+ *
+ * @return normalized product a*b
+ */
+struct Rational rational_product(struct Rational a, struct Rational b);
+
+/**
+ * @brief Divide two rational numbers without allocation.
+ *
+ * This function divides the given normalized numbers.
+ *
+ * @return normalized quotient a/b, denominator 0 if b is 0
+ */
+struct Rational rational_quotient(struct Rational a, struct Rational b);
+
+/**
+ * @brief Add two rational numbers without allocation.
+ *
+ * This function adds the given normalized numbers.
+ *
+ * @return normalized sum a+b
+ */
+struct Rational rational_sum(struct Rational a, struct Rational b);
+
+/**
+ * @brief Subtract two rational numbers without allocation.
+ *
+ * This function subtracts the given normalized numbers.
+ *
+ * @return normalized difference a-b
+ */
+struct Rational rational_difference(struct Rational a, struct Rational b);
+
+/**
+ * @brief Compare two rational numbers.
+ *
+ * This function compares the given numbers, which must have positive
+ * denominators.
+ *
+ * @return -1 if a<b, 0 if a=b, 1 if a>b
+ */
+int rational_compare(struct Rational a, struct Rational b);
+
+/**
+ * @brief Check for rounded results.
+ *
+ * This function returns the overflow flag of the calling thread. The flag is
+ * set by every result which did not fit into an int and was rounded, and stays
+ * set until rational_clear_overflow is called. It is kept also if
+ * SIMPLEX_NO_STATS is defined.
+ *
+ * @return 1 if a result was rounded since the last rational_clear_overflow, 0 else
+ */
+int rational_overflow();
+
+/**
+ * @brief Clear the overflow flag.
+ *
+ * This function clears the overflow flag of the calling thread.
+ */
+void rational_clear_overflow();
+
 /**
  * @brief Print rational number to stdout.
  *
@@ -139,8 +223,44 @@ void rational_print(struct Rational *a);
  * This function converts the rational number to a string, i.e. it returns
  * a char** with content "nominator/denominator\0".
  *
- * @return pointer to string representation
+ * @return pointer to string representation or NULL if no memory is left
  */
 char **rational_to_string(struct Rational *a);
 
+/**
+ * @brief Format rational number into a buffer.
+ *
+ * This function writes the given rational number as "nominator/denominator\0",
+ * or "nominator\0" if the denominator is 1, to the given buffer. It does not
+ * allocate memory. A buffer of size BUFFER is always large enough.
+ *
+ * @param buffer
+ *    buffer for the string representation
+ * @param size
+ *    size of the buffer
+ * @param a
+ *    number to format
+ * @return number of written characters without '\0', 0 if the buffer is too small
+ */
+size_t rational_format(char *buffer, size_t size, struct Rational a);
+
+/**
+ * @brief Parse rational number.
+ *
+ * This function parses a rational number from the first length characters of
+ * the given string. Accepted are an optional sign followed by an integer
+ * ("-3"), a fraction ("2/3") or an exact decimal number with optional exponent
+ * ("0.125", "1.5e-2"). Decimal numbers are converted exactly, without floating
+ * point arithmetic. The string does not need to be terminated by '\0'.
+ *
+ * @param string
+ *    characters to parse
+ * @param length
+ *    number of available characters
+ * @param r
+ *    normalized result
+ * @return number of parsed characters, 0 if the input is no valid number or does not fit into a rational number
+ */
+size_t rational_parse(const char *string, size_t length, struct Rational *r);
+
 #endif
@@ -0,0 +1,683 @@
+/**
+ * @brief Benchmark of the rational operations.
+ *
+ * This file implements a program which measures the throughput of the
+ * rational operations over several operand distributions. Besides synthetic
+ * distributions the operands are captured from the tableau entries of real
+ * pivots. If the kernel allows it, the hardware counters for cycles,
+ * instructions, cache misses and branch misses are read with perf_event_open
+ * on Linux, otherwise their columns stay empty.
+ *
+ * Usage: rational_benchmark [options]
+ *   --ops N       operations per measurement
+ *   --repeat N    measurements per operation, the fastest one is reported
+ *   --seed N      seed of the synthetic distributions
+ *   --file PATH   problem in MPS or LP format for captured operands
+ *   --format F    csv or json
+ *
+ * @file rational_benchmark.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#define _GNU_SOURCE /**< syscall of unistd.h. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#include "rational.h"
+#include "simplex.h"
+#include "stats.h"
+#include "lp_model.h"
+#include "lp_reader.h"
+
+#define RATIONAL_BENCHMARK_POOL 4096 /**< Number of operands per distribution. */
+#define RATIONAL_BENCHMARK_COUNTERS 4 /**< Number of hardware counters. */
+
+/**
+ * @brief Operation to measure.
+ *
+ * @param a
+ *    first operands
+ * @param b
+ *    second operands
+ * @param count
+ *    number of operations
+ * @return value depending on all results, prevents optimizing the operations away
+ */
+typedef long RationalKernel(struct Rational *a, struct Rational *b, long count);
+
+/**
+ * @brief Named operation.
+ */
+struct RationalOperation
+{
+    const char *name; /**< Name of operation. */
+    RationalKernel *run; /**< Kernel of operation. */
+};
+
+/**
+ * @brief Hardware counters of the calling thread.
+ */
+struct RationalCounters
+{
+    int fd[RATIONAL_BENCHMARK_COUNTERS]; /**< Counter file descriptors, -1 if not available. */
+    long long values[RATIONAL_BENCHMARK_COUNTERS]; /**< Values of last measurement. */
+};
+
+/**
+ * @brief Open the hardware counters.
+ *
+ * @param counters
+ *    counters to open, unavailable counters get fd -1
+ */
+static void counters_open(struct RationalCounters *counters);
+
+/**
+ * @brief Close the hardware counters.
+ *
+ * @param counters
+ *    counters to close
+ */
+static void counters_close(struct RationalCounters *counters);
+
+/**
+ * @brief Reset and start the hardware counters.
+ *
+ * @param counters
+ *    counters to start
+ */
+static void counters_start(struct RationalCounters *counters);
+
+/**
+ * @brief Stop and read the hardware counters.
+ *
+ * @param counters
+ *    counters to stop, values are updated
+ */
+static void counters_stop(struct RationalCounters *counters);
+
+/**
+ * @brief Fill operands with random fractions.
+ *
+ * @param pool
+ *    operands to fill
+ * @param random
+ *    state of random number generator
+ * @param limit
+ *    limit for numerator and denominator
+ */
+static void fill_random(struct Rational *pool, unsigned long long *random, int limit);
+
+/**
+ * @brief Fill operands with tableau entries of real pivots.
+ *
+ * This function solves the given tableau pivot by pivot and collects the
+ * none zero entries after each pivot. If the solve ends before the pool is
+ * full, the collected entries are repeated.
+ *
+ * @param pool
+ *    operands to fill
+ * @param tableau
+ *    problem to solve, freed afterwards
+ * @return 1 if operands were found, 0 else
+ */
+static int fill_pivots(struct Rational *pool, struct Tableau *tableau);
+
+/**
+ * @brief Random dense problem.
+ *
+ * @param size
+ *    number of equations and variables
+ * @param random
+ *    state of random number generator
+ * @return new tableau
+ */
+static struct Tableau *dense_tableau(int size, unsigned long long *random);
+
+/**
+ * @brief Next random number.
+ *
+ * @param random
+ *    state of xorshift generator
+ * @param low
+ *    smallest number
+ * @param high
+ *    largest number
+ * @return uniformly distributed number in [low, high]
+ */
+static int random_int(unsigned long long *random, int low, int high);
+
+/**
+ * @brief Measure all operations for one distribution.
+ *
+ * @param name
+ *    name of distribution
+ * @param a
+ *    first operands
+ * @param b
+ *    second operands
+ * @param ops
+ *    operations per measurement
+ * @param repeat
+ *    measurements per operation
+ * @param json
+ *    1 for JSON output, 0 for CSV
+ * @param rows
+ *    number of written results, updated
+ */
+static void run_distribution(const char *name, struct Rational *a, struct Rational *b, long ops, int repeat, int json,
+                             int *rows);
+
+static long kernel_add(struct Rational *a, struct Rational *b, long count); /**< rational_add */
+static long kernel_multiply(struct Rational *a, struct Rational *b, long count); /**< rational_multiply */
+static long kernel_divide(struct Rational *a, struct Rational *b, long count); /**< rational_divide */
+static long kernel_normalize(struct Rational *a, struct Rational *b, long count); /**< rational_normalize */
+static long kernel_smaller(struct Rational *a, struct Rational *b, long count); /**< rational_is_a_smaller_than_b */
+static long kernel_sum(struct Rational *a, struct Rational *b, long count); /**< rational_sum */
+static long kernel_product(struct Rational *a, struct Rational *b, long count); /**< rational_product */
+static long kernel_quotient(struct Rational *a, struct Rational *b, long count); /**< rational_quotient */
+static long kernel_compare(struct Rational *a, struct Rational *b, long count); /**< rational_compare */
+
+static const struct RationalOperation operations[] =
+{
+    {"rational_add", kernel_add},
+    {"rational_multiply", kernel_multiply},
+    {"rational_divide", kernel_divide},
+    {"rational_normalize", kernel_normalize},
+    {"rational_is_a_smaller_than_b", kernel_smaller},
+    {"rational_sum", kernel_sum},
+    {"rational_product", kernel_product},
+    {"rational_quotient", kernel_quotient},
+    {"rational_compare", kernel_compare}
+};
+
+static const char *counter_names[RATIONAL_BENCHMARK_COUNTERS] =
+{
+    "cycles", "instructions", "cache_misses", "branch_misses"
+};
+
+static volatile long sink; /**< Collects kernel results. */
+
+/**
+ * @brief Run the benchmark.
+ *
+ * @param argc
+ *    number of arguments
+ * @param argv
+ *    arguments
+ * @return EXIT_SUCCESS or EXIT_FAILURE for invalid arguments
+ */
+int main(int argc, char **argv)
+{
+    struct Rational a[RATIONAL_BENCHMARK_POOL], b[RATIONAL_BENCHMARK_POOL];
+    struct LpReadError error;
+    struct LpModel *model;
+    unsigned long long random = 1;
+    const char *file = NULL;
+    long ops = 1000000;
+    int i, repeat = 5, json = 0, rows = 0;
+
+    for(i=1; i<argc; ++i)
+    {
+        if(i + 1 >= argc)
+        {
+            fprintf(stderr, "Missing value of option %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+        if(strcmp(argv[i], "--ops") == 0)
+        {
+            ops = atol(argv[++i]);
+        }
+        else if(strcmp(argv[i], "--repeat") == 0)
+        {
+            repeat = atoi(argv[++i]);
+        }
+        else if(strcmp(argv[i], "--seed") == 0)
+        {
+            random = strtoull(argv[++i], NULL, 10);
+        }
+        else if(strcmp(argv[i], "--file") == 0)
+        {
+            file = argv[++i];
+        }
+        else if(strcmp(argv[i], "--format") == 0)
+        {
+            json = strcmp(argv[++i], "json") == 0;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+    ops = (ops < 1) ? 1 : ops;
+    repeat = (repeat < 1) ? 1 : repeat;
+    random = random * 0x9E3779B97F4A7C15ULL + 1;
+
+    if(json)
+    {
+        printf("[\n");
+    }
+    else
+    {
+        printf("distribution,operation,operations,ns_per_op");
+        for(i=0; i<RATIONAL_BENCHMARK_COUNTERS; ++i)
+        {
+            printf(",%s_per_op", counter_names[i]);
+        }
+        printf("\n");
+    }
+
+    fill_random(a, &random, 16);
+    fill_random(b, &random, 16);
+    run_distribution("small", a, b, ops, repeat, json, &rows);
+
+    fill_random(a, &random, 1 << 20);
+    fill_random(b, &random, 1 << 20);
+    run_distribution("large", a, b, ops, repeat, json, &rows);
+
+    if(fill_pivots(a, dense_tableau(12, &random)))
+    {
+        memcpy(b, a + 1, (RATIONAL_BENCHMARK_POOL - 1) * sizeof(struct Rational));
+        b[RATIONAL_BENCHMARK_POOL - 1] = a[0];
+        run_distribution("pivots-dense", a, b, ops, repeat, json, &rows);
+    }
+
+    if(file != NULL)
+    {
+        model = lp_read_file(file, &error);
+        if(model == NULL)
+        {
+            fprintf(stderr, "%s:%d: %s\n", file, error.line, error.message);
+        }
+        else
+        {
+            if(fill_pivots(a, lp_model_compile(model)))
+            {
+                memcpy(b, a + 1, (RATIONAL_BENCHMARK_POOL - 1) * sizeof(struct Rational));
+                b[RATIONAL_BENCHMARK_POOL - 1] = a[0];
+                run_distribution(file, a, b, ops, repeat, json, &rows);
+            }
+            lp_model_free(model);
+        }
+    }
+
+    if(json)
+    {
+        printf("\n]\n");
+    }
+
+    return EXIT_SUCCESS;
+}
+
+static void counters_open(struct RationalCounters *counters)
+{
+#ifdef __linux__
+    struct perf_event_attr attr;
+    unsigned long long configs[RATIONAL_BENCHMARK_COUNTERS] =
+    {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    int i;
+
+    for(i=0; i<RATIONAL_BENCHMARK_COUNTERS; ++i)
+    {
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = configs[i];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        counters->fd[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0); /* -1 without permission or PMU. */
+        counters->values[i] = -1;
+    }
+#else
+    int i;
+
+    for(i=0; i<RATIONAL_BENCHMARK_COUNTERS; ++i) /* No perf_event_open. */
+    {
+        counters->fd[i] = -1;
+        counters->values[i] = -1;
+    }
+#endif
+}
+
+static void counters_close(struct RationalCounters *counters)
+{
+    int i;
+
+    for(i=0; i<RATIONAL_BENCHMARK_COUNTERS; ++i)
+    {
+        if(counters->fd[i] >= 0)
+        {
+            close(counters->fd[i]);
+        }
+    }
+}
+
+static void counters_start(struct RationalCounters *counters)
+{
+    int i;
+
+    for(i=0; i<RATIONAL_BENCHMARK_COUNTERS; ++i)
+    {
+        if(counters->fd[i] >= 0)
+        {
+#ifdef __linux__
+            ioctl(counters->fd[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(counters->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+#endif
+        }
+    }
+}
+
+static void counters_stop(struct RationalCounters *counters)
+{
+    long long value;
+    int i;
+
+    for(i=0; i<RATIONAL_BENCHMARK_COUNTERS; ++i)
+    {
+        counters->values[i] = -1;
+        if(counters->fd[i] >= 0)
+        {
+#ifdef __linux__
+            ioctl(counters->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+#endif
+            if(read(counters->fd[i], &value, sizeof(value)) == (ssize_t)sizeof(value))
+            {
+                counters->values[i] = value;
+            }
+        }
+    }
+}
+
+static void fill_random(struct Rational *pool, unsigned long long *random, int limit)
+{
+    int i;
+
+    for(i=0; i<RATIONAL_BENCHMARK_POOL; ++i)
+    {
+        pool[i].n = random_int(random, -limit, limit);
+        pool[i].d = random_int(random, 1, limit);
+        rational_normalize(&(pool[i]));
+        if(pool[i].n == 0) /* Keep divisions valid. */
+        {
+            pool[i].n = 1;
+        }
+    }
+}
+
+static int fill_pivots(struct Rational *pool, struct Tableau *tableau)
+{
+    struct SimplexContext *context;
+    int i, j, count = 0;
+
+    context = (tableau != NULL) ? simplex_context_create(tableau) : NULL;
+    if(context == NULL)
+    {
+        simplex_free_tableau(tableau);
+        return 0;
+    }
+    context->form = SIMPLEX_FORM_PRIMAL;
+    while(count < RATIONAL_BENCHMARK_POOL && simplex_iterate(context, 1) == SIMPLEX_LIMIT_REACHED)
+    {
+        for(i=0; i<context->tableau->rows && count < RATIONAL_BENCHMARK_POOL; ++i)
+        {
+            for(j=0; j<context->tableau->cols && count < RATIONAL_BENCHMARK_POOL; ++j)
+            {
+                if((context->tableau->A[i][j])->n != 0)
+                {
+                    pool[count++] = *(context->tableau->A[i][j]);
+                }
+            }
+            if(count < RATIONAL_BENCHMARK_POOL && (context->tableau->b[i])->n != 0)
+            {
+                pool[count++] = *(context->tableau->b[i]);
+            }
+        }
+    }
+    simplex_context_free(context);
+    simplex_free_tableau(tableau);
+
+    for(i=count; count > 0 && i<RATIONAL_BENCHMARK_POOL; ++i)
+    {
+        pool[i] = pool[i % count];
+    }
+
+    return count > 0;
+}
+
+static struct Tableau *dense_tableau(int size, unsigned long long *random)
+{
+    struct Tableau *tableau;
+    int i, j;
+
+    tableau = simplex_create_tableau(size, 2 * size);
+    for(j=0; j<size; ++j)
+    {
+        tableau->nbvs[j] = j;
+        (tableau->c[j])->n = random_int(random, 1, 9);
+    }
+    for(i=0; i<size; ++i)
+    {
+        tableau->bvs[i] = size + i;
+        (tableau->b[i])->n = random_int(random, 10 * size, 20 * size);
+        for(j=0; j<size; ++j)
+        {
+            (tableau->A[i][j])->n = random_int(random, 1, 9);
+        }
+    }
+
+    return tableau;
+}
+
+static int random_int(unsigned long long *random, int low, int high)
+{
+    unsigned long long x = *random;
+
+    x ^= x >> 12; /* xorshift64* */
+    x ^= x << 25;
+    x ^= x >> 27;
+    *random = x;
+    x *= 0x2545F4914F6CDD1DULL;
+
+    return low + (int)((x >> 33) % (unsigned long long)(high - low + 1));
+}
+
+static void run_distribution(const char *name, struct Rational *a, struct Rational *b, long ops, int repeat, int json,
+                             int *rows)
+{
+    struct RationalCounters counters;
+    long long best[RATIONAL_BENCHMARK_COUNTERS];
+    double start, seconds, fastest;
+    int k, r, i;
+
+    counters_open(&counters);
+    for(k=0; k<(int)(sizeof(operations) / sizeof(operations[0])); ++k)
+    {
+        sink += operations[k].run(a, b, ops / 10 + 1); /* Warm up caches and branch predictors. */
+        fastest = -1.0;
+        for(r=0; r<repeat; ++r)
+        {
+            counters_start(&counters);
+            start = stats_now();
+            sink += operations[k].run(a, b, ops);
+            seconds = stats_now() - start;
+            counters_stop(&counters);
+            if(fastest < 0.0 || seconds < fastest)
+            {
+                fastest = seconds;
+                memcpy(best, counters.values, sizeof(best));
+            }
+        }
+
+        if(json)
+        {
+            printf("%s  {\"distribution\": \"%s\", \"operation\": \"%s\", \"operations\": %ld, \"ns_per_op\": %.3f",
+                   (*rows > 0) ? ",\n" : "", name, operations[k].name, ops, fastest * 1e9 / ops);
+            for(i=0; i<RATIONAL_BENCHMARK_COUNTERS; ++i)
+            {
+                if(best[i] >= 0)
+                {
+                    printf(", \"%s_per_op\": %.3f", counter_names[i], (double)best[i] / ops);
+                }
+                else
+                {
+                    printf(", \"%s_per_op\": null", counter_names[i]);
+                }
+            }
+            printf("}");
+        }
+        else
+        {
+            printf("%s,%s,%ld,%.3f", name, operations[k].name, ops, fastest * 1e9 / ops);
+            for(i=0; i<RATIONAL_BENCHMARK_COUNTERS; ++i)
+            {
+                if(best[i] >= 0)
+                {
+                    printf(",%.3f", (double)best[i] / ops);
+                }
+                else
+                {
+                    printf(",");
+                }
+            }
+            printf("\n");
+        }
+        fflush(stdout);
+        ++(*rows);
+    }
+    counters_close(&counters);
+}
+
+static long kernel_add(struct Rational *a, struct Rational *b, long count)
+{
+    struct Rational *r;
+    long i, result = 0;
+
+    for(i=0; i<count; ++i)
+    {
+        r = rational_add(&(a[i % RATIONAL_BENCHMARK_POOL]), &(b[i % RATIONAL_BENCHMARK_POOL]));
+        result += r->n;
+        free(r);
+    }
+
+    return result;
+}
+
+static long kernel_multiply(struct Rational *a, struct Rational *b, long count)
+{
+    struct Rational *r;
+    long i, result = 0;
+
+    for(i=0; i<count; ++i)
+    {
+        r = rational_multiply(&(a[i % RATIONAL_BENCHMARK_POOL]), &(b[i % RATIONAL_BENCHMARK_POOL]));
+        result += r->n;
+        free(r);
+    }
+
+    return result;
+}
+
+static long kernel_divide(struct Rational *a, struct Rational *b, long count)
+{
+    struct Rational *r;
+    long i, result = 0;
+
+    for(i=0; i<count; ++i)
+    {
+        r = rational_divide(&(a[i % RATIONAL_BENCHMARK_POOL]), &(b[i % RATIONAL_BENCHMARK_POOL]));
+        result += r->n;
+        free(r);
+    }
+
+    return result;
+}
+
+static long kernel_normalize(struct Rational *a, struct Rational *b, long count)
+{
+    struct Rational r;
+    long i, result = 0;
+
+    for(i=0; i<count; ++i) /* Numerator and denominator of a with the common factor |b.n|. */
+    {
+        r = a[i % RATIONAL_BENCHMARK_POOL];
+        r.n *= (b[i % RATIONAL_BENCHMARK_POOL].n & 15) + 1;
+        r.d *= (b[i % RATIONAL_BENCHMARK_POOL].n & 15) + 1;
+        rational_normalize(&r);
+        result += r.n;
+    }
+
+    return result;
+}
+
+static long kernel_smaller(struct Rational *a, struct Rational *b, long count)
+{
+    long i, result = 0;
+
+    for(i=0; i<count; ++i)
+    {
+        result += rational_is_a_smaller_than_b(&(a[i % RATIONAL_BENCHMARK_POOL]), &(b[i % RATIONAL_BENCHMARK_POOL]));
+    }
+
+    return result;
+}
+
+static long kernel_sum(struct Rational *a, struct Rational *b, long count)
+{
+    long i, result = 0;
+
+    for(i=0; i<count; ++i)
+    {
+        result += rational_sum(a[i % RATIONAL_BENCHMARK_POOL], b[i % RATIONAL_BENCHMARK_POOL]).n;
+    }
+
+    return result;
+}
+
+static long kernel_product(struct Rational *a, struct Rational *b, long count)
+{
+    long i, result = 0;
+
+    for(i=0; i<count; ++i)
+    {
+        result += rational_product(a[i % RATIONAL_BENCHMARK_POOL], b[i % RATIONAL_BENCHMARK_POOL]).n;
+    }
+
+    return result;
+}
+
+static long kernel_quotient(struct Rational *a, struct Rational *b, long count)
+{
+    long i, result = 0;
+
+    for(i=0; i<count; ++i)
+    {
+        result += rational_quotient(a[i % RATIONAL_BENCHMARK_POOL], b[i % RATIONAL_BENCHMARK_POOL]).n;
+    }
+
+    return result;
+}
+
+static long kernel_compare(struct Rational *a, struct Rational *b, long count)
+{
+    long i, result = 0;
+
+    for(i=0; i<count; ++i)
+    {
+        result += rational_compare(a[i % RATIONAL_BENCHMARK_POOL], b[i % RATIONAL_BENCHMARK_POOL]);
+    }
+
+    return result;
+}
@@ -0,0 +1,179 @@
+/**
+ * @brief Source file for sensitivity.
+ *
+ * This file implements the sensitivity analysis of optimal simplex tableaus.
+ *
+ * @file sensitivity.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdlib.h>
+
+#include "sensitivity.h"
+
+/**
+ * @brief Allocate an array.
+ *
+ * This function allocates the given number of elements, at least one.
+ *
+ * @param elements
+ *    number of elements
+ * @param size
+ *    size of one element
+ * @return new array or NULL if no memory is left
+ */
+static void *sensitivity_alloc(int elements, size_t size);
+
+/**
+ * @brief Narrow a range.
+ *
+ * This function limits the given end of the range to value.
+ *
+ * @param range
+ *    range to narrow
+ * @param value
+ *    new limit
+ * @param end
+ *    SIMPLEX_RANGE_LOWER or SIMPLEX_RANGE_UPPER
+ */
+static void range_limit(struct SimplexRange *range, struct Rational value, int end);
+
+struct SimplexSensitivity *simplex_sensitivity(struct Tableau *tableau)
+{
+    struct SimplexSensitivity *sensitivity;
+    struct Rational zero = {0, 1}, value;
+    int i, j, variable, line, *column;
+
+    sensitivity = (struct SimplexSensitivity *)sensitivity_alloc(1, sizeof(struct SimplexSensitivity));
+    if(sensitivity == NULL)
+    {
+        return NULL;
+    }
+    sensitivity->rows = tableau->rows;
+    sensitivity->cols = tableau->artificials - tableau->rows;
+    sensitivity->duals = (struct Rational *)sensitivity_alloc(sensitivity->rows, sizeof(struct Rational));
+    sensitivity->reducedCosts = (struct Rational *)sensitivity_alloc(sensitivity->cols, sizeof(struct Rational));
+    sensitivity->limits = (struct SimplexRange *)sensitivity_alloc(sensitivity->rows, sizeof(struct SimplexRange));
+    sensitivity->costs = (struct SimplexRange *)sensitivity_alloc(sensitivity->cols, sizeof(struct SimplexRange));
+    column = (int *)sensitivity_alloc(tableau->cols, sizeof(int));
+    if(sensitivity->duals == NULL || sensitivity->reducedCosts == NULL || sensitivity->limits == NULL
+       || sensitivity->costs == NULL || column == NULL)
+    {
+        simplex_sensitivity_free(sensitivity);
+        free(column);
+        return NULL;
+    }
+
+    for(i=0; i<sensitivity->rows; ++i)
+    {
+        sensitivity->duals[i] = zero;
+        sensitivity->limits[i].lower = zero;
+        sensitivity->limits[i].upper = zero;
+        sensitivity->limits[i].bounded = 0;
+    }
+    for(j=0; j<sensitivity->cols; ++j)
+    {
+        sensitivity->reducedCosts[j] = zero;
+        sensitivity->costs[j].lower = zero;
+        sensitivity->costs[j].upper = zero;
+        sensitivity->costs[j].bounded = 0;
+    }
+
+    for(j=0; j<tableau->cols; ++j) /* None basis variables: reduced costs and dual values. */
+    {
+        variable = tableau->nbvs[j];
+        column[j] = -1;
+        if(variable >= tableau->artificials)
+        {
+            continue;
+        }
+        value = *(tableau->c[j]);
+        value.n = -value.n;
+        if(variable < sensitivity->cols) /* c_j can grow until the reduced cost is 0. */
+        {
+            sensitivity->reducedCosts[variable] = *(tableau->c[j]);
+            sensitivity->costs[variable].upper = value;
+            sensitivity->costs[variable].bounded = SIMPLEX_RANGE_UPPER;
+        }
+        else
+        {
+            sensitivity->duals[variable - sensitivity->cols] = value;
+            column[j] = variable - sensitivity->cols;
+        }
+    }
+
+    for(i=0; i<tableau->rows; ++i)
+    {
+        variable = tableau->bvs[i];
+        line = (variable >= sensitivity->cols && variable < tableau->artificials) ? variable - sensitivity->cols : -1;
+        if(line >= 0) /* Basis slack variable: b_i can shrink by its value. */
+        {
+            value = *(tableau->b[i]);
+            value.n = -value.n;
+            range_limit(&(sensitivity->limits[line]), value, SIMPLEX_RANGE_LOWER);
+        }
+
+        for(j=0; j<tableau->cols; ++j)
+        {
+            if((tableau->A[i][j])->n == 0 || tableau->nbvs[j] >= tableau->artificials)
+            {
+                continue;
+            }
+            if(variable < sensitivity->cols) /* c' = c - delta A_i <= 0 */
+            {
+                range_limit(&(sensitivity->costs[variable]), rational_quotient(*(tableau->c[j]), *(tableau->A[i][j])),
+                            ((tableau->A[i][j])->n > 0) ? SIMPLEX_RANGE_LOWER : SIMPLEX_RANGE_UPPER);
+            }
+            if(column[j] >= 0) /* b' = b + delta A_j >= 0 */
+            {
+                value = rational_quotient(*(tableau->b[i]), *(tableau->A[i][j]));
+                value.n = -value.n;
+                range_limit(&(sensitivity->limits[column[j]]), value,
+                            ((tableau->A[i][j])->n > 0) ? SIMPLEX_RANGE_LOWER : SIMPLEX_RANGE_UPPER);
+            }
+        }
+    }
+
+    free(column);
+
+    return sensitivity;
+}
+
+void simplex_sensitivity_free(struct SimplexSensitivity *sensitivity)
+{
+    free(sensitivity->duals);
+    free(sensitivity->reducedCosts);
+    free(sensitivity->limits);
+    free(sensitivity->costs);
+    free(sensitivity);
+}
+
+static void *sensitivity_alloc(int elements, size_t size)
+{
+    void *array;
+
+    array = malloc((size_t)((elements > 0) ? elements : 1) * size);
+
+    return array;
+}
+
+static void range_limit(struct SimplexRange *range, struct Rational value, int end)
+{
+    if(end == SIMPLEX_RANGE_LOWER)
+    {
+        if(!(range->bounded & SIMPLEX_RANGE_LOWER) || rational_compare(value, range->lower) > 0)
+        {
+            range->lower = value;
+            range->bounded |= SIMPLEX_RANGE_LOWER;
+        }
+    }
+    else
+    {
+        if(!(range->bounded & SIMPLEX_RANGE_UPPER) || rational_compare(value, range->upper) < 0)
+        {
+            range->upper = value;
+            range->bounded |= SIMPLEX_RANGE_UPPER;
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/**
+ * @brief Header file for sensitivity.
+ *
+ * This file describes the sensitivity analysis of an optimal simplex tableau:
+ * dual values, reduced costs and the ranges in which the limits b and the
+ * target function coefficients c can change without changing the optimal
+ * basis.
+ *
+ * @file sensitivity.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef SENSITIVITY_H
+#define SENSITIVITY_H SENSITIVITY_H
+
+#include "rational.h"
+#include "simplex.h"
+
+#define SIMPLEX_RANGE_LOWER 1 /**< Flag for finite lower end of a range. */
+#define SIMPLEX_RANGE_UPPER 2 /**< Flag for finite upper end of a range. */
+
+/**
+ * @brief Range of a change.
+ *
+ * This structure describes the interval lower <= delta <= upper of changes
+ * which keep the basis optimal. Missing flags mean -inf or +inf.
+ */
+struct SimplexRange
+{
+    struct Rational lower; /**< Smallest change, <= 0, valid if SIMPLEX_RANGE_LOWER is set. */
+    struct Rational upper; /**< Largest change, >= 0, valid if SIMPLEX_RANGE_UPPER is set. */
+    int bounded; /**< SIMPLEX_RANGE_LOWER and SIMPLEX_RANGE_UPPER flags. */
+};
+
+/**
+ * @brief Sensitivity of an optimal tableau.
+ *
+ * This structure holds the sensitivity analysis of a problem
+ * max cx s.t. Ax <= b, x >= 0 with the variables 0, ..., cols-1 and the slack
+ * variable cols+i of equation i.
+ */
+struct SimplexSensitivity
+{
+    int rows; /**< Number of equations. */
+    int cols; /**< Number of variables without slack variables. */
+    struct Rational *duals; /**< Dual values (shadow prices): change of the target function value per unit of b[i]. */
+    struct Rational *reducedCosts; /**< Reduced costs of the variables, 0 for basis variables. */
+    struct SimplexRange *limits; /**< Ranges for the changes of b[i]. */
+    struct SimplexRange *costs; /**< Ranges for the changes of c[j]. */
+};
+
+/**
+ * @brief Analyse an optimal tableau.
+ *
+ * This function calculates the sensitivity of the given optimal tableau in one
+ * pass over its entries. The tableau must use the variables as described for
+ * SimplexSensitivity, e.g. the tableaus of main.c and lp_model_to_tableau or
+ * tableaus of lp_model_compile without equations, and must not contain
+ * artificial variables.
+ *
+ * @param tableau
+ *    optimal tableau
+ * @return new sensitivity analysis or NULL if no memory is left
+ */
+struct SimplexSensitivity *simplex_sensitivity(struct Tableau *tableau);
+
+/**
+ * @brief Free memory of given sensitivity analysis.
+ *
+ * @param sensitivity
+ *    analysis to free
+ */
+void simplex_sensitivity_free(struct SimplexSensitivity *sensitivity);
+
+#endif
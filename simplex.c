@@ -11,6 +11,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <sys/mman.h>
 
 #include "simplex.h"
 
@@ -40,566 +42,2053 @@ static void resize_tableau(struct Tableau *tableau, int equations, int variables
  */
 static void update_pivot(struct Tableau *tableau);
 
+/**
+ * @brief Update pivot element with the rule of Dantzig.
+ *
+ * This function chooses the column with the largest coefficient of the target
+ * function and the line of the ratio test. Degenerate pivots are left to the
+ * rule of Bland, so the algorithm can not cycle.
+ *
+ * @param tableau
+ *    tableau to update pivot
+ * @return 1 if the pivot was chosen, 0 if the rule of Bland has to be used
+ */
+static int update_pivot_dantzig(struct Tableau *tableau);
+
 /**
  * @brief Implementation of simplex step.
  *
  * This function implements the simplex step. It switch, based on the values
- * of pivotLine and pivotColumn, a basis and a none basis variable.
+ * of pivotLine and pivotColumn, a basis and a none basis variable. The cells
+ * are updated in place; only shared lines are copied before.
  *
  * @param tableau
  *    tableau to calculate step
+ * @return 0 on success, -1 if no memory is left; the tableau is unchanged then
+ */
+static int simplex_step(struct Tableau *tableau);
+
+/**
+ * @brief Create extended tableau for phase 1.
+ *
+ * This function creates the extended tableau of phase 1 for the given tableau,
+ * i.e. a copy of the tableau with a new identity matrix and the auxiliary
+ * target function.
+ *
+ * @param tab
+ *    tableau to find start corner
+ * @return extended tableau, ready for the first pivot, or NULL if no memory is left
+ */
+static struct Tableau *create_phase1_tableau(struct Tableau *tab);
+
+/**
+ * @brief Check for improving columns.
+ *
+ * This function checks if the target function of the given tableau has a
+ * positive coefficient. If update_pivot found no pivot this means that the
+ * target function is unbounded.
+ *
+ * @param tableau
+ *    tableau to check
+ * @return 1 if a coefficient of c is positive, 0 else
+ */
+static int has_improving_column(struct Tableau *tableau);
+
+/**
+ * @brief Start phase 1 in the tableau itself.
+ *
+ * This function replaces the target function of the given tableau by the sum of
+ * the artificial basis variables, which has to be minimized. All basis
+ * variables must have valid values, see simplex_crash.
+ *
+ * @param tableau
+ *    tableau to prepare
+ * @param target
+ *    set to z followed by the target function coefficients of all variables, or NULL if there is no artificial basis variable
+ * @return 0 on success, -1 if no memory is left
+ */
+static int start_phase1_in_place(struct Tableau *tableau, struct Rational **target);
+
+/**
+ * @brief Finish phase 1 in the tableau itself.
+ *
+ * This function exchanges artificial basis variables with value 0, removes the
+ * columns of artificial variables and restores the given target function. It
+ * expects a phase 1 with target function value 0.
+ *
+ * @param tableau
+ *    tableau to prepare for phase 2
+ * @param cost
+ *    target function returned by start_phase1_in_place
+ * @return 0 on success, -1 if no memory is left
+ */
+static int finish_phase1_in_place(struct Tableau *tableau, struct Rational *cost);
+
+/**
+ * @brief Remove a column.
+ *
+ * This function removes the given none basis variable from the tableau. The
+ * last column takes its place.
+ *
+ * @param tableau
+ *    tableau to shrink
+ * @param column
+ *    column to remove
+ * @return 0 on success, -1 if no memory is left to copy shared lines
+ */
+static int remove_column(struct Tableau *tableau, int column);
+
+/**
+ * @brief Append a column.
+ *
+ * This function appends a 0-filled column for the given none basis variable.
+ *
+ * @param tableau
+ *    tableau to extend
+ * @param variable
+ *    variable of new column
+ * @return 0 on success, -1 if no memory is left; the tableau keeps its columns then
+ */
+static int add_column(struct Tableau *tableau, int variable);
+
+/**
+ * @brief Add artificial variables for invalid lines.
+ *
+ * This function negates each line with negative basis variable and makes an
+ * artificial variable its basis variable. The old basis variable becomes a new
+ * column.
+ *
+ * @param tableau
+ *    tableau to prepare for phase 1
+ * @return 0 on success, -1 if no memory is left
+ */
+static int add_artificials(struct Tableau *tableau);
+
+/**
+ * @brief Find crash pivot column.
+ *
+ * This function searches a column which makes the basis variable of the given
+ * line valid without making a valid basis variable invalid. The column must be 0
+ * in all lines marked in "crashed", so that the crash basis stays triangular.
+ * Of the possible columns the one which fixes most invalid lines is chosen.
+ *
+ * @param tableau
+ *    tableau to search
+ * @param line
+ *    line with invalid basis variable
+ * @param crashed
+ *    lines which got a new basis variable from the crash
+ * @return pivot column or -1
+ */
+static int find_crash_column(struct Tableau *tableau, int line, const int *crashed);
+
+/**
+ * @brief Choose the form of the problem to solve.
+ *
+ * This function estimates the pivots of the primal and the dual problem by
+ * the number of equations plus the number of invalid basis variables. The dual
+ * problem is chosen if it needs less than half of the pivots, as it has to be
+ * built and the primal solution is recovered with up to cols pivots.
+ *
+ * @param tableau
+ *    tableau of problem
+ * @return SIMPLEX_FORM_PRIMAL or SIMPLEX_FORM_DUAL
+ */
+static enum SimplexForm choose_form(struct Tableau *tableau);
+
+/**
+ * @brief Find the position of a variable.
+ *
+ * This function looks up the given variable in the index of the tableau and
+ * rebuilds the index if the entry does not match bvs or nbvs. If there is no
+ * memory for the index the basis is searched.
+ *
+ * @param tableau
+ *    tableau to search
+ * @param variable
+ *    existing variable
+ * @return basis line i as i, none basis column j as -(j+1), rows if the variable is missing
+ */
+static int find_position(struct Tableau *tableau, int variable);
+
+/**
+ * @brief Check an entry of the index of variables.
+ *
+ * @param tableau
+ *    tableau of index
+ * @param variable
+ *    variable of entry
+ * @param position
+ *    entry of index
+ * @return 1 if the variable is at the given position, 0 else
+ */
+static int is_position(const struct Tableau *tableau, int variable, int position);
+
+/**
+ * @brief Build the index of variables.
+ *
+ * @param tableau
+ *    tableau to index
+ * @return 0 on success, -1 if no memory is left
+ */
+static int index_variables(struct Tableau *tableau);
+
+/**
+ * @brief Reduce the contents of the lines.
+ *
+ * This function divides each line of A and b by its content, which is
+ * multiplied into the scale of the line. Lines whose content or scale does
+ * not fit into a rational number are left unchanged, as is the whole tableau
+ * if no memory is left.
+ *
+ * @param tableau
+ *    tableau to reduce
+ */
+static void reduce_lines(struct Tableau *tableau);
+
+/**
+ * @brief Apply the multipliers of the lines.
+ *
+ * This function multiplies each line with its scale and frees the scales, so
+ * the cells hold the values of the tableau again.
+ *
+ * @param tableau
+ *    tableau to restore
+ */
+static void unscale_lines(struct Tableau *tableau);
+
+/**
+ * @brief Check the magnitude of a line.
+ *
+ * @param tableau
+ *    tableau of line
+ * @param line
+ *    line to check
+ * @param threshold
+ *    largest allowed magnitude
+ * @return 1 if a numerator or denominator of the line exceeds threshold, 0 else
+ */
+static int line_exceeds(struct Tableau *tableau, int line, int threshold);
+
+/**
+ * @brief Largest common divisor.
+ *
+ * @param a
+ *    integer a
+ * @param b
+ *    integer b
+ * @return largest common divisor of |a| and |b|, 0 if both are 0
  */
-static void simplex_step(struct Tableau *tableau);
+static long long common_divisor(long long a, long long b);
 
 struct Tableau* simplex_create_tableau(int equations, int variables)
 {
-    int i, j;
+    int i, j, ok;
     struct Tableau *tableau = NULL;
 
-    tableau = (struct Tableau*)malloc(sizeof(struct Tableau));
+    tableau = (struct Tableau*)calloc(1, sizeof(struct Tableau));
+    if(tableau == NULL)
+    {
+        return NULL;
+    }
+    STATS_ALLOC(sizeof(struct Tableau) + equations * sizeof(struct Rational **)
+                + (equations + 1) * (variables - equations) * sizeof(struct Rational *)
+                + equations * sizeof(struct Rational *) + variables * sizeof(int));
 
     tableau->rows = equations;
     tableau->cols = (variables - equations);
+    tableau->pivotLine = -1;
+    tableau->pivotColumn = -1;
+    tableau->artificials = variables;
+    tableau->pricing = SIMPLEX_PRICING_BLAND;
+    tableau->snapshot = NULL;
+    tableau->snapshotSize = 0;
+    tableau->snapshotMapped = 0;
+    tableau->shared = NULL;
+    tableau->positions = NULL;
+    tableau->positionsSize = 0;
+    tableau->scale = NULL;
+
+    /* All arrays are 0-filled, so simplex_free_tableau can release a partially created tableau. */
+    tableau->A = (struct Rational ***)calloc(equations + 1, sizeof(struct Rational **));
+    tableau->b = (struct Rational **)calloc(equations + 1, sizeof(struct Rational *));
+    tableau->c = (struct Rational **)calloc((variables - equations) + 1, sizeof(struct Rational *));
+    tableau->bvs = (int *)calloc(equations + 1, sizeof(int));
+    tableau->nbvs = (int *)calloc((variables - equations) + 1, sizeof(int));
+    tableau->z = rational_create();
+    ok = tableau->A != NULL && tableau->b != NULL && tableau->c != NULL && tableau->bvs != NULL
+         && tableau->nbvs != NULL && tableau->z != NULL;
 
-    tableau->A = (struct Rational ***)malloc(equations * sizeof(struct Rational **));
-    for(i=0; i<equations; ++i)
+    for(i=0; ok && i<equations; ++i)
     {
-        tableau->A[i] = (struct Rational **)malloc((variables - equations) * sizeof(struct Rational *));
-        for(j=0; j<(variables - equations); ++j)
+        tableau->A[i] = (struct Rational **)calloc((variables - equations) + 1, sizeof(struct Rational *));
+        ok = tableau->A[i] != NULL;
+        for(j=0; ok && j<(variables - equations); ++j)
         {
             tableau->A[i][j] = rational_create();
+            ok = tableau->A[i][j] != NULL;
+        }
+        if(ok)
+        {
+            tableau->b[i] = rational_create();
+            ok = tableau->b[i] != NULL;
         }
     }
 
-    tableau->b = (struct Rational **)malloc(equations * sizeof(struct Rational *));
-    for(i=0; i<equations; ++i)
+    for(i=0; ok && i<(variables - equations); ++i)
     {
-        tableau->b[i] = rational_create();
+        tableau->c[i] = rational_create();
+        ok = tableau->c[i] != NULL;
     }
 
-    tableau->c = (struct Rational **)malloc((variables - equations) * sizeof(struct Rational *));
-    for(i=0; i<(variables - equations); ++i)
+    if(!ok)
     {
-        tableau->c[i] = rational_create();
+        simplex_free_tableau(tableau);
+        return NULL;
     }
 
-    tableau->z = rational_create();
+    return tableau;
+}
+
+struct Tableau *simplex_copy_tableau(struct Tableau *tableau)
+{
+    struct Tableau *copy;
+    int i, j;
 
-    tableau->bvs = (int *)malloc(equations * sizeof(int));
-    for(i=0; i<equations; ++i)
+    copy = simplex_create_tableau(tableau->rows, tableau->cols + tableau->rows);
+    if(copy == NULL)
     {
-        tableau->bvs[i] = 0;
+        return NULL;
     }
 
-    tableau->nbvs = (int *)malloc((variables-equations) * sizeof(int));
-    for(i=0; i<(variables-equations); ++i)
+    for(i=0; i<tableau->rows; ++i)
+    {
+        for(j=0; j<tableau->cols; ++j)
+        {
+            *(copy->A[i][j]) = *(tableau->A[i][j]);
+        }
+        *(copy->b[i]) = *(tableau->b[i]);
+        copy->bvs[i] = tableau->bvs[i];
+    }
+    for(j=0; j<tableau->cols; ++j)
     {
-        tableau->nbvs[i] = 0;
+        *(copy->c[j]) = *(tableau->c[j]);
+        copy->nbvs[j] = tableau->nbvs[j];
     }
+    *(copy->z) = *(tableau->z);
+    copy->pivotLine = tableau->pivotLine;
+    copy->pivotColumn = tableau->pivotColumn;
+    copy->artificials = tableau->artificials;
+    copy->pricing = tableau->pricing;
 
-    tableau->pivotLine = -1;
-    tableau->pivotColumn = -1;
+    return copy;
+}
 
-    return tableau;
+struct Tableau *simplex_clone_tableau(struct Tableau *tableau)
+{
+    struct Tableau *clone;
+    int i, j, ok;
+
+    if(tableau->snapshot != NULL) /* Lines point into the snapshot, which is released with the tableau. */
+    {
+        return simplex_copy_tableau(tableau);
+    }
+
+    if(tableau->shared == NULL)
+    {
+        tableau->shared = (atomic_int **)calloc(tableau->rows + 1, sizeof(atomic_int *));
+        if(tableau->shared == NULL)
+        {
+            return NULL;
+        }
+    }
+    for(i=0; i<tableau->rows; ++i) /* A counter of 1 belongs to a line which is used by this tableau only. */
+    {
+        if(tableau->shared[i] == NULL)
+        {
+            tableau->shared[i] = (atomic_int *)malloc(sizeof(atomic_int));
+            if(tableau->shared[i] == NULL)
+            {
+                return NULL;
+            }
+            atomic_init(tableau->shared[i], 1);
+        }
+    }
+
+    clone = (struct Tableau *)malloc(sizeof(struct Tableau));
+    if(clone == NULL)
+    {
+        return NULL;
+    }
+    *clone = *tableau;
+    clone->positions = NULL;
+    clone->positionsSize = 0;
+    clone->scale = NULL;
+    clone->A = (struct Rational ***)calloc(tableau->rows + 1, sizeof(struct Rational **));
+    clone->shared = (atomic_int **)calloc(tableau->rows + 1, sizeof(atomic_int *));
+    clone->b = (struct Rational **)calloc(tableau->rows + 1, sizeof(struct Rational *));
+    clone->c = (struct Rational **)calloc(tableau->cols + 1, sizeof(struct Rational *));
+    clone->bvs = (int *)malloc((tableau->rows + 1) * sizeof(int));
+    clone->nbvs = (int *)malloc((tableau->cols + 1) * sizeof(int));
+    clone->z = rational_clone(tableau->z);
+    ok = clone->A != NULL && clone->shared != NULL && clone->b != NULL && clone->c != NULL && clone->bvs != NULL
+         && clone->nbvs != NULL && clone->z != NULL;
+    STATS_ALLOC(sizeof(struct Tableau) + (tableau->rows + 1) * (sizeof(struct Rational **) + sizeof(atomic_int *)
+                + sizeof(struct Rational) + sizeof(struct Rational *) + sizeof(int))
+                + tableau->cols * (sizeof(struct Rational) + sizeof(struct Rational *) + sizeof(int)));
+
+    for(i=0; ok && i<tableau->rows; ++i)
+    {
+        clone->b[i] = rational_clone(tableau->b[i]);
+        clone->bvs[i] = tableau->bvs[i];
+        ok = clone->b[i] != NULL;
+    }
+    for(j=0; ok && j<tableau->cols; ++j)
+    {
+        clone->c[j] = rational_clone(tableau->c[j]);
+        clone->nbvs[j] = tableau->nbvs[j];
+        ok = clone->c[j] != NULL;
+    }
+    if(!ok) /* No line is shared yet. */
+    {
+        simplex_free_tableau(clone);
+        return NULL;
+    }
+
+    for(i=0; i<tableau->rows; ++i)
+    {
+        atomic_fetch_add(tableau->shared[i], 1);
+        clone->shared[i] = tableau->shared[i];
+        clone->A[i] = tableau->A[i];
+    }
+
+    return clone;
+}
+
+int simplex_own_line(struct Tableau *tableau, int line)
+{
+    struct Rational **copy;
+    int j, failed;
+
+    if(tableau->shared == NULL || tableau->shared[line] == NULL)
+    {
+        return 0;
+    }
+
+    if(atomic_load(tableau->shared[line]) > 1) /* Still shared, work on a copy. */
+    {
+        copy = (struct Rational **)calloc(tableau->cols + 1, sizeof(struct Rational *));
+        if(copy == NULL)
+        {
+            return -1;
+        }
+        STATS_ALLOC(tableau->cols * sizeof(struct Rational *));
+        for(j=0; j<tableau->cols; ++j)
+        {
+            copy[j] = rational_clone(tableau->A[line][j]);
+            if(copy[j] == NULL)
+            {
+                break;
+            }
+        }
+        failed = (j < tableau->cols);
+        if(!failed && atomic_fetch_sub(tableau->shared[line], 1) > 1)
+        {
+            tableau->A[line] = copy;
+            tableau->shared[line] = NULL;
+            return 0;
+        }
+        for(j=0; j<tableau->cols; ++j) /* Out of memory, or the others released the line in the meantime. */
+        {
+            free(copy[j]);
+        }
+        free(copy);
+        if(failed)
+        {
+            return -1;
+        }
+    }
+
+    free(tableau->shared[line]);
+    tableau->shared[line] = NULL;
+
+    return 0;
+}
+
+int simplex_own_lines(struct Tableau *tableau)
+{
+    int i;
+
+    for(i=0; tableau->shared != NULL && i<tableau->rows; ++i)
+    {
+        if(simplex_own_line(tableau, i) != 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
 }
 
 void simplex_free_tableau(struct Tableau *tableau)
 {
     int i, j;
 
-    for(i=0; i<tableau->rows; ++i)
+    if(tableau == NULL)
     {
-        for(j=0; j<tableau->cols; ++j)
+        return;
+    }
+
+    for(i=0; tableau->A != NULL && i<tableau->rows; ++i)
+    {
+        if(tableau->shared != NULL && tableau->shared[i] != NULL)
         {
-            free(tableau->A[i][j]);
+            if(atomic_fetch_sub(tableau->shared[i], 1) > 1)
+            {
+                continue; /* Line is still used by a clone. */
+            }
+            free(tableau->shared[i]);
+        }
+        for(j=0; tableau->A[i] != NULL && j<tableau->cols; ++j)
+        {
+            simplex_free_cell(tableau, tableau->A[i][j]);
         }
         free(tableau->A[i]);
     }
     free(tableau->A);
+    free(tableau->shared);
 
-    for(i=0; i<tableau->rows; ++i)
+    for(i=0; tableau->b != NULL && i<tableau->rows; ++i)
     {
-        free(tableau->b[i]);
+        simplex_free_cell(tableau, tableau->b[i]);
     }
     free(tableau->b);
 
-    for(i=0; i<tableau->cols; ++i)
+    for(i=0; tableau->c != NULL && i<tableau->cols; ++i)
     {
-        free(tableau->c[i]);
+        simplex_free_cell(tableau, tableau->c[i]);
     }
     free(tableau->c);
 
-    free(tableau->z);
+    simplex_free_cell(tableau, tableau->z);
 
     free(tableau->bvs);
 
     free(tableau->nbvs);
 
+    free(tableau->positions);
+
+    free(tableau->scale);
+
+    if(tableau->snapshotMapped)
+    {
+        munmap(tableau->snapshot, tableau->snapshotSize);
+    }
+    else
+    {
+        free(tableau->snapshot);
+    }
+
     free(tableau);
 }
 
+void simplex_free_cell(struct Tableau *tableau, struct Rational *cell)
+{
+    if(tableau->snapshot == NULL || (char *)cell < (char *)tableau->snapshot
+       || (char *)cell >= (char *)tableau->snapshot + tableau->snapshotSize)
+    {
+        free(cell);
+    }
+}
+
 void simplex_print_tableau(struct Tableau *tableau)
 {
-    int i,j;
-    struct Rational *tmp;
-    char **string = NULL;
+    struct SimplexLog log;
 
-    printf("Tableau:\n");
-    for(i=0; i<tableau->cols; ++i)
+    simplex_log_init(&log, SIMPLEX_LOG_TABLEAU, simplex_log_file_sink, stdout);
+    simplex_log_tableau(&log, SIMPLEX_LOG_TABLEAU, tableau);
+    simplex_log_free(&log);
+}
+
+struct Rational **simplex_get_solution(struct Tableau *tableau)
+{
+    struct Rational **solution;
+
+    solution = (struct Rational **)malloc(sizeof(struct Rational *));
+    if(solution == NULL)
     {
-        string = rational_to_string(tableau->c[i]);
-        printf("%8s ", *string);
-        free(*string);
-        free(string);
+        return NULL;
     }
-    string = rational_to_string(tableau->z);
-    printf(" |  %8s\n", *string);
-    free(*string);
-    free(string);
-    for(i=0; i<tableau->cols; ++i)
+    *solution = (struct Rational *)malloc((tableau->cols + tableau->rows + 1) * sizeof(struct Rational));
+    if(*solution == NULL)
+    {
+        free(solution);
+        return NULL;
+    }
+    simplex_solution_values(tableau, *solution);
+
+    return solution;
+}
+
+int simplex_solution_value(struct Tableau *tableau, int variable, struct Rational *value)
+{
+    int position;
+
+    if(variable < 0 || variable >= tableau->cols + tableau->rows)
+    {
+        return -1;
+    }
+
+    position = find_position(tableau, variable);
+    if(position >= 0 && position < tableau->rows)
+    {
+        *value = *(tableau->b[position]);
+    }
+    else
+    {
+        value->n = 0;
+        value->d = 1;
+    }
+
+    return 0;
+}
+
+int simplex_dual_value(struct Tableau *tableau, int variable, struct Rational *value)
+{
+    int position;
+
+    if(variable < 0 || variable >= tableau->cols + tableau->rows)
+    {
+        return -1;
+    }
+
+    position = find_position(tableau, variable);
+    if(position < 0)
+    {
+        *value = *(tableau->c[-position - 1]);
+        value->n = -(value->n);
+    }
+    else
+    {
+        value->n = 0;
+        value->d = 1;
+    }
+
+    return 0;
+}
+
+void simplex_solution_values(const struct Tableau *tableau, struct Rational *values)
+{
+    int i, variables = tableau->cols + tableau->rows;
+
+    for(i=0; i<variables; ++i)
     {
-        printf("---------");
+        values[i].n = 0;
+        values[i].d = 1;
     }
-    printf("-------------\n");
     for(i=0; i<tableau->rows; ++i)
     {
-        for(j=0; j<tableau->cols; ++j)
+        if(tableau->bvs[i] >= 0 && tableau->bvs[i] < variables)
+        {
+            values[tableau->bvs[i]] = *(tableau->b[i]);
+        }
+    }
+}
+
+void simplex_dual_values(const struct Tableau *tableau, struct Rational *values)
+{
+    int j, variables = tableau->cols + tableau->rows;
+
+    for(j=0; j<variables; ++j)
+    {
+        values[j].n = 0;
+        values[j].d = 1;
+    }
+    for(j=0; j<tableau->cols; ++j)
+    {
+        if(tableau->nbvs[j] >= 0 && tableau->nbvs[j] < variables)
+        {
+            values[tableau->nbvs[j]] = *(tableau->c[j]);
+            values[tableau->nbvs[j]].n = -(values[tableau->nbvs[j]].n);
+        }
+    }
+}
+
+static int find_position(struct Tableau *tableau, int variable)
+{
+    int i;
+
+    if(tableau->positions != NULL && variable < tableau->positionsSize
+       && is_position(tableau, variable, tableau->positions[variable]))
+    {
+        return tableau->positions[variable];
+    }
+
+    if(index_variables(tableau) == 0)
+    {
+        return tableau->positions[variable];
+    }
+
+    for(i=0; i<tableau->rows; ++i) /* No memory for the index. */
+    {
+        if(tableau->bvs[i] == variable)
+        {
+            return i;
+        }
+    }
+    for(i=0; i<tableau->cols; ++i)
+    {
+        if(tableau->nbvs[i] == variable)
+        {
+            return -(i + 1);
+        }
+    }
+
+    return tableau->rows;
+}
+
+static int is_position(const struct Tableau *tableau, int variable, int position)
+{
+    if(position >= 0)
+    {
+        return position < tableau->rows && tableau->bvs[position] == variable;
+    }
+
+    return -position - 1 < tableau->cols && tableau->nbvs[-position - 1] == variable;
+}
+
+static int index_variables(struct Tableau *tableau)
+{
+    int i, *positions, variables = tableau->cols + tableau->rows;
+
+    if(tableau->positionsSize < variables)
+    {
+        positions = (int *)realloc(tableau->positions, (variables + 1) * sizeof(int));
+        if(positions == NULL)
+        {
+            return -1;
+        }
+        STATS_ALLOC((variables + 1) * sizeof(int));
+        tableau->positions = positions;
+        tableau->positionsSize = variables;
+    }
+
+    for(i=0; i<tableau->positionsSize; ++i)
+    {
+        tableau->positions[i] = tableau->rows;
+    }
+    for(i=0; i<tableau->rows; ++i)
+    {
+        if(tableau->bvs[i] >= 0 && tableau->bvs[i] < tableau->positionsSize)
+        {
+            tableau->positions[tableau->bvs[i]] = i;
+        }
+    }
+    for(i=0; i<tableau->cols; ++i)
+    {
+        if(tableau->nbvs[i] >= 0 && tableau->nbvs[i] < tableau->positionsSize)
+        {
+            tableau->positions[tableau->nbvs[i]] = -(i + 1);
+        }
+    }
+
+    return 0;
+}
+
+void simplex_print_solution(struct Tableau *tableau)
+{
+    int i;
+    struct Rational value;
+    char string[BUFFER];
+
+    printf("[ ");
+    for(i=0; i<(tableau->cols + tableau->rows); ++i)
+    {
+        simplex_solution_value(tableau, i, &value);
+        rational_format(string, BUFFER, value);
+        fputs(string, stdout);
+
+        if(i < (tableau->cols + tableau->rows)-1)
+        {
+            printf(", ");
+        }
+    }
+    printf(" ]\n");
+}
+
+/*static void resize_tableau(struct Tableau *tableau, int equations, int variables)
+{
+    int i, j;
+
+    if(tableau->rows > equations)
+    {
+        for(i=equations; i<tableau->rows; ++i)
+        {
+            for(j=0; j<tableau->cols; ++j)
+            {
+                free(tableau->A[i][j]);
+            }
+            free(tableau->A[i]);
+        }
+    }
+
+    if(tableau->rows != equations)
+    {
+        tableau->A = (struct Rational ***)realloc(tableau->A, equations * sizeof(struct Rational **));
+    }
+
+    if(tableau->cols != variables)
+    {
+        for(i=0; i<equations; ++i)
+        {
+            if(i >= tableau->rows)
+            {
+                tableau->A[i] = (struct Rational **)malloc(variables * sizeof(struct Rational *));
+                for(j=0; j<variables; ++j)
+                {
+                    tableau->A[i][j] = rational_create();
+                }
+            }
+            else
+            {
+                for(j=variables; j<tableau->cols; ++j)
+                {
+                    free(tableau->A[i][j]);
+                }
+                tableau->A[i] = (struct Rational **)realloc(tableau->A[i], variables * sizeof(struct Rational *));
+                for(j=tableau->cols; j<variables; ++j)
+                {
+                    tableau->A[i][j] = rational_create();
+                }
+            }
+        }
+    }
+
+    for(j=variables; j<tableau->cols; ++j)
+    {
+        free(tableau->c[j]);
+    }
+    tableau->c = (struct Rational **)realloc(tableau->c, variables * sizeof(struct Rational *));
+    for(j=tableau->cols; j<variables; ++j)
+    {
+        tableau->c[j] = rational_create();
+    }
+
+    for(j=equations; j<tableau->rows; ++j)
+    {
+        free(tableau->b[j]);
+    }
+    tableau->b = (struct Rational **)realloc(tableau->b, equations * sizeof(struct Rational *));
+    for(j=tableau->rows; j<equations; ++j)
+    {
+        tableau->b[j] = rational_create();
+    }
+
+    tableau->bvs = (int *)realloc(tableau->bvs, variables * sizeof(int));
+
+    tableau->nbvs = (int *)realloc(tableau->nbvs, (variables-equations) * sizeof(int));
+
+    tableau->cols = variables;
+    tableau->rows = equations;
+}*/
+
+static void update_pivot(struct Tableau *tableau)
+{
+    int i;
+    struct Rational ratio, min = {0, 1};
+    double timer = 0.0;
+
+    if(tableau->pricing == SIMPLEX_PRICING_DANTZIG && update_pivot_dantzig(tableau))
+    {
+        return;
+    }
+
+    tableau->pivotColumn = -1;
+    tableau->pivotLine = -1;
+
+    do
+    {
+        STATS_TIMER(timer);
+        i=tableau->pivotColumn+1;
+        tableau->pivotColumn = -1;
+        for(; i<tableau->cols; ++i)
+        {
+            if((tableau->c[i])->n > 0 && tableau->nbvs[i] < tableau->artificials)
+            {
+                tableau->pivotColumn = i;
+                break;
+            }
+        }
+        STATS_TIME(timer, pricingSeconds);
+
+        if(tableau->pivotColumn >= 0)
+        {
+            STATS_TIMER(timer);
+            tableau->pivotLine = -1;
+
+            for(i=0; i<tableau->rows; ++i)
+            {
+                if((tableau->A[i][tableau->pivotColumn])->n > 0)
+                {
+                    ratio = rational_quotient(*(tableau->b[i]), *(tableau->A[i][tableau->pivotColumn]));
+                    if(tableau->pivotLine == -1 || rational_compare(ratio, min) < 0)
+                    {
+                        tableau->pivotLine = i;
+                        min = ratio;
+                    }
+                }
+            }
+            STATS_TIME(timer, ratioTestSeconds);
+        }
+    }
+    while(tableau->pivotColumn != -1 && tableau->pivotLine == -1);
+}
+
+static int update_pivot_dantzig(struct Tableau *tableau)
+{
+    struct Rational ratio, min = {0, 1};
+    int i;
+    double timer = 0.0;
+
+    STATS_TIMER(timer);
+    tableau->pivotColumn = -1;
+    tableau->pivotLine = -1;
+    for(i=0; i<tableau->cols; ++i)
+    {
+        if((tableau->c[i])->n > 0 && tableau->nbvs[i] < tableau->artificials
+           && (tableau->pivotColumn < 0 || rational_compare(*(tableau->c[i]), *(tableau->c[tableau->pivotColumn])) > 0))
+        {
+            tableau->pivotColumn = i;
+        }
+    }
+    STATS_TIME(timer, pricingSeconds);
+
+    if(tableau->pivotColumn < 0)
+    {
+        return 1;
+    }
+
+    STATS_TIMER(timer);
+    for(i=0; i<tableau->rows; ++i)
+    {
+        if((tableau->A[i][tableau->pivotColumn])->n > 0)
+        {
+            ratio = rational_quotient(*(tableau->b[i]), *(tableau->A[i][tableau->pivotColumn]));
+            if(tableau->pivotLine == -1 || rational_compare(ratio, min) < 0)
+            {
+                tableau->pivotLine = i;
+                min = ratio;
+            }
+        }
+    }
+    STATS_TIME(timer, ratioTestSeconds);
+
+    return tableau->pivotLine < 0 || min.n != 0; /* No line: unbounded. */
+}
+
+static int simplex_step(struct Tableau *tableau)
+{
+    int i, j, temp, line = tableau->pivotLine, column = tableau->pivotColumn;
+    struct Rational pivotValue, inverse, fact, one = {1, 1};
+    double timer = 0.0;
+
+    STATS_TIMER(timer);
+
+    /* Copy all shared lines which change first, so the tableau is unchanged if no memory is left. */
+    if(simplex_own_line(tableau, line) != 0)
+    {
+        return -1;
+    }
+    for(j=0; j<tableau->rows; ++j)
+    {
+        if(j != line && (tableau->A[j][column])->n != 0 && simplex_own_line(tableau, j) != 0)
+        {
+            return -1;
+        }
+    }
+
+    STATS_COUNT(pivots[stats_current->phase]);
+    if((tableau->b[line])->n == 0)
+    {
+        STATS_COUNT(degeneratePivots);
+    }
+
+    pivotValue = *(tableau->A[line][column]);
+    inverse = rational_quotient(one, pivotValue);
+    if(tableau->scale != NULL) /* The pivot line loses its scale, the pivot column needs the real pivot element. */
+    {
+        inverse = rational_quotient(inverse, tableau->scale[line]);
+        tableau->scale[line] = one;
+    }
+    if(!(pivotValue.n == 1 && pivotValue.d == 1))
+    {
+        for(i=0; i<tableau->cols; ++i)
+        {
+            if(i != column)
+            {
+                *(tableau->A[line][i]) = rational_quotient(*(tableau->A[line][i]), pivotValue);
+            }
+        }
+        *(tableau->b[line]) = rational_quotient(*(tableau->b[line]), pivotValue);
+    }
+    *(tableau->A[line][column]) = inverse; /* The leaving basis variable takes the pivot column. */
+
+    fact = *(tableau->c[column]);
+    for(i=0; i<tableau->cols; ++i)
+    {
+        if(i != column)
+        {
+            *(tableau->c[i]) = rational_difference(*(tableau->c[i]), rational_product(*(tableau->A[line][i]), fact));
+        }
+    }
+    *(tableau->z) = rational_difference(*(tableau->z), rational_product(*(tableau->b[line]), fact));
+    *(tableau->c[column]) = rational_product(fact, inverse);
+    (tableau->c[column])->n = -((tableau->c[column])->n);
+
+    for(j=0; j<tableau->rows; ++j)
+    {
+        if(j == line || (tableau->A[j][column])->n == 0)
+        {
+            continue; /* Lines with factor 0 do not change and stay shared with clones. */
+        }
+
+        fact = *(tableau->A[j][column]);
+        for(i=0; i<tableau->cols; ++i)
+        {
+            if(i != column)
+            {
+                *(tableau->A[j][i]) = rational_difference(*(tableau->A[j][i]), rational_product(*(tableau->A[line][i]), fact));
+            }
+        }
+        *(tableau->b[j]) = rational_difference(*(tableau->b[j]), rational_product(*(tableau->b[line]), fact));
+        *(tableau->A[j][column]) = rational_product(fact, inverse);
+        (tableau->A[j][column])->n = -((tableau->A[j][column])->n);
+    }
+
+    temp = tableau->bvs[line];
+    tableau->bvs[line] = tableau->nbvs[column];
+    tableau->nbvs[column] = temp;
+    if(tableau->positions != NULL) /* Keep the index of variables up to date. */
+    {
+        if(tableau->bvs[line] >= 0 && tableau->bvs[line] < tableau->positionsSize)
+        {
+            tableau->positions[tableau->bvs[line]] = line;
+        }
+        if(temp >= 0 && temp < tableau->positionsSize)
+        {
+            tableau->positions[temp] = -(column + 1);
+        }
+    }
+
+    STATS_TIME(timer, updateSeconds);
+
+    return 0;
+}
+
+static struct Tableau *create_phase1_tableau(struct Tableau *tab)
+{
+    int i, j;
+    struct Tableau *phase1;
+
+    phase1 = simplex_create_tableau(tab->rows, (tab->cols + 2*tab->rows));
+    if(phase1 == NULL)
+    {
+        return NULL;
+    }
+
+    for(i=0; i<tab->rows; ++i)
+    {
+        for(j=0; j<tab->cols; ++j)
+        {
+            *(phase1->A[i][j]) = *(tab->A[i][j]);
+        }
+    }
+
+    for(i=0; i<phase1->rows; ++i)
+    {
+        (phase1->A[phase1->rows-1-i][phase1->cols-1-i])->n = 1;
+    }
+
+    for(j=0; j<tab->rows; ++j)
+    {
+        *(phase1->b[j]) = *(tab->b[j]);
+    }
+
+    for(j=0; j<phase1->rows; ++j) /* Artificial variables must start with a valid value. */
+    {
+        if((phase1->b[j])->n < 0)
+        {
+            (phase1->b[j])->n = -((phase1->b[j])->n);
+            for(i=0; i<phase1->cols; ++i)
+            {
+                (phase1->A[j][i])->n = -((phase1->A[j][i])->n);
+            }
+        }
+    }
+
+    for(i=0; i<phase1->cols; ++i)
+    {
+        for(j=0; j<phase1->rows; ++j)
+        {
+            *(phase1->c[i]) = rational_sum(*(phase1->c[i]), *(phase1->A[j][i]));
+        }
+    }
+
+    for(j=0; j<phase1->rows; ++j)
+    {
+        *(phase1->z) = rational_sum(*(phase1->z), *(phase1->b[j]));
+    }
+
+    for(i=0; i<phase1->cols; ++i)
+    {
+        phase1->nbvs[i] = i;
+    }
+
+    for(i=0; i<phase1->rows; ++i)
+    {
+        phase1->bvs[i] = i + phase1->cols;
+    }
+
+    update_pivot(phase1);
+
+    return phase1;
+}
+
+struct Tableau *simplex_find_start_corner(struct Tableau *tab)
+{
+    struct Tableau *phase1;
+
+    phase1 = create_phase1_tableau(tab);
+    if(phase1 == NULL)
+    {
+        return NULL;
+    }
+
+    simplex_log_tableau(simplex_log_current(), SIMPLEX_LOG_TABLEAU, phase1);
+
+    while(phase1->pivotColumn >= 0 && phase1->pivotLine >= 0)
+    {
+        if(simplex_step(phase1) != 0)
+        {
+            simplex_free_tableau(phase1);
+            return NULL;
+        }
+        update_pivot(phase1);
+    }
+
+    return phase1;
+}
+
+int prepare_with_start_corner(struct Tableau *phase1, struct Tableau *tableau)
+{
+    int i, j, status, variables = tableau->cols + tableau->rows;
+    int *target;
+
+    for(i=0; i<phase1->rows; ++i) /* Artificial variables left in the basis have value 0 and can be exchanged. */
+    {
+        if(phase1->bvs[i] < variables)
+        {
+            continue;
+        }
+        for(j=0; j<phase1->cols; ++j)
+        {
+            if(phase1->nbvs[j] < variables && (phase1->A[i][j])->n != 0)
+            {
+                if(simplex_pivot(phase1, i, j) != 0)
+                {
+                    return -1;
+                }
+                break;
+            }
+        }
+    }
+
+    target = (int *)calloc(variables + 1, sizeof(int));
+    if(target == NULL)
+    {
+        return -1;
+    }
+    for(i=0; i<phase1->rows; ++i)
+    {
+        if(phase1->bvs[i] < variables)
+        {
+            target[phase1->bvs[i]] = 1;
+        }
+    }
+
+    status = simplex_pivot_to_basis(tableau, target);
+
+    free(target);
+
+    return status;
+}
+
+int simplex_pivot(struct Tableau *tableau, int line, int column)
+{
+    tableau->pivotLine = line;
+    tableau->pivotColumn = column;
+
+    return simplex_step(tableau);
+}
+
+int simplex_find_best_solution(struct Tableau *tableau)
+{
+
+    update_pivot(tableau);
+
+    while(tableau->pivotColumn >= 0 && tableau->pivotLine >= 0)
+    {
+        if(simplex_step(tableau) != 0)
+        {
+            return -1;
+        }
+        update_pivot(tableau);
+    }
+
+    return 0;
+}
+
+struct SimplexContext *simplex_context_create(struct Tableau *tableau)
+{
+    struct SimplexContext *context = NULL;
+
+    context = (struct SimplexContext *)malloc(sizeof(struct SimplexContext));
+    if(context == NULL)
+    {
+        return NULL;
+    }
+
+    context->tableau = tableau;
+    context->dual = NULL;
+    context->form = SIMPLEX_FORM_AUTO;
+    context->crash = 1;
+    context->cost = NULL;
+    context->phase = 1;
+    context->status = SIMPLEX_LIMIT_REACHED;
+    context->iterations = 0;
+    context->maxIterations = 0;
+    context->seconds = 0.0;
+    context->maxSeconds = 0.0;
+    context->reduceInterval = 0;
+    context->reduceThreshold = SIMPLEX_REDUCE_THRESHOLD;
+    atomic_init(&(context->cancelled), 0);
+    stats_reset(&(context->stats));
+    simplex_log_init(&(context->log), SIMPLEX_LOG_OFF, NULL, NULL);
+
+    return context;
+}
+
+void simplex_context_free(struct SimplexContext *context)
+{
+    if(context->dual != NULL)
+    {
+        simplex_free_tableau(context->dual);
+    }
+    free(context->cost);
+    simplex_log_free(&(context->log));
+    free(context);
+}
+
+void simplex_cancel(struct SimplexContext *context)
+{
+    atomic_store(&(context->cancelled), 1);
+}
+
+enum SimplexStatus simplex_iterate(struct SimplexContext *context, long maxPivots)
+{
+    struct Tableau *current;
+    struct SimplexStats *previous;
+    struct SimplexLog *log = &(context->log), *previousLog;
+    long pivots = 0, crash, unreduced = 0;
+    int recovered;
+    double start;
+
+    if(context->phase == 0)
+    {
+        return context->status;
+    }
+
+    start = stats_now();
+    context->status = SIMPLEX_LIMIT_REACHED;
+    previous = stats_bind(&(context->stats));
+    rational_clear_overflow();
+
+    while(context->phase != 0)
+    {
+        if(rational_overflow())
+        {
+            break;
+        }
+        if(atomic_load(&(context->cancelled)))
+        {
+            context->status = SIMPLEX_CANCELLED;
+            break;
+        }
+
+        if(context->phase == 1 && context->cost == NULL)
+        {
+            if(context->form == SIMPLEX_FORM_AUTO)
+            {
+                context->form = choose_form(context->tableau);
+            }
+            if(context->form == SIMPLEX_FORM_DUAL && context->dual == NULL)
+            {
+                context->dual = simplex_dual_tableau(context->tableau);
+                context->form = (context->dual == NULL) ? SIMPLEX_FORM_PRIMAL : SIMPLEX_FORM_DUAL;
+            }
+            current = (context->dual != NULL) ? context->dual : context->tableau;
+
+            context->stats.phase = 1;
+            previousLog = simplex_log_bind(log);
+            if(context->crash)
+            {
+                crash = simplex_crash(current);
+            }
+            else
+            {
+                crash = add_artificials(current);
+            }
+            simplex_log_bind(previousLog);
+            if(crash < 0 || start_phase1_in_place(current, &(context->cost)) != 0)
+            {
+                context->status = SIMPLEX_ERROR;
+                context->phase = 0;
+                break;
+            }
+            pivots += crash;
+            context->iterations += crash;
+            simplex_log_printf(log, SIMPLEX_LOG_SUMMARY, "Phase 1: %d equations, %d variables%s, %ld crash pivots\n",
+                               current->rows, current->cols + current->rows,
+                               (context->dual != NULL) ? " (dual problem)" : "", crash);
+            if(context->cost == NULL) /* Crash basis is valid, skip phase 1. */
+            {
+                context->phase = 2;
+                update_pivot(current);
+                simplex_log_printf(log, SIMPLEX_LOG_SUMMARY, "Phase 2: start corner after %ld pivots\n",
+                                   context->iterations);
+            }
+            simplex_log_tableau(log, SIMPLEX_LOG_TABLEAU, current);
+        }
+        current = (context->dual != NULL) ? context->dual : context->tableau;
+
+        if(current->pivotColumn < 0 || current->pivotLine < 0)
+        {
+            unscale_lines(current);
+            if(context->phase == 1)
+            {
+                if((current->z)->n != 0 && context->dual != NULL)
+                {
+                    simplex_log_printf(log, SIMPLEX_LOG_SUMMARY, "Phase 1: dual problem is infeasible, solve primal problem\n");
+                    simplex_free_tableau(context->dual);
+                    context->dual = NULL;
+                    context->form = SIMPLEX_FORM_PRIMAL;
+                    free(context->cost);
+                    context->cost = NULL;
+                }
+                else if((current->z)->n != 0)
+                {
+                    simplex_log_printf(log, SIMPLEX_LOG_SUMMARY, "Phase 1: no start corner, problem is infeasible\n");
+                    context->status = SIMPLEX_INFEASIBLE;
+                    context->phase = 0;
+                }
+                else
+                {
+                    context->stats.phase = 0;
+                    if(finish_phase1_in_place(current, context->cost) != 0)
+                    {
+                        context->status = SIMPLEX_ERROR;
+                        context->phase = 0;
+                        break;
+                    }
+                    free(context->cost);
+                    context->cost = NULL;
+                    context->phase = 2;
+                    update_pivot(current);
+                    simplex_log_printf(log, SIMPLEX_LOG_SUMMARY, "Phase 2: start corner after %ld pivots\n",
+                                       context->iterations);
+                    simplex_log_tableau(log, SIMPLEX_LOG_TABLEAU, current);
+                }
+            }
+            else
+            {
+                context->status = has_improving_column(current) ? SIMPLEX_UNBOUNDED : SIMPLEX_OPTIMAL;
+                context->phase = 0;
+                if(context->dual != NULL)
+                {
+                    context->stats.phase = 0;
+                    recovered = 1;
+                    if(context->status == SIMPLEX_UNBOUNDED)
+                    {
+                        context->status = SIMPLEX_INFEASIBLE; /* Unbounded dual problem. */
+                    }
+                    else
+                    {
+                        recovered = simplex_dual_recover(context->tableau, context->dual);
+                    }
+                    if(recovered < 0)
+                    {
+                        context->status = SIMPLEX_ERROR;
+                    }
+                    else if(recovered == 0)
+                    {
+                        simplex_log_printf(log, SIMPLEX_LOG_SUMMARY, "Phase 2: recovered basis is not optimal, solve primal problem\n");
+                        context->status = SIMPLEX_LIMIT_REACHED;
+                        context->form = SIMPLEX_FORM_PRIMAL;
+                        context->phase = 1;
+                    }
+                    simplex_free_tableau(context->dual);
+                    context->dual = NULL;
+                    current = context->tableau;
+                }
+                if(context->phase == 0 && context->status != SIMPLEX_ERROR && SIMPLEX_LOG_ENABLED(log, SIMPLEX_LOG_SUMMARY))
+                {
+                    simplex_log_printf(log, SIMPLEX_LOG_SUMMARY, "Phase 2: %s after %ld pivots, target function value %d/%d\n",
+                                       (context->status == SIMPLEX_OPTIMAL) ? "optimal"
+                                       : ((context->status == SIMPLEX_UNBOUNDED) ? "unbounded" : "infeasible"),
+                                       context->iterations, -((current->z)->n), (current->z)->d);
+                }
+            }
+            continue;
+        }
+
+        if((maxPivots > 0 && pivots >= maxPivots)
+           || (context->maxIterations > 0 && context->iterations >= context->maxIterations)
+           || (context->maxSeconds > 0.0 && context->seconds + (stats_now() - start) >= context->maxSeconds))
+        {
+            break;
+        }
+
+        context->stats.phase = context->phase;
+        simplex_log_printf(log, SIMPLEX_LOG_PIVOT, "Phase %d, pivot %ld: line %d, column %d\n",
+                           context->phase, context->iterations + 1, current->pivotLine, current->pivotColumn);
+        if(simplex_step(current) != 0)
+        {
+            context->status = SIMPLEX_ERROR;
+            context->phase = 0;
+            break;
+        }
+        ++unreduced;
+        if(((context->reduceInterval > 0 && unreduced >= context->reduceInterval)
+            || (context->reduceThreshold > 0 && line_exceeds(current, current->pivotLine, context->reduceThreshold)))
+           && !SIMPLEX_LOG_ENABLED(log, SIMPLEX_LOG_TABLEAU))
+        {
+            reduce_lines(current);
+            unreduced = 0;
+        }
+        update_pivot(current);
+        simplex_log_tableau(log, SIMPLEX_LOG_TABLEAU, current);
+        ++pivots;
+        ++(context->iterations);
+    }
+
+    unscale_lines(context->tableau);
+    if(context->dual != NULL)
+    {
+        unscale_lines(context->dual);
+    }
+    if(rational_overflow() && context->status != SIMPLEX_ERROR)
+    {
+        simplex_log_printf(log, SIMPLEX_LOG_SUMMARY, "Solve stopped, a result did not fit into an int\n");
+        context->status = SIMPLEX_OVERFLOW;
+        context->phase = 0;
+    }
+    stats_bind(previous);
+    context->seconds += stats_now() - start;
+
+    return context->status;
+}
+
+static int has_improving_column(struct Tableau *tableau)
+{
+    int i;
+
+    for(i=0; i<tableau->cols; ++i)
+    {
+        if((tableau->c[i])->n > 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
+enum SimplexStatus simplex_solve(struct Tableau *tableau)
+{
+    struct SimplexContext *context;
+    enum SimplexStatus status;
+
+    context = simplex_context_create(tableau);
+    if(context == NULL)
+    {
+        return SIMPLEX_ERROR;
+    }
+    status = simplex_iterate(context, 0);
+    simplex_context_free(context);
+
+    return status;
+}
+
+static int start_phase1_in_place(struct Tableau *tableau, struct Rational **target)
+{
+    struct Rational *cost;
+    int i, j, variables = tableau->cols + tableau->rows;
+
+    *target = NULL;
+    for(i=0; i<tableau->rows; ++i)
+    {
+        if(tableau->bvs[i] >= tableau->artificials)
+        {
+            break;
+        }
+    }
+    if(i == tableau->rows)
+    {
+        return 0;
+    }
+
+    cost = (struct Rational *)malloc((variables + 1) * sizeof(struct Rational));
+    if(cost == NULL)
+    {
+        return -1;
+    }
+    STATS_ALLOC((variables + 1) * sizeof(struct Rational));
+
+    cost[0] = *(tableau->z);
+    (tableau->z)->n = 0;
+    (tableau->z)->d = 1;
+    for(i=0; i<tableau->rows; ++i) /* Basis variables do not appear in the target function. */
+    {
+        cost[tableau->bvs[i] + 1].n = 0;
+        cost[tableau->bvs[i] + 1].d = 1;
+    }
+    for(j=0; j<tableau->cols; ++j)
+    {
+        cost[tableau->nbvs[j] + 1] = *(tableau->c[j]);
+        (tableau->c[j])->n = 0;
+        (tableau->c[j])->d = 1;
+    }
+
+    for(i=0; i<tableau->rows; ++i) /* Maximize -sum(artificial) = -sum(b) + sum(A x). */
+    {
+        if(tableau->bvs[i] < tableau->artificials)
+        {
+            continue;
+        }
+        for(j=0; j<tableau->cols; ++j)
+        {
+            *(tableau->c[j]) = rational_sum(*(tableau->c[j]), *(tableau->A[i][j]));
+        }
+        *(tableau->z) = rational_sum(*(tableau->z), *(tableau->b[i]));
+    }
+
+    update_pivot(tableau);
+    *target = cost;
+
+    return 0;
+}
+
+static int finish_phase1_in_place(struct Tableau *tableau, struct Rational *cost)
+{
+    struct Rational value;
+    int i, j, next;
+
+    for(i=0; i<tableau->rows; ++i) /* Artificial basis variables have value 0 and can be exchanged. */
+    {
+        if(tableau->bvs[i] < tableau->artificials)
+        {
+            continue;
+        }
+        for(j=0; j<tableau->cols; ++j)
+        {
+            if(tableau->nbvs[j] < tableau->artificials && (tableau->A[i][j])->n != 0)
+            {
+                if(simplex_pivot(tableau, i, j) != 0)
+                {
+                    return -1;
+                }
+                break;
+            }
+        }
+    }
+
+    for(j=tableau->cols-1; j>=0; --j)
+    {
+        if(tableau->nbvs[j] >= tableau->artificials && remove_column(tableau, j) != 0)
+        {
+            return -1;
+        }
+    }
+
+    for(j=0; j<tableau->cols; ++j) /* c_j = cost_j - sum(cost_B A_j) */
+    {
+        value = cost[tableau->nbvs[j] + 1];
+        for(i=0; i<tableau->rows; ++i)
         {
-            string = rational_to_string(tableau->A[i][j]);
-            printf("%8s ", *string);
-            free(*string);
-            free(string);
+            if(tableau->bvs[i] < tableau->artificials && cost[tableau->bvs[i] + 1].n != 0)
+            {
+                value = rational_difference(value, rational_product(cost[tableau->bvs[i] + 1], *(tableau->A[i][j])));
+            }
         }
-        string = rational_to_string(tableau->b[i]);
-        printf(" |  %8s\n", *string);
-        free(*string);
-        free(string);
+        *(tableau->c[j]) = value;
     }
 
-    printf("Pivot-Line: %d, Pivot-Column: %d\n", tableau->pivotLine, tableau->pivotColumn);
-
-    tmp = rational_invert_sign(tableau->z);
-    string = rational_to_string(tmp);
-    printf("aktueller Zielfunktionswert: %s\n", *string);
-    free(*string);
-    free(string);
-    free(tmp);
-
-
-    printf("aktuelle Basisvariablen: [ ");
+    value = cost[0]; /* z = z0 - sum(cost_B b) */
     for(i=0; i<tableau->rows; ++i)
     {
-        printf("%d", tableau->bvs[i]);
-        if(i < tableau->rows-1)
+        if(tableau->bvs[i] < tableau->artificials && cost[tableau->bvs[i] + 1].n != 0)
         {
-            printf(", ");
+            value = rational_difference(value, rational_product(cost[tableau->bvs[i] + 1], *(tableau->b[i])));
         }
     }
-    printf(" ]\n");
+    *(tableau->z) = value;
 
-    printf("aktuelle Nichtbasisvariablen: [ ");
-    for(i=0; i<(tableau->cols); ++i)
+    next = tableau->artificials; /* Remaining artificial variables belong to redundant equations. */
+    for(i=0; i<tableau->rows; ++i)
     {
-        printf("%d", tableau->nbvs[i]);
-        if(i < (tableau->cols)-1)
+        if(tableau->bvs[i] >= tableau->artificials)
         {
-            printf(", ");
+            tableau->bvs[i] = next++;
         }
     }
-    printf(" ]\n");
+
+    return 0;
 }
 
-struct Rational **simplex_get_solution(struct Tableau *tableau)
+static int remove_column(struct Tableau *tableau, int column)
 {
-    struct Rational **solution;
-    int i;
+    int i, last = tableau->cols - 1;
 
-    solution = (struct Rational **)malloc(sizeof(struct Rational *));
-    *solution = (struct Rational *)malloc((tableau->cols + tableau->rows) * sizeof(struct Rational));
-    for(i=0; i<(tableau->cols + tableau->rows); ++i)
+    if(simplex_own_lines(tableau) != 0)
     {
-        (*solution)[i].n = 0;
-        (*solution)[i].d = 1;
+        return -1;
     }
     for(i=0; i<tableau->rows; ++i)
     {
-        (*solution)[tableau->bvs[i]].n = (tableau->b[i])->n;
-        (*solution)[tableau->bvs[i]].d = (tableau->b[i])->d;
+        simplex_free_cell(tableau, tableau->A[i][column]);
+        tableau->A[i][column] = tableau->A[i][last];
     }
+    simplex_free_cell(tableau, tableau->c[column]);
+    tableau->c[column] = tableau->c[last];
+    tableau->nbvs[column] = tableau->nbvs[last];
 
-    return solution;
+    --(tableau->cols);
+
+    return 0;
 }
 
-void simplex_print_solution(struct Tableau *tableau)
+long simplex_crash(struct Tableau *tableau)
 {
-    int i;
-    struct Rational **solution = simplex_get_solution(tableau);
-    char **string;
+    int i, j, *crashed;
+    long pivots = 0;
 
-    printf("[ ");
-    for(i=0; i<(tableau->cols + tableau->rows); ++i)
+    crashed = (int *)calloc(tableau->rows + 1, sizeof(int));
+    if(crashed == NULL)
     {
-        string = rational_to_string(&((*solution)[i]));
-        printf("%s", *string);
-        free(*string);
-        free(string);
+        return -1;
+    }
 
-        if(i < (tableau->cols + tableau->rows)-1)
+    for(i=0; i<tableau->rows; ++i)
+    {
+        if((tableau->b[i])->n >= 0)
         {
-            printf(", ");
+            continue;
+        }
+        j = find_crash_column(tableau, i, crashed);
+        if(j >= 0)
+        {
+            simplex_log_printf(simplex_log_current(), SIMPLEX_LOG_PIVOT, "Crash pivot: line %d, column %d\n", i, j);
+            if(simplex_pivot(tableau, i, j) != 0)
+            {
+                free(crashed);
+                return -1;
+            }
+            crashed[i] = 1;
+            ++pivots;
         }
     }
-    printf(" ]\n");
 
-    free(*solution);
-    free(solution);
+    free(crashed);
+    if(add_artificials(tableau) != 0)
+    {
+        return -1;
+    }
+
+    return pivots;
 }
 
-/*static void resize_tableau(struct Tableau *tableau, int equations, int variables)
+static int add_artificials(struct Tableau *tableau)
 {
     int i, j;
 
-    if(tableau->rows > equations)
+    for(i=0; i<tableau->rows; ++i) /* x_B = b - A x_N < 0  =>  artificial = -b + A x_N + x_B */
     {
-        for(i=equations; i<tableau->rows; ++i)
+        if((tableau->b[i])->n >= 0)
         {
-            for(j=0; j<tableau->cols; ++j)
-            {
-                free(tableau->A[i][j]);
-            }
-            free(tableau->A[i]);
+            continue;
+        }
+        if(add_column(tableau, tableau->bvs[i]) != 0)
+        {
+            return -1;
         }
+        for(j=0; j<tableau->cols-1; ++j)
+        {
+            (tableau->A[i][j])->n = -((tableau->A[i][j])->n);
+        }
+        (tableau->A[i][tableau->cols-1])->n = -1;
+        (tableau->b[i])->n = -((tableau->b[i])->n);
+        tableau->bvs[i] = tableau->cols + tableau->rows - 1;
     }
 
-    if(tableau->rows != equations)
-    {
-        tableau->A = (struct Rational ***)realloc(tableau->A, equations * sizeof(struct Rational **));
-    }
+    tableau->pivotLine = -1;
+    tableau->pivotColumn = -1;
 
-    if(tableau->cols != variables)
+    return 0;
+}
+
+static int find_crash_column(struct Tableau *tableau, int line, const int *crashed)
+{
+    struct Rational step, value;
+    int i, j, fixed, best = -1, bestFixed = -1;
+
+    for(j=0; j<tableau->cols; ++j)
     {
-        for(i=0; i<equations; ++i)
+        if((tableau->A[line][j])->n >= 0 || tableau->nbvs[j] >= tableau->artificials)
         {
-            if(i >= tableau->rows)
+            continue;
+        }
+
+        step = rational_quotient(*(tableau->b[line]), *(tableau->A[line][j]));
+        fixed = 0;
+        for(i=0; i<tableau->rows; ++i)
+        {
+            if((tableau->A[i][j])->n == 0)
             {
-                tableau->A[i] = (struct Rational **)malloc(variables * sizeof(struct Rational *));
-                for(j=0; j<variables; ++j)
-                {
-                    tableau->A[i][j] = rational_create();
-                }
+                continue;
             }
-            else
+            if(crashed[i])
             {
-                for(j=variables; j<tableau->cols; ++j)
-                {
-                    free(tableau->A[i][j]);
-                }
-                tableau->A[i] = (struct Rational **)realloc(tableau->A[i], variables * sizeof(struct Rational *));
-                for(j=tableau->cols; j<variables; ++j)
-                {
-                    tableau->A[i][j] = rational_create();
-                }
+                break;
+            }
+            value = rational_difference(*(tableau->b[i]), rational_product(*(tableau->A[i][j]), step));
+            if(value.n < 0 && (tableau->b[i])->n >= 0)
+            {
+                break;
             }
+            fixed += (value.n >= 0 && (tableau->b[i])->n < 0) ? 1 : 0;
+        }
+        if(i == tableau->rows && fixed > bestFixed)
+        {
+            best = j;
+            bestFixed = fixed;
         }
     }
 
-    for(j=variables; j<tableau->cols; ++j)
+    return best;
+}
+
+static int add_column(struct Tableau *tableau, int variable)
+{
+    struct Rational **line;
+    int *nbvs;
+    int i, k, cols = tableau->cols + 1;
+
+    if(simplex_own_lines(tableau) != 0)
     {
-        free(tableau->c[j]);
+        return -1;
     }
-    tableau->c = (struct Rational **)realloc(tableau->c, variables * sizeof(struct Rational *));
-    for(j=tableau->cols; j<variables; ++j)
+
+    /* Grow the arrays first, the tableau stays valid with the old size if no memory is left. */
+    for(i=0; i<tableau->rows; ++i)
     {
-        tableau->c[j] = rational_create();
+        line = (struct Rational **)realloc(tableau->A[i], cols * sizeof(struct Rational *));
+        if(line == NULL)
+        {
+            return -1;
+        }
+        tableau->A[i] = line;
     }
-
-    for(j=equations; j<tableau->rows; ++j)
+    line = (struct Rational **)realloc(tableau->c, cols * sizeof(struct Rational *));
+    if(line == NULL)
     {
-        free(tableau->b[j]);
+        return -1;
     }
-    tableau->b = (struct Rational **)realloc(tableau->b, equations * sizeof(struct Rational *));
-    for(j=tableau->rows; j<equations; ++j)
+    tableau->c = line;
+    nbvs = (int *)realloc(tableau->nbvs, cols * sizeof(int));
+    if(nbvs == NULL)
     {
-        tableau->b[j] = rational_create();
+        return -1;
     }
+    tableau->nbvs = nbvs;
 
-    tableau->bvs = (int *)realloc(tableau->bvs, variables * sizeof(int));
+    for(i=0; i<tableau->rows; ++i)
+    {
+        tableau->A[i][cols-1] = rational_create();
+        if(tableau->A[i][cols-1] == NULL)
+        {
+            break;
+        }
+    }
+    tableau->c[cols-1] = (i == tableau->rows) ? rational_create() : NULL;
+    if(tableau->c[cols-1] == NULL)
+    {
+        for(k=0; k<i; ++k)
+        {
+            free(tableau->A[k][cols-1]);
+        }
+        return -1;
+    }
+    tableau->nbvs[cols-1] = variable;
+    STATS_ALLOC((tableau->rows + 1) * sizeof(struct Rational *));
 
-    tableau->nbvs = (int *)realloc(tableau->nbvs, (variables-equations) * sizeof(int));
+    tableau->cols = cols;
 
-    tableau->cols = variables;
-    tableau->rows = equations;
-}*/
+    return 0;
+}
 
-static void update_pivot(struct Tableau *tableau)
+int simplex_pivot_to_basis(struct Tableau *tableau, const int *target)
 {
-    int i;
-    struct Rational *min = rational_create();
-    struct Rational *tmp = NULL;
+    int j, k;
 
-    tableau->pivotColumn = -1;
-    tableau->pivotLine = -1;
-
-    do
+    for(j=0; j<tableau->cols; ++j) /* Exchange each marked variable into a line of a leaving variable. */
     {
-        i=tableau->pivotColumn+1;
-        tableau->pivotColumn = -1;
-        for(; i<tableau->cols; ++i)
+        if(!target[tableau->nbvs[j]])
         {
-            if((tableau->c[i])->n > 0)
-            {
-                tableau->pivotColumn = i;
-                break;
-            }
+            continue;
         }
-
-        if(tableau->pivotColumn >= 0)
+        for(k=0; k<tableau->rows; ++k)
         {
-            tableau->pivotLine = -1;
-
-            for(i=0; i<tableau->rows; ++i)
+            if(!target[tableau->bvs[k]] && (tableau->A[k][j])->n != 0)
             {
-                if((tableau->A[i][tableau->pivotColumn])->n > 0)
+                if(simplex_pivot(tableau, k, j) != 0)
                 {
-                    tmp = rational_divide(tableau->b[i], tableau->A[i][tableau->pivotColumn]);
-                    if(1 == rational_is_a_smaller_than_b(tmp, min) || tableau->pivotLine == -1)
-                    {
-                        tableau->pivotLine = i;
-                        free(min);
-                        min = NULL;
-                        min = tmp;
-                    }
-                    else
-                    {
-                        free(tmp);
-                        tmp = NULL;
-                    }
+                    return -1;
                 }
+                j = -1; /* Columns changed, start again. */
+                break;
             }
         }
     }
-    while(tableau->pivotColumn != -1 && tableau->pivotLine == -1);
 
-    free(min);
+    return 0;
 }
 
-
-static void simplex_step(struct Tableau *tableau)
+struct Tableau *simplex_dual_tableau(struct Tableau *tableau)
 {
-    int i, j, temp;
-    struct Rational *pivotValue, *tmp, *tmp2, *fact;
-    struct Rational **bv;
-    struct Rational *cb;
+    struct Tableau *dual;
+    int i, j;
 
-    bv = (struct Rational **)malloc(tableau->rows * sizeof(struct Rational *));
-    for(i=0; i<tableau->rows; ++i)
+    if(tableau->artificials < tableau->cols + tableau->rows)
     {
-        if(i == tableau->pivotLine)
-        {
-            bv[i] = rational_get(1, 1);
-        }
-        else
-        {
-            bv[i] = rational_get(0, 1);
-        }
+        return NULL;
     }
-    cb = rational_get(0,1);
-
-    pivotValue = rational_clone(tableau->A[tableau->pivotLine][tableau->pivotColumn]);
 
-    if(!(pivotValue->n == 1 && pivotValue->d == 1))
+    /* max cx - z s.t. Ax <= b  <=>  max -by + z s.t. -A^T y <= -c */
+    dual = simplex_create_tableau(tableau->cols, tableau->cols + tableau->rows);
+    if(dual == NULL)
     {
-        for(i=0; i<tableau->cols; ++i)
+        return NULL;
+    }
+    for(i=0; i<tableau->rows; ++i)
+    {
+        for(j=0; j<tableau->cols; ++j)
         {
-            tmp = tableau->A[tableau->pivotLine][i];
-            tableau->A[tableau->pivotLine][i] = rational_divide(tableau->A[tableau->pivotLine][i], pivotValue);
-            free(tmp);
+            *(dual->A[j][i]) = *(tableau->A[i][j]);
+            (dual->A[j][i])->n = -((dual->A[j][i])->n);
         }
+        *(dual->c[i]) = *(tableau->b[i]);
+        (dual->c[i])->n = -((dual->c[i])->n);
+        dual->nbvs[i] = i;
+    }
+    for(j=0; j<tableau->cols; ++j)
+    {
+        *(dual->b[j]) = *(tableau->c[j]);
+        (dual->b[j])->n = -((dual->b[j])->n);
+        dual->bvs[j] = tableau->rows + j;
+    }
+    *(dual->z) = *(tableau->z);
+    (dual->z)->n = -((dual->z)->n);
+    dual->pricing = tableau->pricing;
 
-        tmp = bv[tableau->pivotLine];
-        bv[tableau->pivotLine] = rational_divide(bv[tableau->pivotLine], pivotValue);
-        free(tmp);
+    return dual;
+}
 
-        tmp = tableau->b[tableau->pivotLine];
-        tableau->b[tableau->pivotLine] = rational_divide(tableau->b[tableau->pivotLine], pivotValue);
-        free(tmp);
-    }
+int simplex_dual_recover(struct Tableau *tableau, struct Tableau *dual)
+{
+    int i, j, variable, status, *target;
 
-    fact = rational_clone(tableau->c[tableau->pivotColumn]);
-    for(i=0; i<tableau->cols; ++i)
+    target = (int *)calloc(tableau->cols + tableau->rows + 1, sizeof(int));
+    if(target == NULL)
     {
-        tmp = tableau->c[i];
-        tmp2 = rational_multiply(tableau->A[tableau->pivotLine][i], fact);
-        tableau->c[i] = rational_subtract(tableau->c[i], tmp2);
-        free(tmp2);
-        free(tmp);
+        return -1;
     }
 
-    tmp = cb;
-    tmp2 = rational_multiply(bv[tableau->pivotLine], fact);
-    cb = rational_subtract(cb, tmp2);
-    free(tmp2);
-    free(tmp);
+    /* Complementary basis: dual variable y_i belongs to basis variable i, slack w_j to none basis variable j. */
+    for(j=0; j<dual->cols; ++j)
+    {
+        variable = dual->nbvs[j];
+        target[(variable < tableau->rows) ? tableau->bvs[variable] : tableau->nbvs[variable - tableau->rows]] = 1;
+    }
 
-    tmp = tableau->z;
-    tmp2 = rational_multiply(tableau->b[tableau->pivotLine], fact);
-    tableau->z = rational_subtract(tableau->z, tmp2);
-    free(tmp2);
-    free(tmp);
-    free(fact);
+    status = simplex_pivot_to_basis(tableau, target);
+    free(target);
+    if(status != 0)
+    {
+        return -1;
+    }
+    update_pivot(tableau);
 
-    for(j=0; j<tableau->rows; ++j)
+    for(i=0; i<tableau->rows; ++i)
     {
-        if(j == tableau->pivotLine)
+        if((tableau->b[i])->n < 0)
         {
-            continue;
+            return 0;
         }
+    }
 
-        fact = rational_clone(tableau->A[j][tableau->pivotColumn]);
-        for(i=0; i<tableau->cols; ++i)
-        {
-            tmp = tableau->A[j][i];
-            tmp2 = rational_multiply(tableau->A[tableau->pivotLine][i], fact);
-            tableau->A[j][i] = rational_subtract(tableau->A[j][i], tmp2);
-            free(tmp2);
-            free(tmp);
-        }
+    return !has_improving_column(tableau);
+}
 
-        tmp = bv[j];
-        tmp2 = rational_multiply(bv[tableau->pivotLine], fact);
-        bv[j] = rational_subtract(bv[j], tmp2);
-        free(tmp2);
-        free(tmp);
+static enum SimplexForm choose_form(struct Tableau *tableau)
+{
+    int i, primal = tableau->rows, dual = tableau->cols;
 
-        tmp = tableau->b[j];
-        tmp2 = rational_multiply(tableau->b[tableau->pivotLine], fact);
-        tableau->b[j] = rational_subtract(tableau->b[j], tmp2);
-        free(tmp2);
-        free(tmp);
-        free(fact);
+    if(tableau->artificials < tableau->cols + tableau->rows)
+    {
+        return SIMPLEX_FORM_PRIMAL;
     }
 
-    free(tableau->c[tableau->pivotColumn]);
-    tableau->c[tableau->pivotColumn] = cb;
     for(i=0; i<tableau->rows; ++i)
     {
-        free(tableau->A[i][tableau->pivotColumn]);
-        tableau->A[i][tableau->pivotColumn] = bv[i];
+        primal += ((tableau->b[i])->n < 0) ? 1 : 0;
+    }
+    for(i=0; i<tableau->cols; ++i)
+    {
+        dual += ((tableau->c[i])->n > 0) ? 1 : 0;
     }
 
-    temp = tableau->bvs[tableau->pivotLine];
-    tableau->bvs[tableau->pivotLine] = tableau->nbvs[tableau->pivotColumn];
-    tableau->nbvs[tableau->pivotColumn] = temp;
-
-    free(bv);
-    free(pivotValue);
+    return (2 * dual < primal) ? SIMPLEX_FORM_DUAL : SIMPLEX_FORM_PRIMAL;
 }
 
-struct Tableau *simplex_find_start_corner(struct Tableau *tab)
+static void reduce_lines(struct Tableau *tableau)
 {
+    struct Rational content;
+    long long divisor, multiple, n, d, g;
     int i, j;
-    struct Tableau *phase1;
-    struct Rational *tmp;
-
-    phase1 = simplex_create_tableau(tab->rows, (tab->cols + 2*tab->rows));
 
-    for(i=0; i<tab->rows; ++i)
+    if(tableau->scale == NULL)
     {
-        for(j=0; j<tab->cols; ++j)
+        tableau->scale = (struct Rational *)malloc((tableau->rows + 1) * sizeof(struct Rational));
+        if(tableau->scale == NULL)
         {
-            free(phase1->A[i][j]);
-            phase1->A[i][j] = rational_get((tab->A[i][j])->n, (tab->A[i][j])->d);
+            return;
+        }
+        STATS_ALLOC((tableau->rows + 1) * sizeof(struct Rational));
+        for(i=0; i<tableau->rows; ++i)
+        {
+            tableau->scale[i].n = 1;
+            tableau->scale[i].d = 1;
         }
     }
 
-    for(i=0; i<phase1->rows; ++i)
-    {
-        free(phase1->A[phase1->rows-1-i][phase1->cols-1-i]);
-        phase1->A[phase1->rows-1-i][phase1->cols-1-i] = rational_get(1,1);
-    }
-
-    for(i=0; i<phase1->cols; ++i)
+    for(i=0; i<tableau->rows; ++i)
     {
-        free(phase1->c[i]);
-        phase1->c[i] = rational_get(0,1);
-        if(i < phase1->cols)
+        divisor = (tableau->b[i])->n;
+        multiple = (tableau->b[i])->d;
+        for(j=0; j<tableau->cols && multiple <= INT_MAX; ++j)
         {
-            for(j=0; j<phase1->rows; ++j)
-            {
-                tmp = phase1->c[i];
-                phase1->c[i] = rational_add(phase1->c[i], phase1->A[j][i]);
-                free(tmp);
-            }
+            divisor = common_divisor(divisor, (tableau->A[i][j])->n);
+            multiple = multiple / common_divisor(multiple, (tableau->A[i][j])->d) * (tableau->A[i][j])->d;
+        }
+        if(divisor == 0 || multiple > INT_MAX || (divisor == 1 && multiple == 1))
+        {
+            continue;
         }
-    }
 
-    for(j=0; j<tab->rows; ++j)
-    {
-        free(phase1->b[j]);
-        phase1->b[j] = rational_get((tab->b[j])->n, (tab->b[j])->d);
-    }
+        /* The content is normalized: a prime of a denominator does not divide the numerator of its cell. */
+        n = (long long)(tableau->scale[i].n) * divisor;
+        d = (long long)(tableau->scale[i].d) * multiple;
+        g = common_divisor(n, d);
+        n /= g;
+        d /= g;
+        if(n > INT_MAX || d > INT_MAX || simplex_own_line(tableau, i) != 0)
+        {
+            continue;
+        }
 
-    for(j=0; j<phase1->rows; ++j)
-    {
-        tmp = phase1->z;
-        phase1->z = rational_add(phase1->z, phase1->b[j]);
-        free(tmp);
+        content.n = (int)divisor;
+        content.d = (int)multiple;
+        for(j=0; j<tableau->cols; ++j)
+        {
+            *(tableau->A[i][j]) = rational_quotient(*(tableau->A[i][j]), content);
+        }
+        *(tableau->b[i]) = rational_quotient(*(tableau->b[i]), content);
+        tableau->scale[i].n = (int)n;
+        tableau->scale[i].d = (int)d;
+        STATS_COUNT(lineReductions);
     }
+}
 
-    for(i=0; i<phase1->cols; ++i)
-    {
-        phase1->nbvs[i] = i;
-    }
+static void unscale_lines(struct Tableau *tableau)
+{
+    int i, j;
 
-    for(i=0; i<phase1->rows; ++i)
+    if(tableau->scale == NULL)
     {
-        phase1->bvs[i] = i + phase1->cols;
+        return;
     }
 
-    update_pivot(phase1);
-
-    simplex_print_tableau(phase1);
-
-    while(phase1->pivotColumn >= 0 && phase1->pivotLine >= 0)
+    for(i=0; i<tableau->rows; ++i)
     {
-        simplex_step(phase1);
-        update_pivot(phase1);
+        if(tableau->scale[i].n == 1 && tableau->scale[i].d == 1)
+        {
+            continue;
+        }
+        for(j=0; j<tableau->cols; ++j)
+        {
+            *(tableau->A[i][j]) = rational_product(*(tableau->A[i][j]), tableau->scale[i]);
+        }
+        *(tableau->b[i]) = rational_product(*(tableau->b[i]), tableau->scale[i]);
     }
 
-    return phase1;
+    free(tableau->scale);
+    tableau->scale = NULL;
 }
 
-void prepare_with_start_corner(struct Tableau *phase1, struct Tableau *tableau)
+static int line_exceeds(struct Tableau *tableau, int line, int threshold)
 {
-    int i, j;
+    int j;
 
-    for(i=0; i<phase1->rows; ++i)
+    if((tableau->b[line])->n > threshold || (tableau->b[line])->n < -threshold || (tableau->b[line])->d > threshold)
     {
-        if(tableau->bvs[i] != phase1->bvs[i])
+        return 1;
+    }
+    for(j=0; j<tableau->cols; ++j)
+    {
+        if((tableau->A[line][j])->n > threshold || (tableau->A[line][j])->n < -threshold
+           || (tableau->A[line][j])->d > threshold)
         {
-            tableau->pivotColumn = -1;
-            for(j=0; j<tableau->cols; ++j)
-            {
-                if(tableau->nbvs[j] == phase1->bvs[i])
-                {
-                    tableau->pivotColumn = j;
-                    break;
-                }
-            }
-            tableau->pivotLine = i;
-            simplex_step(tableau);
+            return 1;
         }
     }
+
+    return 0;
 }
 
-void simplex_find_best_solution(struct Tableau *tableau)
+static long long common_divisor(long long a, long long b)
 {
+    long long tmp;
 
-    update_pivot(tableau);
+    a = (a<0)?-a:a;
+    b = (b<0)?-b:b;
 
-    while(tableau->pivotColumn >= 0 && tableau->pivotLine >= 0)
+    while(b > 0)
     {
-        simplex_step(tableau);
-        update_pivot(tableau);
+        tmp = a % b;
+        a = b;
+        b = tmp;
     }
+
+    return a;
 }
@@ -4,6 +4,17 @@
  * This file describes the simplex functions and the simplex tableau, which is the
  * data structrue used for the algorithm.
  *
+ * The functions never stop the program. If no memory is left, functions which
+ * create objects return NULL, functions which change a tableau return -1 and
+ * solves end with SIMPLEX_ERROR.
+ *
+ * Thread safety: the library has no global state. Statistics and logs are
+ * bound to the calling thread while a function runs, so different tableaus and
+ * contexts can be used in different threads at the same time. A tableau, and
+ * a context with its tableau, must only be used by one thread at a time, except
+ * for simplex_cancel. Tableaus created with simplex_clone_tableau are
+ * independent in this sense, even though they share memory.
+ *
  * @file simplex.h
  * @author Thomas Irgang
  * @date 16 Feb 2015
@@ -12,7 +23,51 @@
 #ifndef SIMPLEX_H
 #define SIMPLEX_H SIMPLEX_H
 
+#include <stdatomic.h>
+
 #include "rational.h"
+#include "stats.h"
+#include "simplex_log.h"
+
+#define SIMPLEX_REDUCE_THRESHOLD 65536 /**< Default magnitude of the pivot line which triggers a reduction of the line contents. */
+
+/**
+ * @brief State of a (partial) solve.
+ *
+ * This enumeration describes the result of simplex_iterate.
+ */
+enum SimplexStatus
+{
+    SIMPLEX_OPTIMAL, /**< Optimal solution found. */
+    SIMPLEX_UNBOUNDED, /**< Target function is unbounded. */
+    SIMPLEX_INFEASIBLE, /**< Problem has no valid solution. */
+    SIMPLEX_LIMIT_REACHED, /**< Pivot, iteration or time limit reached. The solve can be continued. */
+    SIMPLEX_CANCELLED, /**< Solve was cancelled with simplex_cancel. */
+    SIMPLEX_ERROR, /**< No memory was left. The tableau is valid, but the solve can not be continued. */
+    SIMPLEX_OVERFLOW /**< A result did not fit into an int and was rounded. The tableau is not exact and the solve can not be continued. */
+};
+
+/**
+ * @brief Form of the solved problem.
+ *
+ * This enumeration describes whether simplex_iterate solves the given problem
+ * or its dual problem.
+ */
+enum SimplexForm
+{
+    SIMPLEX_FORM_AUTO, /**< Choose the form with the smaller estimated effort. */
+    SIMPLEX_FORM_PRIMAL, /**< Solve the given problem. */
+    SIMPLEX_FORM_DUAL /**< Solve the dual problem and recover the solution. */
+};
+
+/**
+ * @brief Rule to choose the pivot column.
+ */
+enum SimplexPricing
+{
+    SIMPLEX_PRICING_BLAND, /**< First improving column (rule of Bland), never cycles. */
+    SIMPLEX_PRICING_DANTZIG /**< Largest coefficient of the target function, Bland for degenerate pivots. */
+};
 
 /**
  * @brief Data structure for simplex algorithm.
@@ -31,33 +86,132 @@ struct Tableau
     int pivotColumn; /**< Current pivot column. */
     int *bvs;  /**< Current basis variables. */
     int *nbvs; /**< Current none basis variables. */
+    int artificials; /**< First artificial variable. Artificial variables are never chosen as pivot column. */
+    enum SimplexPricing pricing; /**< Rule to choose the pivot column. */
+    void *snapshot; /**< Memory of a loaded snapshot which holds cells, NULL if each cell is allocated on its own. */
+    size_t snapshotSize; /**< Size of snapshot in bytes. */
+    int snapshotMapped; /**< 1 if snapshot is a file mapping, 0 if it is allocated. */
+    atomic_int **shared; /**< Reference counters of the lines of A shared with clones, NULL for owned lines. NULL if the tableau never was cloned. */
+    int *positions; /**< Index of the variables: basis line i as i, none basis column j as -(j+1). Checked against bvs and nbvs before use, NULL until the first lookup. */
+    int positionsSize; /**< Number of entries of positions. */
+    struct Rational *scale; /**< Multipliers of the lines while simplex_iterate keeps them reduced: line i of A and b[i] are scale[i] times the cells. NULL outside of simplex_iterate. */
+};
+
+/**
+ * @brief Resumable solve of a tableau.
+ *
+ * This structure holds the state of a solve which runs phase 1 and phase 2
+ * of the simplex algorithm step-wise. The limits can be changed between the
+ * calls of simplex_iterate, a value of 0 means no limit.
+ */
+struct SimplexContext
+{
+    struct Tableau *tableau; /**< Problem tableau. It is solved in place. */
+    struct Tableau *dual; /**< Tableau of the dual problem while it is solved, NULL else. */
+    enum SimplexForm form; /**< Form to solve, set to the chosen form by simplex_iterate. */
+    int crash; /**< 1 to start phase 1 with simplex_crash, 0 to start with artificial variables for all invalid lines. */
+    struct Rational *cost; /**< Target function of phase 2 during phase 1, z followed by the coefficients of the variables. NULL else. */
+    int phase; /**< Current phase: 1, 2 or 0 if the solve is finished. */
+    enum SimplexStatus status; /**< Status of last call of simplex_iterate. */
+    long iterations; /**< Number of pivots done so far. */
+    long maxIterations; /**< Limit for the total number of pivots. */
+    double seconds; /**< Wall-clock time spent in simplex_iterate so far. */
+    double maxSeconds; /**< Limit for the total wall-clock time in seconds. */
+    long reduceInterval; /**< Number of pivots between reductions of the line contents, 0 for none. */
+    int reduceThreshold; /**< Reduce the line contents if a numerator or denominator of the pivot line exceeds this magnitude, 0 for never. */
+    atomic_int cancelled; /**< Cancellation flag, set with simplex_cancel. */
+    struct SimplexStats stats; /**< Profiling counters of the solve. */
+    struct SimplexLog log; /**< Log of the solve, off by default. */
 };
 
 /**
  * @brief Create a new tableau.
  *
  * This function creates a new 0/1-filled Tableau structure with the given number of
- * equations and the given number of variables.
+ * equations and the given number of variables. The tableau has no artificial
+ * variables, i.e. artificials is the number of variables, and uses the rule of
+ * Bland.
  *
  * @param equations
  *    number of equations of new tableau
  * @param variables
  *    number of variables of new tableau
- * @return pointer to new tableau
+ * @return pointer to new tableau or NULL if no memory is left
  */
 struct Tableau* simplex_create_tableau(int equations, int variables);
 
 
+/**
+ * @brief Copy a tableau.
+ *
+ * @param tableau
+ *    tableau to copy
+ * @return new tableau with the same content or NULL if no memory is left
+ */
+struct Tableau *simplex_copy_tableau(struct Tableau *tableau);
+
+/**
+ * @brief Clone a tableau.
+ *
+ * This function creates a copy of the given tableau, which shares the lines of
+ * A with the given tableau. Each tableau copies a shared line before it writes
+ * to it, so the memory grows only with the changed lines. A pivot changes only
+ * the pivot line and the lines with a none zero entry in the pivot column.
+ * Tableaus which share lines can be used and freed in different threads.
+ * Tableaus of snapshots are copied with simplex_copy_tableau.
+ *
+ * @param tableau
+ *    tableau to clone
+ * @return new tableau with the same content or NULL if no memory is left
+ */
+struct Tableau *simplex_clone_tableau(struct Tableau *tableau);
+
+/**
+ * @brief Take ownership of a line.
+ *
+ * This function copies the given line of A if it is shared with a clone. It
+ * must be called before cells or the cell pointers of the line are changed.
+ *
+ * @param tableau
+ *    tableau of the line
+ * @param line
+ *    line of A which will be changed
+ * @return 0 on success, -1 if no memory is left; the line stays shared then
+ */
+int simplex_own_line(struct Tableau *tableau, int line);
+
+/**
+ * @brief Take ownership of all lines.
+ *
+ * @param tableau
+ *    tableau whose lines will be changed
+ * @return 0 on success, -1 if no memory is left
+ */
+int simplex_own_lines(struct Tableau *tableau);
+
 /**
  * @brief Free memory of given tableau.
  *
  * This function frees the memory which is associated with the given tableau.
  *
  * @param tableau
- *    pointer to tableau to free
+ *    pointer to tableau to free, may be NULL
  */
 void simplex_free_tableau(struct Tableau *tableau);
 
+/**
+ * @brief Free a cell of a tableau.
+ *
+ * This function frees a cell which was replaced by a new one. Cells of a
+ * loaded snapshot are part of its memory and are released with the tableau.
+ *
+ * @param tableau
+ *    tableau of the cell
+ * @param cell
+ *    replaced cell
+ */
+void simplex_free_cell(struct Tableau *tableau, struct Rational *cell);
+
 /**
  * @brief Print the tableau to stdout.
  *
@@ -76,10 +230,73 @@ void simplex_print_tableau(struct Tableau *tableau);
  *
  * @param tableau
  *    tableau to read solution
- * @return current solution of tableau
+ * @return current solution of tableau or NULL if no memory is left
  */
 struct Rational **simplex_get_solution(struct Tableau *tableau);
 
+/**
+ * @brief Get current value of a variable.
+ *
+ * This function reads the value of the given variable from the tableau in
+ * constant time. It uses an index of the variables, which is built by the
+ * first lookup, kept up to date by the pivots and rebuilt if bvs or nbvs were
+ * changed otherwise. Lookups between pivots do not allocate memory.
+ *
+ * @param tableau
+ *    tableau to read solution
+ * @param variable
+ *    variable to read
+ * @param value
+ *    value of variable, 0 for none basis variables
+ * @return 0 on success, -1 if the variable does not exist
+ */
+int simplex_solution_value(struct Tableau *tableau, int variable, struct Rational *value);
+
+/**
+ * @brief Get current dual value of a variable.
+ *
+ * This function reads the value of the dual variable complementary to the
+ * given variable, i.e. the negated coefficient of the target function for a
+ * none basis variable and 0 for a basis variable. For the slack variable of an
+ * equation this is its dual value (shadow price), for other variables it is
+ * the negated reduced cost. Like simplex_solution_value it needs constant time.
+ *
+ * @param tableau
+ *    tableau to read dual solution
+ * @param variable
+ *    variable to read
+ * @param value
+ *    dual value of variable
+ * @return 0 on success, -1 if the variable does not exist
+ */
+int simplex_dual_value(struct Tableau *tableau, int variable, struct Rational *value);
+
+/**
+ * @brief Get current solution into a buffer.
+ *
+ * This function writes the value of each variable to the given buffer, like
+ * simplex_get_solution but without allocation.
+ *
+ * @param tableau
+ *    tableau to read solution
+ * @param values
+ *    buffer for cols + rows values, values[i] = value of variable i
+ */
+void simplex_solution_values(const struct Tableau *tableau, struct Rational *values);
+
+/**
+ * @brief Get current dual solution into a buffer.
+ *
+ * This function writes the dual value of each variable, see
+ * simplex_dual_value, to the given buffer.
+ *
+ * @param tableau
+ *    tableau to read dual solution
+ * @param values
+ *    buffer for cols + rows values, values[i] = dual value of variable i
+ */
+void simplex_dual_values(const struct Tableau *tableau, struct Rational *values);
+
 /**
  * @brief Print tableau to stdout.
  *
@@ -100,7 +317,7 @@ void simplex_print_solution(struct Tableau *tableau);
  *
  * @param tableau
  *    tableau to find start corner
- * @return solved, extended tableau
+ * @return solved, extended tableau or NULL if no memory is left
  */
 struct Tableau *simplex_find_start_corner(struct Tableau *tab);
 
@@ -109,14 +326,47 @@ struct Tableau *simplex_find_start_corner(struct Tableau *tab);
  *
  * This function prepares the given tableau "tableau" for the phase 2 of the
  * simplex algorithm with the help of the given tableau "phase1", which have to
- * be a solved, extended tableau.
+ * be a solved, extended tableau with target function value 0. Artificial
+ * variables which are still basis variables of "phase1" are exchanged first.
  *
  * @param phase1
  *    solved extended tableau
  * @param tableau
  *    tableau of optimization problem
+ * @return 0 on success, -1 if no memory is left
+ */
+int prepare_with_start_corner(struct Tableau *phase1, struct Tableau *tableau);
+
+/**
+ * @brief Exchange a basis variable.
+ *
+ * This function exchanges the basis variable of the given line with the none
+ * basis variable of the given column. The pivot element must not be 0.
+ *
+ * @param tableau
+ *    tableau to update
+ * @param line
+ *    pivot line
+ * @param column
+ *    pivot column
+ * @return 0 on success, -1 if no memory is left; the tableau is unchanged then
+ */
+int simplex_pivot(struct Tableau *tableau, int line, int column);
+
+/**
+ * @brief Exchange the basis.
+ *
+ * This function pivots each marked none basis variable into a line of an
+ * unmarked basis variable. The marked variables must form a basis, otherwise
+ * some of them stay none basis variables.
+ *
+ * @param tableau
+ *    tableau to update
+ * @param target
+ *    1 for the variables of the new basis, indexed by variable
+ * @return 0 on success, -1 if no memory is left
  */
-void prepare_with_start_corner(struct Tableau *phase1, struct Tableau *tableau);
+int simplex_pivot_to_basis(struct Tableau *tableau, const int *target);
 
 /**
  * @brief Phase 2 of simplex algorithm.
@@ -125,7 +375,141 @@ void prepare_with_start_corner(struct Tableau *phase1, struct Tableau *tableau);
  *
  * @param tableau
  *    problem to solve
+ * @return 0 on success, -1 if no memory is left
+ */
+int simplex_find_best_solution(struct Tableau *tableau);
+
+/**
+ * @brief Crash basis for phase 1.
+ *
+ * This function prepares the given tableau for a phase 1 in the tableau itself.
+ * For each line with negative basis variable it greedily pivots in a column,
+ * which makes the line valid and keeps valid lines valid. The chosen columns
+ * are 0 in the lines changed before, so the new basis is triangular. Each
+ * remaining invalid line is negated and gets an artificial basis variable; its
+ * old basis variable becomes a new column. Afterwards all basis variables are
+ * valid and phase 1 is only needed if there are artificial basis variables.
+ *
+ * @param tableau
+ *    tableau to prepare
+ * @return number of pivots, -1 if no memory is left
+ */
+long simplex_crash(struct Tableau *tableau);
+
+/**
+ * @brief Create the dual problem.
+ *
+ * This function creates the tableau of the dual problem of the given tableau.
+ * The problem max cx - z s.t. Ax <= b, x >= 0 of the current basis becomes
+ * max -by + z s.t. -A^T y <= -c, y >= 0. Variable i of the dual tableau belongs
+ * to basis variable i, variable rows + j to none basis variable j.
+ *
+ * @param tableau
+ *    tableau of problem
+ * @return new dual tableau or NULL if the tableau has artificial variables or no memory is left
+ */
+struct Tableau *simplex_dual_tableau(struct Tableau *tableau);
+
+/**
+ * @brief Recover the solution of a dual problem.
+ *
+ * This function pivots the given tableau into the basis complementary to the
+ * optimal basis of its dual tableau.
+ *
+ * @param tableau
+ *    tableau of problem, unchanged since simplex_dual_tableau
+ * @param dual
+ *    solved dual tableau
+ * @return 1 if the tableau is optimal, 0 if the dual basis had redundant lines, -1 if no memory is left
+ */
+int simplex_dual_recover(struct Tableau *tableau, struct Tableau *dual);
+
+/**
+ * @brief Create a resumable solve.
+ *
+ * This function creates a new solve context for the given tableau, which must
+ * be prepared like for simplex_find_start_corner. The context has no limits and
+ * chooses the form automatically.
+ * The tableau is not copied and must live as long as the context.
+ *
+ * @param tableau
+ *    tableau of optimization problem
+ * @return new solve context or NULL if no memory is left
+ */
+struct SimplexContext *simplex_context_create(struct Tableau *tableau);
+
+/**
+ * @brief Free memory of given solve context.
+ *
+ * This function frees the context, its log buffer and the saved target function, but
+ * not the problem tableau.
+ *
+ * @param context
+ *    context to free
+ */
+void simplex_context_free(struct SimplexContext *context);
+
+/**
+ * @brief Run some steps of the simplex algorithm.
+ *
+ * This function continues the solve of the given context with at most maxPivots
+ * pivots (no limit if maxPivots <= 0). It runs phase 1, prepares the tableau and
+ * runs phase 2. If SIMPLEX_LIMIT_REACHED is returned the function can be called
+ * again to continue, e.g. after raising the limits of the context.
+ *
+ * If the form of the context is SIMPLEX_FORM_DUAL, or SIMPLEX_FORM_AUTO and the
+ * problem has much more equations than variables, the dual problem is solved
+ * and the tableau is pivoted into the optimal basis afterwards. If the dual
+ * problem is infeasible the primal problem is solved.
+ *
+ * Phase 1 starts with simplex_crash, if crash is set, and is skipped if the
+ * crash basis is valid.
+ * Otherwise it runs in the tableau itself and only minimizes the artificial
+ * variables. Afterwards the columns of the artificial variables are removed.
+ *
+ * Every reduceInterval pivots, and after pivots whose line exceeds
+ * reduceThreshold, each line of A and b is divided by its content, i.e. the
+ * largest common divisor of the numerators over the least common multiple of
+ * the denominators, and the content is kept as multiplier of the line. This
+ * keeps the numbers small on long solves. The ratio test and the signs do not
+ * depend on positive multipliers, so the pivots are the same. The multipliers
+ * are applied again before the function returns. Reductions are skipped while
+ * the log prints tableaus.
+ *
+ * The function clears the overflow flag of the calling thread when it starts,
+ * see rational_overflow, and stops with SIMPLEX_OVERFLOW as soon as a result
+ * was rounded, so SIMPLEX_OPTIMAL is only returned for exact solutions.
+ *
+ * @param context
+ *    solve to continue
+ * @param maxPivots
+ *    maximal number of pivots of this call
+ * @return status of solve
+ */
+enum SimplexStatus simplex_iterate(struct SimplexContext *context, long maxPivots);
+
+/**
+ * @brief Solve a tableau.
+ *
+ * This function runs phase 1 and phase 2 of the simplex algorithm for the given
+ * tableau without limits.
+ *
+ * @param tableau
+ *    tableau of optimization problem, solved in place
+ * @return status of solve
+ */
+enum SimplexStatus simplex_solve(struct Tableau *tableau);
+
+/**
+ * @brief Cancel a solve.
+ *
+ * This function sets the cancellation flag of the given context. It can be
+ * called from any thread, the running simplex_iterate stops before its next
+ * pivot with SIMPLEX_CANCELLED.
+ *
+ * @param context
+ *    solve to cancel
  */
-void simplex_find_best_solution(struct Tableau *tableau);
+void simplex_cancel(struct SimplexContext *context);
 
 #endif
@@ -0,0 +1,102 @@
+/**
+ * @brief Solver service.
+ *
+ * This file implements a program which serves solve requests over a Unix
+ * domain socket until it gets SIGINT or SIGTERM. The protocol is described in
+ * daemon.h.
+ *
+ * Usage: simplex_daemon [options] PATH
+ *   --workers N   number of worker threads, number of cores by default
+ *   --queue N     limit for accepted but unfinished requests
+ *
+ * @file simplex_daemon.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "daemon.h"
+
+static struct Daemon *running = NULL; /**< Daemon stopped by the signal handler. */
+
+/**
+ * @brief Stop the daemon.
+ *
+ * @param signal
+ *    received signal
+ */
+static void stop(int signal);
+
+/**
+ * @brief Run the daemon.
+ *
+ * @param argc
+ *    number of arguments
+ * @param argv
+ *    arguments
+ * @return EXIT_SUCCESS or EXIT_FAILURE if the socket could not be created or accept failed
+ */
+int main(int argc, char **argv)
+{
+    struct sigaction action;
+    const char *path = NULL;
+    int i, workers = 0, queue = 0, failed;
+
+    for(i=1; i<argc; ++i)
+    {
+        if(strcmp(argv[i], "--workers") == 0 && i + 1 < argc)
+        {
+            workers = atoi(argv[++i]);
+        }
+        else if(strcmp(argv[i], "--queue") == 0 && i + 1 < argc)
+        {
+            queue = atoi(argv[++i]);
+        }
+        else if(argv[i][0] != '-' && path == NULL)
+        {
+            path = argv[i];
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--workers N] [--queue N] PATH\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if(path == NULL)
+    {
+        fprintf(stderr, "Usage: %s [--workers N] [--queue N] PATH\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    running = daemon_create(path, workers, queue);
+    if(running == NULL)
+    {
+        fprintf(stderr, "Can not listen on %s\n", path);
+        return EXIT_FAILURE;
+    }
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = stop;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    failed = daemon_run(running) != 0;
+    if(failed)
+    {
+        fprintf(stderr, "Can not accept connections on %s\n", path);
+    }
+    fprintf(stderr, "Served %ld requests, rejected %ld requests\n", running->served, running->rejected);
+    daemon_free(running, path);
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+static void stop(int signal)
+{
+    (void)signal;
+    daemon_stop(running);
+}
@@ -0,0 +1,287 @@
+/**
+ * @brief Source file for simplex log.
+ *
+ * This file implements the logging of the simplex algorithm.
+ *
+ * @file simplex_log.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "simplex_log.h"
+#include "simplex.h"
+
+static _Thread_local struct SimplexLog *log_current = NULL; /**< Log bound to the current thread. */
+
+/**
+ * @brief Append formatted text to the current message.
+ *
+ * This function appends the printf-like formatted text to the format buffer
+ * of the log and grows the buffer if necessary.
+ *
+ * @param log
+ *    log to write
+ * @param format
+ *    printf format string
+ * @param args
+ *    format arguments
+ */
+static void log_vappend(struct SimplexLog *log, const char *format, va_list args);
+
+/**
+ * @brief Append formatted text to the current message.
+ *
+ * @param log
+ *    log to write
+ * @param format
+ *    printf format string
+ */
+static void log_append(struct SimplexLog *log, const char *format, ...);
+
+/**
+ * @brief Reserve space in the format buffer.
+ *
+ * This function grows the format buffer of the log, so that it can hold the
+ * current message, the given number of characters and '\0'. If no memory is
+ * left the buffer is kept and the text must be dropped.
+ *
+ * @param log
+ *    log to grow
+ * @param length
+ *    number of characters to append
+ * @return 0 on success, -1 if no memory is left
+ */
+static int log_reserve(struct SimplexLog *log, size_t length);
+
+/**
+ * @brief Append a right aligned rational number to the current message.
+ *
+ * @param log
+ *    log to write
+ * @param r
+ *    number to append
+ * @param width
+ *    minimal width of the number
+ */
+static void log_append_rational(struct SimplexLog *log, struct Rational *r, int width);
+
+/**
+ * @brief Pass the current message to the sink.
+ *
+ * @param log
+ *    log to flush
+ * @param level
+ *    level of message
+ */
+static void log_flush(struct SimplexLog *log, enum SimplexLogLevel level);
+
+void simplex_log_init(struct SimplexLog *log, enum SimplexLogLevel level, SimplexLogSink sink, void *data)
+{
+    log->level = level;
+    log->sink = sink;
+    log->data = data;
+    log->buffer = NULL;
+    log->size = 0;
+    log->length = 0;
+}
+
+void simplex_log_free(struct SimplexLog *log)
+{
+    free(log->buffer);
+    log->buffer = NULL;
+    log->size = 0;
+    log->length = 0;
+}
+
+void simplex_log_file_sink(void *data, enum SimplexLogLevel level, const char *message, size_t length)
+{
+    FILE *file = (data == NULL) ? stdout : (FILE *)data;
+
+    (void)level;
+    fwrite(message, 1, length, file);
+}
+
+struct SimplexLog *simplex_log_bind(struct SimplexLog *log)
+{
+    struct SimplexLog *previous = log_current;
+
+    log_current = log;
+
+    return previous;
+}
+
+struct SimplexLog *simplex_log_current(void)
+{
+    return log_current;
+}
+
+void simplex_log_printf(struct SimplexLog *log, enum SimplexLogLevel level, const char *format, ...)
+{
+    va_list args;
+
+    if(!SIMPLEX_LOG_ENABLED(log, level))
+    {
+        return;
+    }
+
+    va_start(args, format);
+    log_vappend(log, format, args);
+    va_end(args);
+
+    log_flush(log, level);
+}
+
+void simplex_log_tableau(struct SimplexLog *log, enum SimplexLogLevel level, struct Tableau *tableau)
+{
+    int i, j;
+    struct Rational value;
+
+    if(!SIMPLEX_LOG_ENABLED(log, level))
+    {
+        return;
+    }
+
+    log_append(log, "Tableau:\n");
+    for(i=0; i<tableau->cols; ++i)
+    {
+        log_append_rational(log, tableau->c[i], 8);
+        log_append(log, " ");
+    }
+    log_append(log, " |  ");
+    log_append_rational(log, tableau->z, 8);
+    log_append(log, "\n");
+    for(i=0; i<tableau->cols; ++i)
+    {
+        log_append(log, "---------");
+    }
+    log_append(log, "-------------\n");
+    for(i=0; i<tableau->rows; ++i)
+    {
+        for(j=0; j<tableau->cols; ++j)
+        {
+            log_append_rational(log, tableau->A[i][j], 8);
+            log_append(log, " ");
+        }
+        log_append(log, " |  ");
+        log_append_rational(log, tableau->b[i], 8);
+        log_append(log, "\n");
+    }
+
+    log_append(log, "Pivot-Line: %d, Pivot-Column: %d\n", tableau->pivotLine, tableau->pivotColumn);
+
+    value.n = -((tableau->z)->n);
+    value.d = (tableau->z)->d;
+    log_append(log, "aktueller Zielfunktionswert: ");
+    log_append_rational(log, &value, 0);
+    log_append(log, "\n");
+
+    log_append(log, "aktuelle Basisvariablen: [ ");
+    for(i=0; i<tableau->rows; ++i)
+    {
+        log_append(log, (i < tableau->rows-1) ? "%d, " : "%d", tableau->bvs[i]);
+    }
+    log_append(log, " ]\n");
+
+    log_append(log, "aktuelle Nichtbasisvariablen: [ ");
+    for(i=0; i<tableau->cols; ++i)
+    {
+        log_append(log, (i < tableau->cols-1) ? "%d, " : "%d", tableau->nbvs[i]);
+    }
+    log_append(log, " ]\n");
+
+    log_flush(log, level);
+}
+
+static void log_vappend(struct SimplexLog *log, const char *format, va_list args)
+{
+    va_list copy;
+    int n;
+
+    va_copy(copy, args);
+    n = vsnprintf((log->buffer == NULL) ? NULL : log->buffer + log->length, log->size - log->length, format, copy);
+    va_end(copy);
+
+    if(n < 0)
+    {
+        return;
+    }
+
+    if(log->length + (size_t)n >= log->size)
+    {
+        if(log_reserve(log, (size_t)n) != 0)
+        {
+            if(log->buffer != NULL) /* Drop the partially written text. */
+            {
+                log->buffer[log->length] = '\0';
+            }
+            return;
+        }
+        vsnprintf(log->buffer + log->length, log->size - log->length, format, args);
+    }
+
+    log->length += (size_t)n;
+}
+
+static int log_reserve(struct SimplexLog *log, size_t length)
+{
+    char *buffer;
+    size_t size;
+
+    if(log->length + length < log->size)
+    {
+        return 0;
+    }
+
+    size = (log->size == 0) ? 256 : log->size;
+    while(size <= log->length + length)
+    {
+        size *= 2;
+    }
+    buffer = (char *)realloc(log->buffer, size);
+    if(buffer == NULL)
+    {
+        return -1;
+    }
+    log->buffer = buffer;
+    log->size = size;
+
+    return 0;
+}
+
+static void log_append(struct SimplexLog *log, const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    log_vappend(log, format, args);
+    va_end(args);
+}
+
+static void log_append_rational(struct SimplexLog *log, struct Rational *r, int width)
+{
+    char string[BUFFER];
+    size_t n;
+
+    n = rational_format(string, BUFFER, *r);
+    if(log_reserve(log, ((size_t)width > n) ? (size_t)width : n) != 0)
+    {
+        return;
+    }
+    for(; (size_t)width > n; --width)
+    {
+        log->buffer[(log->length)++] = ' ';
+    }
+    memcpy(log->buffer + log->length, string, n);
+    log->length += n;
+}
+
+static void log_flush(struct SimplexLog *log, enum SimplexLogLevel level)
+{
+    log->sink(log->data, level, log->buffer, log->length);
+    log->length = 0;
+}
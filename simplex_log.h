@@ -0,0 +1,154 @@
+/**
+ * @brief Header file for simplex log.
+ *
+ * This file describes the logging of the simplex algorithm. Messages are
+ * formatted into a reusable buffer and passed to a sink function. A log is
+ * bound to the current thread with simplex_log_bind, the solve functions write
+ * to the bound log. Nothing is formatted if no log is bound or the level of a
+ * message is above the level of the log.
+ *
+ * @file simplex_log.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef SIMPLEX_LOG_H
+#define SIMPLEX_LOG_H SIMPLEX_LOG_H
+
+#include <stddef.h>
+
+struct Tableau;
+
+/**
+ * @brief Log levels.
+ *
+ * Each level includes the messages of the lower levels.
+ */
+enum SimplexLogLevel
+{
+    SIMPLEX_LOG_OFF, /**< No messages. */
+    SIMPLEX_LOG_SUMMARY, /**< Phase changes and results. */
+    SIMPLEX_LOG_PIVOT, /**< One message per pivot. */
+    SIMPLEX_LOG_TABLEAU /**< Full tableau after each pivot. */
+};
+
+/**
+ * @brief Sink for log messages.
+ *
+ * A sink gets the user data of the log, the level and the formatted message.
+ * The message is not terminated by '\0' and only valid during the call.
+ */
+typedef void (*SimplexLogSink)(void *data, enum SimplexLogLevel level, const char *message, size_t length);
+
+/**
+ * @brief Log of the simplex algorithm.
+ *
+ * This structure groups the settings and the format buffer of a log.
+ */
+struct SimplexLog
+{
+    enum SimplexLogLevel level; /**< Highest level which is logged. */
+    SimplexLogSink sink; /**< Function receiving the messages. */
+    void *data; /**< User data for the sink. */
+    char *buffer; /**< Reusable format buffer. */
+    size_t size; /**< Size of format buffer. */
+    size_t length; /**< Length of current message. */
+};
+
+/**
+ * @brief Check if messages of a level are logged.
+ *
+ * @param log
+ *    log to check, may be NULL
+ * @param lvl
+ *    level of message
+ */
+#define SIMPLEX_LOG_ENABLED(log, lvl) ((log) != NULL && (log)->level >= (lvl) && (log)->sink != NULL)
+
+/**
+ * @brief Initialize a log.
+ *
+ * This function initializes the given log with the given level and sink. The
+ * format buffer is allocated with the first message.
+ *
+ * @param log
+ *    log to initialize
+ * @param level
+ *    highest level which is logged
+ * @param sink
+ *    function receiving the messages
+ * @param data
+ *    user data for the sink
+ */
+void simplex_log_init(struct SimplexLog *log, enum SimplexLogLevel level, SimplexLogSink sink, void *data);
+
+/**
+ * @brief Free format buffer of a log.
+ *
+ * @param log
+ *    log to free
+ */
+void simplex_log_free(struct SimplexLog *log);
+
+/**
+ * @brief Sink writing to a file.
+ *
+ * This sink writes the messages to the FILE* given as user data, or to stdout
+ * if the user data is NULL.
+ */
+void simplex_log_file_sink(void *data, enum SimplexLogLevel level, const char *message, size_t length);
+
+/**
+ * @brief Bind log to the current thread.
+ *
+ * This function binds the given log to the calling thread. The solve functions
+ * of this thread write their messages to this log. NULL disables logging.
+ *
+ * @param log
+ *    log to bind or NULL
+ * @return previously bound log
+ */
+struct SimplexLog *simplex_log_bind(struct SimplexLog *log);
+
+/**
+ * @brief Get log of the current thread.
+ *
+ * @return log bound to the calling thread or NULL
+ */
+struct SimplexLog *simplex_log_current(void);
+
+/**
+ * @brief Log a message.
+ *
+ * This function formats the given printf-like message and passes it to the
+ * sink, if the level is enabled.
+ *
+ * @param log
+ *    log to write, may be NULL
+ * @param level
+ *    level of message
+ * @param format
+ *    printf format string
+ */
+void simplex_log_printf(struct SimplexLog *log, enum SimplexLogLevel level, const char *format, ...)
+#ifdef __GNUC__
+    __attribute__((format(printf, 3, 4)))
+#endif
+    ;
+
+/**
+ * @brief Log a tableau.
+ *
+ * This function formats the given tableau like simplex_print_tableau and passes
+ * it to the sink, if the level is enabled.
+ *
+ * @param log
+ *    log to write, may be NULL
+ * @param level
+ *    level of message
+ * @param tableau
+ *    tableau to log
+ */
+void simplex_log_tableau(struct SimplexLog *log, enum SimplexLogLevel level, struct Tableau *tableau);
+
+#endif
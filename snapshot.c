@@ -0,0 +1,333 @@
+/**
+ * @brief Implementation of snapshot.
+ *
+ * This file implements saving and loading of tableau snapshots. A loaded
+ * tableau needs one allocation per line for the pointer arrays, the cells
+ * themselves stay in the mapped or copied block.
+ *
+ * @file snapshot.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#define _POSIX_C_SOURCE 200112L /**< fileno and fsync also with -std=c99. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "snapshot.h"
+
+/**
+ * @brief Allocate memory.
+ *
+ * Nothing is allocated while failed is set, so one check after several calls
+ * is enough.
+ *
+ * @param size
+ *    number of bytes, may be 0
+ * @param failed
+ *    flag which is set if no memory is left
+ * @return new memory or NULL
+ */
+static void *snapshot_allocate(size_t size, int *failed);
+
+/**
+ * @brief Check the fields of a snapshot.
+ *
+ * @param header
+ *    header of snapshot
+ * @param variables
+ *    header.rows basis variables followed by header.cols none basis variables
+ * @param cells
+ *    z, c, b and A of the snapshot
+ * @return 1 if pivot, artificials and pricing are in range, the variables are a
+ *    permutation of 0 ... rows + cols - 1 and all denominators are positive, 0
+ *    else or if no memory is left
+ */
+static int snapshot_valid(const struct SnapshotHeader *header, const int32_t *variables, const struct Rational *cells);
+
+/**
+ * @brief Offset of the cells in a snapshot file.
+ *
+ * @param rows
+ *    number of equations
+ * @param cols
+ *    number of none basis variables
+ * @return offset of z in bytes
+ */
+static size_t snapshot_cells_offset(int rows, int cols);
+
+int snapshot_save(struct Tableau *tableau, const char *path)
+{
+    struct SnapshotHeader header;
+    FILE *file;
+    char *temporary;
+    int32_t variable;
+    int i, j, ok, failed = 0;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.byteOrder = SNAPSHOT_BYTE_ORDER;
+    header.rationalSize = sizeof(struct Rational);
+    header.rows = tableau->rows;
+    header.cols = tableau->cols;
+    header.pivotLine = tableau->pivotLine;
+    header.pivotColumn = tableau->pivotColumn;
+    header.artificials = tableau->artificials;
+    header.pricing = (int32_t)tableau->pricing;
+
+    temporary = (char *)snapshot_allocate(strlen(path) + 5, &failed);
+    if(failed)
+    {
+        return -1;
+    }
+    sprintf(temporary, "%s.tmp", path);
+    file = fopen(temporary, "wb");
+    if(file == NULL)
+    {
+        free(temporary);
+        return -1;
+    }
+
+    ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    for(i=0; ok && i<tableau->rows; ++i)
+    {
+        variable = tableau->bvs[i];
+        ok = fwrite(&variable, sizeof(variable), 1, file) == 1;
+    }
+    for(j=0; ok && j<tableau->cols; ++j)
+    {
+        variable = tableau->nbvs[j];
+        ok = fwrite(&variable, sizeof(variable), 1, file) == 1;
+    }
+    variable = 0;
+    if(ok && (tableau->rows + tableau->cols) % 2 != 0) /* Align the cells to 8 bytes. */
+    {
+        ok = fwrite(&variable, sizeof(variable), 1, file) == 1;
+    }
+
+    ok = ok && fwrite(tableau->z, sizeof(struct Rational), 1, file) == 1;
+    for(j=0; ok && j<tableau->cols; ++j)
+    {
+        ok = fwrite(tableau->c[j], sizeof(struct Rational), 1, file) == 1;
+    }
+    for(i=0; ok && i<tableau->rows; ++i)
+    {
+        ok = fwrite(tableau->b[i], sizeof(struct Rational), 1, file) == 1;
+    }
+    for(i=0; ok && i<tableau->rows; ++i)
+    {
+        for(j=0; ok && j<tableau->cols; ++j)
+        {
+            ok = fwrite(tableau->A[i][j], sizeof(struct Rational), 1, file) == 1;
+        }
+    }
+
+    ok = ok && fflush(file) == 0 && fsync(fileno(file)) == 0; /* Data is on disk before the rename. */
+    ok = (fclose(file) == 0) && ok;
+    ok = ok && rename(temporary, path) == 0;
+    if(!ok)
+    {
+        unlink(temporary);
+    }
+    free(temporary);
+
+    return ok ? 0 : -1;
+}
+
+struct Tableau *snapshot_load(const char *path, int map)
+{
+    struct SnapshotHeader header;
+    struct Tableau *tableau;
+    struct Rational *cells;
+    struct stat info;
+    const int32_t *variables;
+    char *data;
+    size_t offset, count;
+    int fd, i, j, failed = 0;
+
+    fd = open(path, O_RDONLY);
+    if(fd < 0)
+    {
+        return NULL;
+    }
+    if(fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(header))
+    {
+        close(fd);
+        return NULL;
+    }
+    data = (char *)mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(data == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    memcpy(&header, data, sizeof(header));
+    offset = snapshot_cells_offset(header.rows, header.cols);
+    count = 1 + (size_t)header.cols + (size_t)header.rows + (size_t)header.rows * (size_t)header.cols;
+    if(memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0 || header.version != SNAPSHOT_VERSION
+       || header.byteOrder != SNAPSHOT_BYTE_ORDER || header.rationalSize != sizeof(struct Rational)
+       || header.rows < 0 || header.cols < 0 || (size_t)info.st_size != offset + count * sizeof(struct Rational)
+       || !snapshot_valid(&header, (const int32_t *)(data + sizeof(header)), (const struct Rational *)(data + offset)))
+    {
+        munmap(data, (size_t)info.st_size);
+        return NULL;
+    }
+
+    tableau = (struct Tableau *)snapshot_allocate(sizeof(struct Tableau), &failed);
+    if(failed)
+    {
+        munmap(data, (size_t)info.st_size);
+        return NULL;
+    }
+    memset(tableau, 0, sizeof(struct Tableau)); /* Partly loaded tableaus can be freed. */
+    tableau->snapshot = data;
+    tableau->snapshotSize = (size_t)info.st_size;
+    tableau->snapshotMapped = 1;
+    tableau->rows = header.rows;
+    tableau->cols = header.cols;
+    tableau->pivotLine = header.pivotLine;
+    tableau->pivotColumn = header.pivotColumn;
+    tableau->artificials = header.artificials;
+    tableau->pricing = (enum SimplexPricing)header.pricing;
+
+    variables = (const int32_t *)(data + sizeof(header));
+    tableau->bvs = (int *)snapshot_allocate((size_t)tableau->rows * sizeof(int), &failed);
+    tableau->nbvs = (int *)snapshot_allocate((size_t)tableau->cols * sizeof(int), &failed);
+    tableau->c = (struct Rational **)snapshot_allocate((size_t)tableau->cols * sizeof(struct Rational *), &failed);
+    tableau->b = (struct Rational **)snapshot_allocate((size_t)tableau->rows * sizeof(struct Rational *), &failed);
+    tableau->A = (struct Rational ***)snapshot_allocate((size_t)tableau->rows * sizeof(struct Rational **), &failed);
+    for(i=0; !failed && i<tableau->rows; ++i)
+    {
+        tableau->A[i] = NULL;
+    }
+    for(i=0; !failed && i<tableau->rows; ++i)
+    {
+        tableau->A[i] = (struct Rational **)snapshot_allocate((size_t)tableau->cols * sizeof(struct Rational *), &failed);
+    }
+    for(i=0; !failed && i<tableau->rows; ++i)
+    {
+        tableau->bvs[i] = variables[i];
+    }
+    for(j=0; !failed && j<tableau->cols; ++j)
+    {
+        tableau->nbvs[j] = variables[tableau->rows + j];
+    }
+
+    cells = (struct Rational *)(data + offset);
+    if(!failed && !map) /* One copy of all cells, the mapping is not needed anymore. */
+    {
+        cells = (struct Rational *)snapshot_allocate(count * sizeof(struct Rational), &failed);
+        if(!failed)
+        {
+            memcpy(cells, data + offset, count * sizeof(struct Rational));
+            munmap(data, (size_t)info.st_size);
+            tableau->snapshot = cells;
+            tableau->snapshotSize = count * sizeof(struct Rational);
+            tableau->snapshotMapped = 0;
+        }
+    }
+    if(failed) /* Cells are not set, so only the arrays and the snapshot are freed. */
+    {
+        for(i=0; tableau->A != NULL && i<tableau->rows; ++i)
+        {
+            free(tableau->A[i]);
+        }
+        free(tableau->A);
+        free(tableau->b);
+        free(tableau->c);
+        tableau->A = NULL;
+        tableau->b = NULL;
+        tableau->c = NULL;
+        simplex_free_tableau(tableau);
+        return NULL;
+    }
+
+    tableau->z = cells;
+    for(j=0; j<tableau->cols; ++j)
+    {
+        tableau->c[j] = &(cells[1 + j]);
+    }
+    cells += 1 + tableau->cols;
+    for(i=0; i<tableau->rows; ++i)
+    {
+        tableau->b[i] = &(cells[i]);
+    }
+    cells += tableau->rows;
+    for(i=0; i<tableau->rows; ++i)
+    {
+        for(j=0; j<tableau->cols; ++j)
+        {
+            tableau->A[i][j] = &(cells[(size_t)i * tableau->cols + j]);
+        }
+    }
+
+    return tableau;
+}
+
+static void *snapshot_allocate(size_t size, int *failed)
+{
+    void *memory;
+
+    if(*failed)
+    {
+        return NULL;
+    }
+
+    memory = malloc(size);
+    if(memory == NULL && size > 0)
+    {
+        *failed = 1;
+    }
+
+    return memory;
+}
+
+static int snapshot_valid(const struct SnapshotHeader *header, const int32_t *variables, const struct Rational *cells)
+{
+    char *seen;
+    size_t k, count = 1 + (size_t)header->cols + (size_t)header->rows + (size_t)header->rows * (size_t)header->cols;
+    int i, total = header->rows + header->cols, valid = 1;
+
+    if(header->pivotLine < -1 || header->pivotLine >= header->rows || header->pivotColumn < -1
+       || header->pivotColumn >= header->cols || header->artificials < 0 || header->artificials > total
+       || (header->pricing != SIMPLEX_PRICING_BLAND && header->pricing != SIMPLEX_PRICING_DANTZIG))
+    {
+        return 0;
+    }
+
+    seen = (char *)calloc((size_t)total + 1, sizeof(char));
+    if(seen == NULL)
+    {
+        return 0;
+    }
+    for(i=0; valid && i<total; ++i)
+    {
+        valid = variables[i] >= 0 && variables[i] < total && !seen[variables[i]];
+        if(valid)
+        {
+            seen[variables[i]] = 1;
+        }
+    }
+    free(seen);
+    for(k=0; valid && k<count; ++k) /* Rationals are normalized to positive denominators. */
+    {
+        valid = cells[k].d > 0;
+    }
+
+    return valid;
+}
+
+static size_t snapshot_cells_offset(int rows, int cols)
+{
+    size_t offset = sizeof(struct SnapshotHeader) + ((size_t)rows + (size_t)cols) * sizeof(int32_t);
+
+    return (offset + 7) & ~(size_t)7;
+}
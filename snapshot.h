@@ -0,0 +1,81 @@
+/**
+ * @brief Header file for snapshot.
+ *
+ * This file describes a binary file format for tableaus, which allows to
+ * checkpoint a solve and to load a tableau without one allocation per cell.
+ *
+ * A snapshot file consists of a struct SnapshotHeader, the basis variables,
+ * the none basis variables, padding to a multiple of 8 bytes and the cells as
+ * flat array of struct Rational: z, c, b and A row by row. All numbers use the
+ * byte order of the writing machine, which is checked when loading.
+ *
+ * @file snapshot.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H SNAPSHOT_H
+
+#include <stdint.h>
+
+#include "simplex.h"
+
+#define SNAPSHOT_MAGIC "SMPLXSNP" /**< First 8 bytes of a snapshot file. */
+#define SNAPSHOT_VERSION 1 /**< Current version of the format. */
+#define SNAPSHOT_BYTE_ORDER 0x01020304u /**< Marker to detect files of another byte order. */
+
+/**
+ * @brief Header of a snapshot file.
+ */
+struct SnapshotHeader
+{
+    char magic[8]; /**< SNAPSHOT_MAGIC without '\0'. */
+    uint32_t version; /**< SNAPSHOT_VERSION. */
+    uint32_t byteOrder; /**< SNAPSHOT_BYTE_ORDER in the byte order of the file. */
+    uint32_t rationalSize; /**< Size of struct Rational in bytes. */
+    int32_t rows; /**< Number of equations. */
+    int32_t cols; /**< Number of none basis variables. */
+    int32_t pivotLine; /**< Current pivot line. */
+    int32_t pivotColumn; /**< Current pivot column. */
+    int32_t artificials; /**< First artificial variable. */
+    int32_t pricing; /**< Rule to choose the pivot column. */
+    int32_t reserved; /**< 0, pads the header to 48 bytes. */
+};
+
+/**
+ * @brief Save a tableau.
+ *
+ * This function writes the tableau to a temporary file next to the given path,
+ * syncs it to disk and renames it afterwards, so an existing snapshot is
+ * replaced atomically.
+ *
+ * @param tableau
+ *    tableau to save
+ * @param path
+ *    path of snapshot file
+ * @return 0 on success, -1 if the file could not be written or no memory is left
+ */
+int snapshot_save(struct Tableau *tableau, const char *path);
+
+/**
+ * @brief Load a tableau.
+ *
+ * This function creates a tableau whose cells point into one block of memory.
+ * If map is set, the block is a private mapping of the file, i.e. the cells are
+ * used in place without a copy; changes of the tableau are not written back.
+ * Otherwise the cells are copied into one allocation. In both cases all cells
+ * are read once to check their denominators. The tableau can be used and freed
+ * like any other tableau.
+ *
+ * @param path
+ *    path of snapshot file
+ * @param map
+ *    1 to map the file, 0 to copy it
+ * @return new tableau or NULL if the file could not be read, is no valid
+ *    snapshot, e.g. the variables are no permutation, the pivot is out of
+ *    range or a denominator is not positive, or no memory is left
+ */
+struct Tableau *snapshot_load(const char *path, int map);
+
+#endif
@@ -0,0 +1,81 @@
+/**
+ * @brief Source file for stats.
+ *
+ * This file implements the profiling counters.
+ *
+ * @file stats.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "stats.h"
+
+#ifndef SIMPLEX_NO_STATS
+_Thread_local struct SimplexStats *stats_current = NULL;
+#endif
+
+void stats_reset(struct SimplexStats *stats)
+{
+    memset(stats, 0, sizeof(struct SimplexStats));
+}
+
+struct SimplexStats *stats_bind(struct SimplexStats *stats)
+{
+#ifdef SIMPLEX_NO_STATS
+    (void)stats;
+    return NULL;
+#else
+    struct SimplexStats *previous = stats_current;
+
+    stats_current = stats;
+
+    return previous;
+#endif
+}
+
+void stats_add(struct SimplexStats *sum, const struct SimplexStats *summand)
+{
+    int i;
+
+    for(i=0; i<3; ++i)
+    {
+        sum->pivots[i] += summand->pivots[i];
+    }
+    sum->degeneratePivots += summand->degeneratePivots;
+    sum->rationalOperations += summand->rationalOperations;
+    sum->gcdCalls += summand->gcdCalls;
+    sum->overflowPromotions += summand->overflowPromotions;
+    sum->overflowRoundings += summand->overflowRoundings;
+    sum->lineReductions += summand->lineReductions;
+    sum->allocations += summand->allocations;
+    sum->allocatedBytes += summand->allocatedBytes;
+    sum->pricingSeconds += summand->pricingSeconds;
+    sum->ratioTestSeconds += summand->ratioTestSeconds;
+    sum->updateSeconds += summand->updateSeconds;
+}
+
+double stats_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+int stats_to_json(const struct SimplexStats *stats, char *buffer, size_t size)
+{
+    return snprintf(buffer, size,
+                    "{\"pivots_phase1\":%ld,\"pivots_prepare\":%ld,\"pivots_phase2\":%ld,"
+                    "\"degenerate_pivots\":%ld,\"rational_operations\":%ld,\"gcd_calls\":%ld,"
+                    "\"overflow_promotions\":%ld,\"overflow_roundings\":%ld,\"line_reductions\":%ld,\"allocations\":%ld,\"allocated_bytes\":%ld,"
+                    "\"pricing_seconds\":%.9f,\"ratio_test_seconds\":%.9f,\"update_seconds\":%.9f}",
+                    stats->pivots[1], stats->pivots[0], stats->pivots[2],
+                    stats->degeneratePivots, stats->rationalOperations, stats->gcdCalls,
+                    stats->overflowPromotions, stats->overflowRoundings, stats->lineReductions, stats->allocations, stats->allocatedBytes,
+                    stats->pricingSeconds, stats->ratioTestSeconds, stats->updateSeconds);
+}
@@ -0,0 +1,127 @@
+/**
+ * @brief Header file for stats.
+ *
+ * This file describes the profiling counters of the simplex algorithm. The
+ * counters of a solve are collected in a SimplexStats structure, which is bound
+ * to the current thread with stats_bind. The counting macros do nothing if no
+ * structure is bound and are removed completely if SIMPLEX_NO_STATS is defined.
+ *
+ * @file stats.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef STATS_H
+#define STATS_H STATS_H
+
+#include <stddef.h>
+
+/**
+ * @brief Profiling counters of a solve.
+ *
+ * This structure groups the counters and timers of a solve. Times are
+ * wall-clock times of a monotonic clock in seconds.
+ */
+struct SimplexStats
+{
+    int phase; /**< Phase the pivots are counted for: 1, 2 or 0 for the preparation of phase 2. */
+    long pivots[3]; /**< Number of pivots per phase. */
+    long degeneratePivots; /**< Number of pivots with step length 0. */
+    long rationalOperations; /**< Number of rational arithmetic operations. */
+    long gcdCalls; /**< Number of largest common divisor calculations. */
+    long overflowPromotions; /**< Number of operations which needed 64 bit intermediate values. */
+    long overflowRoundings; /**< Number of results which did not fit into int and were rounded. */
+    long lineReductions; /**< Number of lines divided by their content. */
+    long allocations; /**< Number of memory allocations. */
+    long allocatedBytes; /**< Number of allocated bytes. */
+    double pricingSeconds; /**< Time used to select the pivot column. */
+    double ratioTestSeconds; /**< Time used to select the pivot line. */
+    double updateSeconds; /**< Time used to update the tableau. */
+};
+
+#ifdef SIMPLEX_NO_STATS
+
+#define STATS_COUNT(field) do { } while(0)
+#define STATS_ADD(field, value) do { } while(0)
+#define STATS_ALLOC(bytes) do { } while(0)
+#define STATS_TIMER(name) do { (void)(name); } while(0)
+#define STATS_TIME(name, field) do { (void)(name); } while(0)
+
+#else
+
+extern _Thread_local struct SimplexStats *stats_current; /**< Counters bound to the current thread. */
+
+/** Increment the given counter of the bound structure. */
+#define STATS_COUNT(field) do { if(stats_current != NULL) { ++(stats_current->field); } } while(0)
+/** Add value to the given counter of the bound structure. */
+#define STATS_ADD(field, value) do { if(stats_current != NULL) { stats_current->field += (value); } } while(0)
+/** Count an allocation of the given number of bytes. */
+#define STATS_ALLOC(bytes) do { if(stats_current != NULL) { ++(stats_current->allocations); stats_current->allocatedBytes += (long)(bytes); } } while(0)
+/** Start a timer with the given name. The timer variable must be declared as double. */
+#define STATS_TIMER(name) do { if(stats_current != NULL) { name = stats_now(); } } while(0)
+/** Add the time since the start of the given timer to the given field. */
+#define STATS_TIME(name, field) do { if(stats_current != NULL) { stats_current->field += stats_now() - (name); } } while(0)
+
+#endif
+
+/**
+ * @brief Reset counters.
+ *
+ * This function sets all counters of the given structure to 0.
+ *
+ * @param stats
+ *    counters to reset
+ */
+void stats_reset(struct SimplexStats *stats);
+
+/**
+ * @brief Bind counters to the current thread.
+ *
+ * This function binds the given structure to the calling thread, i.e. all
+ * following operations of this thread are counted in the given structure.
+ * NULL disables counting.
+ *
+ * @param stats
+ *    counters to bind or NULL
+ * @return previously bound counters
+ */
+struct SimplexStats *stats_bind(struct SimplexStats *stats);
+
+/**
+ * @brief Add counters.
+ *
+ * This function adds all counters of summand to the counters of sum.
+ *
+ * @param sum
+ *    counters to update
+ * @param summand
+ *    counters to add
+ */
+void stats_add(struct SimplexStats *sum, const struct SimplexStats *summand);
+
+/**
+ * @brief Monotonic wall-clock time.
+ *
+ * This function returns the time of a monotonic high resolution clock.
+ *
+ * @return seconds since an arbitrary start point
+ */
+double stats_now(void);
+
+/**
+ * @brief Convert counters to JSON.
+ *
+ * This function writes the given counters as JSON object to the given buffer.
+ * Like snprintf the output is truncated to size bytes.
+ *
+ * @param stats
+ *    counters to convert
+ * @param buffer
+ *    buffer for the JSON object
+ * @param size
+ *    size of the buffer
+ * @return length of the complete JSON object
+ */
+int stats_to_json(const struct SimplexStats *stats, char *buffer, size_t size);
+
+#endif
@@ -0,0 +1,184 @@
+/**
+ * @brief Source file for thread pool.
+ *
+ * This file implements the pool of worker threads.
+ *
+ * @file thread_pool.c
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "thread_pool.h"
+
+/**
+ * @brief Main function of worker threads.
+ *
+ * This function runs queued tasks until the pool stops.
+ *
+ * @param data
+ *    thread pool
+ * @return NULL
+ */
+static void *thread_pool_worker(void *data);
+
+int thread_pool_cores(void)
+{
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (cores > 0) ? (int)cores : 1;
+}
+
+struct ThreadPool *thread_pool_create(int threads)
+{
+    struct ThreadPool *pool;
+    int i;
+
+    if(threads <= 0)
+    {
+        threads = thread_pool_cores();
+    }
+
+    pool = (struct ThreadPool *)malloc(sizeof(struct ThreadPool));
+    if(pool == NULL)
+    {
+        return NULL;
+    }
+    pool->threads = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    if(pool->threads == NULL)
+    {
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&(pool->mutex), NULL);
+    pthread_cond_init(&(pool->work), NULL);
+    pthread_cond_init(&(pool->done), NULL);
+    pool->head = NULL;
+    pool->tail = NULL;
+    pool->pending = 0;
+    pool->stop = 0;
+
+    for(i=0; i<threads; ++i)
+    {
+        if(pthread_create(&(pool->threads[i]), NULL, thread_pool_worker, pool) != 0)
+        {
+            break;
+        }
+    }
+    pool->size = i;
+    if(pool->size == 0)
+    {
+        pthread_mutex_destroy(&(pool->mutex));
+        pthread_cond_destroy(&(pool->work));
+        pthread_cond_destroy(&(pool->done));
+        free(pool->threads);
+        free(pool);
+        return NULL;
+    }
+
+    return pool;
+}
+
+void thread_pool_submit(struct ThreadPool *pool, ThreadPoolTask *task, void *data)
+{
+    struct ThreadPoolJob *job;
+
+    job = (struct ThreadPoolJob *)malloc(sizeof(struct ThreadPoolJob));
+    if(job == NULL)
+    {
+        task(data);
+        return;
+    }
+    job->task = task;
+    job->data = data;
+    job->next = NULL;
+
+    pthread_mutex_lock(&(pool->mutex));
+    if(pool->tail == NULL)
+    {
+        pool->head = job;
+    }
+    else
+    {
+        pool->tail->next = job;
+    }
+    pool->tail = job;
+    ++(pool->pending);
+    pthread_cond_signal(&(pool->work));
+    pthread_mutex_unlock(&(pool->mutex));
+}
+
+void thread_pool_wait(struct ThreadPool *pool)
+{
+    pthread_mutex_lock(&(pool->mutex));
+    while(pool->pending > 0)
+    {
+        pthread_cond_wait(&(pool->done), &(pool->mutex));
+    }
+    pthread_mutex_unlock(&(pool->mutex));
+}
+
+void thread_pool_free(struct ThreadPool *pool)
+{
+    int i;
+
+    thread_pool_wait(pool);
+
+    pthread_mutex_lock(&(pool->mutex));
+    pool->stop = 1;
+    pthread_cond_broadcast(&(pool->work));
+    pthread_mutex_unlock(&(pool->mutex));
+
+    for(i=0; i<pool->size; ++i)
+    {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_mutex_destroy(&(pool->mutex));
+    pthread_cond_destroy(&(pool->work));
+    pthread_cond_destroy(&(pool->done));
+    free(pool->threads);
+    free(pool);
+}
+
+static void *thread_pool_worker(void *data)
+{
+    struct ThreadPool *pool = (struct ThreadPool *)data;
+    struct ThreadPoolJob *job;
+
+    pthread_mutex_lock(&(pool->mutex));
+    for(;;)
+    {
+        while(pool->head == NULL && !pool->stop)
+        {
+            pthread_cond_wait(&(pool->work), &(pool->mutex));
+        }
+        if(pool->head == NULL)
+        {
+            break;
+        }
+
+        job = pool->head;
+        pool->head = job->next;
+        if(pool->head == NULL)
+        {
+            pool->tail = NULL;
+        }
+        pthread_mutex_unlock(&(pool->mutex));
+
+        job->task(job->data);
+        free(job);
+
+        pthread_mutex_lock(&(pool->mutex));
+        if(--(pool->pending) == 0)
+        {
+            pthread_cond_broadcast(&(pool->done));
+        }
+    }
+    pthread_mutex_unlock(&(pool->mutex));
+
+    return NULL;
+}
@@ -0,0 +1,109 @@
+/**
+ * @brief Header file for thread pool.
+ *
+ * This file describes a simple pool of worker threads, which run submitted
+ * tasks in the order of submission.
+ *
+ * @file thread_pool.h
+ * @author Thomas Irgang
+ * @date 19 Oct 2026
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H THREAD_POOL_H
+
+#include <pthread.h>
+
+/**
+ * @brief Task of a thread pool.
+ *
+ * @param data
+ *    data given to thread_pool_submit
+ */
+typedef void ThreadPoolTask(void *data);
+
+/**
+ * @brief Queued task.
+ */
+struct ThreadPoolJob
+{
+    ThreadPoolTask *task; /**< Function to run. */
+    void *data; /**< Argument of function. */
+    struct ThreadPoolJob *next; /**< Next queued task or NULL. */
+};
+
+/**
+ * @brief Pool of worker threads.
+ *
+ * All fields are protected by mutex.
+ */
+struct ThreadPool
+{
+    pthread_t *threads; /**< Worker threads. */
+    int size; /**< Number of worker threads. */
+    pthread_mutex_t mutex; /**< Lock of the queue. */
+    pthread_cond_t work; /**< Signaled if a task is queued or the pool stops. */
+    pthread_cond_t done; /**< Signaled if all tasks are finished. */
+    struct ThreadPoolJob *head; /**< First queued task. */
+    struct ThreadPoolJob *tail; /**< Last queued task. */
+    int pending; /**< Number of queued and running tasks. */
+    int stop; /**< 1 if the workers shall stop. */
+};
+
+/**
+ * @brief Get number of cores.
+ *
+ * @return number of online processors, at least 1
+ */
+int thread_pool_cores(void);
+
+/**
+ * @brief Create a thread pool.
+ *
+ * This function starts the given number of worker threads. If only some of
+ * them can be started, the pool runs with these.
+ *
+ * @param threads
+ *    number of worker threads, thread_pool_cores() if <= 0
+ * @return new thread pool or NULL if no memory is left or no worker thread can be started
+ */
+struct ThreadPool *thread_pool_create(int threads);
+
+/**
+ * @brief Queue a task.
+ *
+ * This function queues the given task, which is run by the next free worker.
+ * If there is no memory left for the queue entry, the task runs in the calling
+ * thread before this function returns.
+ *
+ * @param pool
+ *    pool to run task
+ * @param task
+ *    function to run
+ * @param data
+ *    argument of function
+ */
+void thread_pool_submit(struct ThreadPool *pool, ThreadPoolTask *task, void *data);
+
+/**
+ * @brief Wait for all tasks.
+ *
+ * This function blocks until all submitted tasks are finished.
+ *
+ * @param pool
+ *    pool to wait for
+ */
+void thread_pool_wait(struct ThreadPool *pool);
+
+/**
+ * @brief Free a thread pool.
+ *
+ * This function waits for all submitted tasks, stops the workers and frees
+ * the pool.
+ *
+ * @param pool
+ *    pool to free
+ */
+void thread_pool_free(struct ThreadPool *pool);
+
+#endif